@@ -22,6 +22,12 @@ DEFINES += QT_DEPRECATED_WARNINGS
 # You can also select to disable deprecated APIs only up to a certain version of Qt.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+# Uncomment the following line to count heap allocations per frame and per subsystem (see MemoryProfiler).
+#DEFINES += SHADE_ENGINE_MEMORY_PROFILING
+
+# Uncomment the following line to record a timeline of engine scopes exportable as Chrome trace JSON (see Tracer).
+#DEFINES += SHADE_ENGINE_TRACING
+
 
 SOURCES += \
         main.cpp \
@@ -29,14 +35,85 @@ SOURCES += \
     src/Test/TestShadeWidget.cpp \
     src/Characters/AbstractRPGCharacter.cpp \
     src/Graphics/SpriteLayersWidget.cpp \
-    src/Test/CreateSpriteList.cpp
+    src/Test/CreateSpriteList.cpp \
+    src/Characters/XPLedger.cpp \
+    src/Graphics/SceneGraph.cpp \
+    src/Graphics/SpriteBatch.cpp \
+    src/Graphics/Camera.cpp \
+    src/Graphics/SharedResources.cpp \
+    src/Graphics/SpriteLayersRenderer.cpp \
+    src/Graphics/RenderRecorder.cpp \
+    src/Input/InputState.cpp \
+    src/Core/LatencyHistogram.cpp \
+    src/Core/FrameArena.cpp \
+    src/Core/MemoryProfiler.cpp \
+    src/Scene/SceneLoader.cpp \
+    src/Scene/WorldStreamer.cpp \
+    src/Graphics/PaletteSpriteBatch.cpp \
+    src/Graphics/AlphaMask.cpp \
+    src/Graphics/SpritePicker.cpp \
+    src/Collision/CollisionWorld.cpp \
+    src/Navigation/NavigationGrid.cpp \
+    src/Navigation/JumpPointSearch.cpp \
+    src/Navigation/PathfindingService.cpp \
+    src/Graphics/LightMap.cpp \
+    src/Graphics/TextBatch.cpp \
+    src/Audio/SFMLAudioDevice.cpp \
+    src/Audio/NullAudioDevice.cpp \
+    src/Audio/AudioMixer.cpp \
+    src/Network/BitStream.cpp \
+    src/Network/ReplicationCodec.cpp \
+    src/Network/ReplicationServer.cpp \
+    src/Network/ReplicationClient.cpp \
+    src/Core/Tracer.cpp \
+    src/Core/JobSystem.cpp
 
 HEADERS += \
         include/Graphics/AbstractShadeWidget.h \
     include/Test/TestShadeWidget.h \
     include/Characters/AbstractRPGCharacter.h \
     include/Graphics/SpriteLayersWidget.h \
-    include/Test/CreateSpriteList.h
+    include/Test/CreateSpriteList.h \
+    include/Characters/XPLedger.h \
+    include/Core/EventChannel.h \
+    include/Characters/LevelEventChannel.h \
+    include/Graphics/SceneGraph.h \
+    include/Graphics/SpriteBatch.h \
+    include/Graphics/Camera.h \
+    include/Graphics/SharedResources.h \
+    include/Graphics/SpriteLayersRenderer.h \
+    include/Graphics/RenderCaptureFormat.h \
+    include/Graphics/RenderRecorder.h \
+    include/Core/SPSCQueue.h \
+    include/Core/FrameArena.h \
+    include/Core/ArenaAllocator.h \
+    include/Core/MemoryProfiler.h \
+    include/Input/InputEvent.h \
+    include/Input/InputState.h \
+    include/Core/LatencyHistogram.h \
+    include/Scene/SceneFormat.h \
+    include/Scene/SceneLoader.h \
+    include/Scene/WorldStreamer.h \
+    include/Graphics/PaletteSpriteBatch.h \
+    include/Graphics/AlphaMask.h \
+    include/Graphics/SpritePicker.h \
+    include/Collision/CollisionWorld.h \
+    include/Navigation/NavigationGrid.h \
+    include/Navigation/JumpPointSearch.h \
+    include/Navigation/PathfindingService.h \
+    include/Graphics/LightMap.h \
+    include/Graphics/TextBatch.h \
+    include/Audio/AbstractAudioDevice.h \
+    include/Audio/SFMLAudioDevice.h \
+    include/Audio/NullAudioDevice.h \
+    include/Audio/AudioMixer.h \
+    include/Network/ReplicationFormat.h \
+    include/Network/BitStream.h \
+    include/Network/ReplicationCodec.h \
+    include/Network/ReplicationServer.h \
+    include/Network/ReplicationClient.h \
+    include/Core/Tracer.h \
+    include/Core/JobSystem.h
 
 LIBS += -lsfml-audio -lsfml-graphics -lsfml-network -lsfml-window -lsfml-system
 
@@ -0,0 +1,26 @@
+#-------------------------------------------------
+#
+# Check of CollisionWorld against brute force
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = CollisionCheck
+TEMPLATE = app
+CONFIG += console release
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp \
+    ../../src/Collision/CollisionWorld.cpp
+
+HEADERS += \
+    ../../include/Collision/CollisionWorld.h
+
+LIBS += -lsfml-graphics -lsfml-system
@@ -0,0 +1,284 @@
+/*!
+ * @file main.cpp
+ * @brief Check of CollisionWorld against brute force.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Creates random boxes and circles with random masks, then moves, reshapes, destroys and creates colliders for a number of frames. <br>
+ * Pairs found by the grid and results of random area queries are compared with a test of every pair of colliders. <br>
+ * Reports the mean duration of a frame and exits with 1 on mismatch.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "include/Collision/CollisionWorld.h"
+
+namespace
+{
+    const float WORLD_HALF_SIZE = 2000.f; /*!< Colliders are created in a square of this half size around the origin. */
+    const unsigned int AREA_QUERY_COUNT = 200; /*!< Number of random area queries checked. */
+
+    typedef std::set< std::pair<ShadeEngine::ColliderId, ShadeEngine::ColliderId> > PairSet;
+
+    /*!
+    * @brief Get a random number in a range
+    */
+    float randomFloat(float min, float max)
+    {
+        return min + (max - min) * (std::rand() / static_cast<float>(RAND_MAX));
+    }
+
+    /*!
+    * @brief Get a random mask, sometimes colliding with everything
+    */
+    uint32_t randomMask()
+    {
+        return std::rand() % 8 == 0 ? ShadeEngine::CollisionWorld::ALL_MASKS : 1u << (std::rand() % 3);
+    }
+
+    /*!
+    * @brief Create a random box or circle
+    */
+    ShadeEngine::ColliderId createRandomCollider(ShadeEngine::CollisionWorld& world)
+    {
+        if(std::rand() % 2)
+        {
+            return world.createBox(sf::FloatRect(randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE), randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE), randomFloat(4.f, 40.f), randomFloat(4.f, 40.f)), randomMask());
+        }
+        return world.createCircle(sf::Vector2f(randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE), randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE)), randomFloat(2.f, 20.f), randomMask());
+    }
+
+    /*!
+    * @brief Test whether a collider touches an area, the way CollisionWorld defines it
+    */
+    bool touchesArea(const ShadeEngine::CollisionWorld& world, ShadeEngine::ColliderId collider, const sf::FloatRect& area)
+    {
+        sf::FloatRect bounds = world.getBounds(collider);
+        if(bounds.left >= area.left + area.width || area.left >= bounds.left + bounds.width || bounds.top >= area.top + area.height || area.top >= bounds.top + bounds.height)
+        {
+            return false;
+        }
+        if(world.getShape(collider) != ShadeEngine::COLLIDER_CIRCLE)
+        {
+            return true;
+        }
+        float radius = bounds.width / 2.f;
+        float center_x = bounds.left + radius;
+        float center_y = bounds.top + radius;
+        float dx = center_x - std::max(area.left, std::min(center_x, area.left + area.width));
+        float dy = center_y - std::max(area.top, std::min(center_y, area.top + area.height));
+        return dx * dx + dy * dy < radius * radius;
+    }
+
+    /*!
+    * @brief Test whether two colliders overlap, the way CollisionWorld defines it
+    */
+    bool collide(const ShadeEngine::CollisionWorld& world, ShadeEngine::ColliderId first, ShadeEngine::ColliderId second)
+    {
+        if((world.getMask(first) & world.getMask(second)) == 0)
+        {
+            return false;
+        }
+        bool first_circle = world.getShape(first) == ShadeEngine::COLLIDER_CIRCLE;
+        bool second_circle = world.getShape(second) == ShadeEngine::COLLIDER_CIRCLE;
+        if(first_circle && second_circle)
+        {
+            sf::FloatRect a = world.getBounds(first);
+            sf::FloatRect b = world.getBounds(second);
+            float dx = (a.left + a.width / 2.f) - (b.left + b.width / 2.f);
+            float dy = (a.top + a.height / 2.f) - (b.top + b.height / 2.f);
+            float radius_sum = a.width / 2.f + b.width / 2.f;
+            return dx * dx + dy * dy < radius_sum * radius_sum;
+        }
+        return first_circle ? touchesArea(world, first, world.getBounds(second)) : touchesArea(world, second, world.getBounds(first));
+    }
+
+    /*!
+    * @brief Find colliding pairs by testing every pair of colliders
+    */
+    PairSet findPairsBruteForce(const ShadeEngine::CollisionWorld& world, const std::vector<ShadeEngine::ColliderId>& colliders)
+    {
+        PairSet pairs;
+        for(std::size_t i = 0; i < colliders.size(); ++i)
+        {
+            for(std::size_t j = i + 1; j < colliders.size(); ++j)
+            {
+                if(collide(world, colliders[i], colliders[j]))
+                {
+                    pairs.insert(std::make_pair(std::min(colliders[i], colliders[j]), std::max(colliders[i], colliders[j])));
+                }
+            }
+        }
+        return pairs;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int collider_count = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 10000;
+    unsigned int frame_count = argc > 2 ? std::strtoul(argv[2], NULL, 10) : 60;
+    std::srand(argc > 3 ? std::strtoul(argv[3], NULL, 10) : 1);
+
+    ShadeEngine::CollisionWorld world(32.f);
+    std::vector<ShadeEngine::ColliderId> colliders;
+    for(unsigned int i = 0; i < collider_count; ++i)
+    {
+        colliders.push_back(createRandomCollider(world));
+    }
+
+    std::vector<ShadeEngine::CollisionPair> pairs;
+    double total_ms = 0.;
+    for(unsigned int frame = 0; frame < frame_count; ++frame)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(std::vector<ShadeEngine::ColliderId>::iterator collider_it = colliders.begin(); collider_it != colliders.end(); ++collider_it)
+        {
+            world.move(*collider_it, sf::Vector2f(randomFloat(-3.f, 3.f), randomFloat(-3.f, 3.f)));
+        }
+        world.findPairs(pairs);
+        total_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // Replace a few colliders so that identifiers and cells get reused
+        for(unsigned int i = 0; i < collider_count / 100 + 1; ++i)
+        {
+            std::size_t index = std::rand() % colliders.size();
+            world.destroyCollider(colliders[index]);
+            colliders[index] = createRandomCollider(world);
+            index = std::rand() % colliders.size();
+            sf::Vector2f position(randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE), randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE));
+            if(world.getShape(colliders[index]) == ShadeEngine::COLLIDER_CIRCLE)
+            {
+                world.setCircle(colliders[index], position, randomFloat(2.f, 60.f));
+            }
+            else
+            {
+                world.setBox(colliders[index], sf::FloatRect(position, sf::Vector2f(randomFloat(4.f, 120.f), randomFloat(4.f, 120.f))));
+            }
+        }
+    }
+    world.findPairs(pairs);
+    std::printf("%u colliders, %.3f ms per frame (moves and pairs)\n", collider_count, frame_count > 0 ? total_ms / frame_count : 0.);
+
+    unsigned int mismatch_count = 0;
+    PairSet grid_pairs;
+    for(std::vector<ShadeEngine::CollisionPair>::const_iterator pair_it = pairs.begin(); pair_it != pairs.end(); ++pair_it)
+    {
+        if(!grid_pairs.insert(std::make_pair(pair_it->first, pair_it->second)).second)
+        {
+            ++mismatch_count; // Pair reported twice
+        }
+    }
+    PairSet brute_force_pairs = findPairsBruteForce(world, colliders);
+    if(grid_pairs != brute_force_pairs)
+    {
+        ++mismatch_count;
+    }
+    std::printf("%lu pairs found, %lu expected\n", static_cast<unsigned long>(grid_pairs.size()), static_cast<unsigned long>(brute_force_pairs.size()));
+
+    std::vector<ShadeEngine::ColliderId> hits;
+    for(unsigned int query = 0; query < AREA_QUERY_COUNT; ++query)
+    {
+        sf::FloatRect area(randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE), randomFloat(-WORLD_HALF_SIZE, WORLD_HALF_SIZE), randomFloat(1.f, 300.f), randomFloat(1.f, 300.f));
+        world.queryArea(area, hits);
+        std::set<ShadeEngine::ColliderId> hit_set(hits.begin(), hits.end());
+        std::set<ShadeEngine::ColliderId> expected;
+        for(std::vector<ShadeEngine::ColliderId>::const_iterator collider_it = colliders.begin(); collider_it != colliders.end(); ++collider_it)
+        {
+            if(touchesArea(world, *collider_it, area))
+            {
+                expected.insert(*collider_it);
+            }
+        }
+        if(hit_set.size() != hits.size() || hit_set != expected)
+        {
+            ++mismatch_count;
+        }
+    }
+
+    std::printf("%u mismatches\n", mismatch_count);
+    return mismatch_count == 0 ? 0 : 1;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,28 @@
+#-------------------------------------------------
+#
+# Check of JumpPointSearch against Dijkstra
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = PathfindingCheck
+TEMPLATE = app
+CONFIG += console release
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp \
+    ../../src/Navigation/NavigationGrid.cpp \
+    ../../src/Navigation/JumpPointSearch.cpp
+
+HEADERS += \
+    ../../include/Navigation/NavigationGrid.h \
+    ../../include/Navigation/JumpPointSearch.h
+
+LIBS += -lsfml-system
@@ -0,0 +1,262 @@
+/*!
+ * @file main.cpp
+ * @brief Check of JumpPointSearch against Dijkstra.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Builds random grids of random size and obstacle density, then runs random queries with JumpPointSearch and with a plain Dijkstra search. <br>
+ * Paths must link start to goal with walkable steps to adjacent tiles, never cut corners and cost as much as the Dijkstra path. Both searches must agree on unreachable goals. <br>
+ * Reports the mean duration of queries on a large grid and exits with 1 on mismatch.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "include/Navigation/JumpPointSearch.h"
+
+namespace
+{
+    const double DIAGONAL_COST = 1.4142135623730951; /*!< Cost of a diagonal step. */
+    const double COST_TOLERANCE = 1e-3; /*!< Tolerance on path costs, JumpPointSearch accumulates costs in single precision. */
+    const int LARGE_GRID_SIZE = 512; /*!< Width and height of the grid used for timing. */
+    const unsigned int LARGE_GRID_QUERY_COUNT = 1000; /*!< Number of queries timed on the large grid. */
+
+    /*!
+    * @brief Check whether a step from a tile cuts a corner
+    */
+    bool cutsCorner(const ShadeEngine::NavigationGrid& grid, int x, int y, int dx, int dy)
+    {
+        return dx != 0 && dy != 0 && (!grid.isWalkable(x + dx, y) || !grid.isWalkable(x, y + dy));
+    }
+
+    /*!
+    * @brief Get cost of the shortest 8-connected path not cutting corners
+    * @return Cost of the path or -1 if goal cannot be reached
+    */
+    double findCostDijkstra(const ShadeEngine::NavigationGrid& grid, const sf::Vector2i& start, const sf::Vector2i& goal)
+    {
+        if(!grid.isWalkable(start.x, start.y) || !grid.isWalkable(goal.x, goal.y))
+        {
+            return -1.;
+        }
+
+        int width = grid.getWidth();
+        std::vector<double> costs(width * grid.getHeight(), -1.);
+        typedef std::pair<double, int> QueueEntry;
+        std::priority_queue< QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > queue;
+        costs[start.y * width + start.x] = 0.;
+        queue.push(QueueEntry(0., start.y * width + start.x));
+        while(!queue.empty())
+        {
+            QueueEntry entry = queue.top();
+            queue.pop();
+            if(entry.first > costs[entry.second]) // Outdated entry
+            {
+                continue;
+            }
+            int x = entry.second % width;
+            int y = entry.second / width;
+            if(x == goal.x && y == goal.y)
+            {
+                return entry.first;
+            }
+            for(int dy = -1; dy <= 1; ++dy)
+            {
+                for(int dx = -1; dx <= 1; ++dx)
+                {
+                    if((dx == 0 && dy == 0) || !grid.isWalkable(x + dx, y + dy) || cutsCorner(grid, x, y, dx, dy))
+                    {
+                        continue;
+                    }
+                    int neighbor = (y + dy) * width + x + dx;
+                    double cost = entry.first + (dx != 0 && dy != 0 ? DIAGONAL_COST : 1.);
+                    if(costs[neighbor] < 0. || cost < costs[neighbor])
+                    {
+                        costs[neighbor] = cost;
+                        queue.push(QueueEntry(cost, neighbor));
+                    }
+                }
+            }
+        }
+        return -1.;
+    }
+
+    /*!
+    * @brief Check a path found by JumpPointSearch
+    * @return Cost of the path or -1 if path is not valid
+    */
+    double checkPath(const ShadeEngine::NavigationGrid& grid, const sf::Vector2i& start, const sf::Vector2i& goal, const std::vector<sf::Vector2i>& path)
+    {
+        if(path.empty() || path.front() != start || path.back() != goal)
+        {
+            return -1.;
+        }
+        double cost = 0.;
+        for(std::size_t i = 1; i < path.size(); ++i)
+        {
+            int dx = path[i].x - path[i - 1].x;
+            int dy = path[i].y - path[i - 1].y;
+            if(std::abs(dx) > 1 || std::abs(dy) > 1 || (dx == 0 && dy == 0) || !grid.isWalkable(path[i].x, path[i].y) || cutsCorner(grid, path[i - 1].x, path[i - 1].y, dx, dy))
+            {
+                return -1.;
+            }
+            cost += dx != 0 && dy != 0 ? DIAGONAL_COST : 1.;
+        }
+        return cost;
+    }
+
+    /*!
+    * @brief Block random tiles of a grid
+    */
+    void addObstacles(ShadeEngine::NavigationGrid& grid, unsigned int obstacle_percent)
+    {
+        for(int y = 0; y < grid.getHeight(); ++y)
+        {
+            for(int x = 0; x < grid.getWidth(); ++x)
+            {
+                if(static_cast<unsigned int>(std::rand() % 100) < obstacle_percent)
+                {
+                    grid.setWalkable(x, y, false);
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int grid_count = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 300;
+    unsigned int queries_per_grid = argc > 2 ? std::strtoul(argv[2], NULL, 10) : 20;
+    std::srand(argc > 3 ? std::strtoul(argv[3], NULL, 10) : 1);
+
+    ShadeEngine::JumpPointSearch search; // Reused across grids, as workers of PathfindingService do
+    std::vector<sf::Vector2i> path;
+    unsigned int mismatch_count = 0;
+    unsigned int reachable_count = 0;
+    for(unsigned int grid_index = 0; grid_index < grid_count; ++grid_index)
+    {
+        ShadeEngine::NavigationGrid grid(10 + std::rand() % 60, 10 + std::rand() % 60);
+        addObstacles(grid, std::rand() % 40);
+        for(unsigned int query = 0; query < queries_per_grid; ++query)
+        {
+            sf::Vector2i start(std::rand() % grid.getWidth(), std::rand() % grid.getHeight());
+            sf::Vector2i goal(std::rand() % grid.getWidth(), std::rand() % grid.getHeight());
+            double expected_cost = findCostDijkstra(grid, start, goal);
+            bool found = search.findPath(grid, start, goal, path);
+            if(found != (expected_cost >= 0.))
+            {
+                ++mismatch_count;
+                continue;
+            }
+            if(found)
+            {
+                ++reachable_count;
+                double cost = checkPath(grid, start, goal, path);
+                if(cost < 0. || std::fabs(cost - expected_cost) > COST_TOLERANCE)
+                {
+                    ++mismatch_count;
+                }
+            }
+        }
+    }
+    std::printf("%u queries checked, %u reachable\n", grid_count * queries_per_grid, reachable_count);
+
+    ShadeEngine::NavigationGrid large_grid(LARGE_GRID_SIZE, LARGE_GRID_SIZE);
+    addObstacles(large_grid, 15);
+    uint64_t expanded_count = 0;
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(unsigned int query = 0; query < LARGE_GRID_QUERY_COUNT; ++query)
+    {
+        search.findPath(large_grid, sf::Vector2i(std::rand() % LARGE_GRID_SIZE, std::rand() % LARGE_GRID_SIZE), sf::Vector2i(std::rand() % LARGE_GRID_SIZE, std::rand() % LARGE_GRID_SIZE), path);
+        expanded_count += search.getExpandedNodeCount();
+    }
+    double total_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+    std::printf("%dx%d grid: %.3f ms per query, %.1f nodes expanded per query\n", LARGE_GRID_SIZE, LARGE_GRID_SIZE, total_ms / LARGE_GRID_QUERY_COUNT, static_cast<double>(expanded_count) / LARGE_GRID_QUERY_COUNT);
+
+    std::printf("%u mismatches\n", mismatch_count);
+    return mismatch_count == 0 ? 0 : 1;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,29 @@
+#-------------------------------------------------
+#
+# Microbenchmarks of AbstractRPGCharacter XP progression
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = RPGCharacterBenchmark
+TEMPLATE = app
+CONFIG += console release
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+DEFINES += SHADE_ENGINE_MEMORY_PROFILING # Heap allocations are counted by MemoryProfiler
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp \
+    ../../src/Characters/AbstractRPGCharacter.cpp \
+    ../../src/Core/MemoryProfiler.cpp
+
+HEADERS += \
+    ../../include/Characters/AbstractRPGCharacter.h \
+    ../../include/Characters/LevelEventChannel.h \
+    ../../include/Core/EventChannel.h \
+    ../../include/Core/MemoryProfiler.h
@@ -0,0 +1,288 @@
+/*!
+ * @file main.cpp
+ * @brief Microbenchmarks of RPG characters progression.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Measures the cost of AbstractRPGCharacter::gainXP and AbstractRPGCharacter::loseXP for various XP curves, level caps and XP deltas. <br>
+ * For each scenario, reports the mean time per operation and the number of heap allocations per operation.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "include/Characters/AbstractRPGCharacter.h"
+#include "include/Core/MemoryProfiler.h"
+
+namespace
+{
+    /*!
+    * @brief XP curves used by the benchmarks
+    */
+    enum XPCurve
+    {
+        LINEAR, /*!< 100 XP per level */
+        QUADRATIC, /*!< 50 * level^2 XP */
+        EXPONENTIAL /*!< XP growing by 10% each level */
+    };
+
+    /*! \class BenchmarkCharacter
+    * \brief Concrete character used to benchmark default progression behavior.
+    *
+    * XP of each level is precomputed so that only the progression loops are measured.
+    *
+    */
+    class BenchmarkCharacter : public ShadeEngine::AbstractRPGCharacter
+    {
+    public:
+        BenchmarkCharacter(XPCurve curve, uint8_t level_max) : AbstractRPGCharacter(level_max, true), m_level_changes(0)
+        {
+            double exponential_xp = 100.0;
+            for(unsigned int level = 0; level < 257; ++level)
+            {
+                switch(curve)
+                {
+                case LINEAR:
+                    m_levels_xp[level] = level <= 1 ? 0 : 100 * (level - 1);
+                    break;
+                case QUADRATIC:
+                    m_levels_xp[level] = level <= 1 ? 0 : 50 * static_cast<uint64_t>(level) * level;
+                    break;
+                case EXPONENTIAL:
+                    m_levels_xp[level] = level <= 1 ? 0 : static_cast<uint64_t>(exponential_xp);
+                    level > 1 && (exponential_xp *= 1.1);
+                    break;
+                }
+            }
+        }
+
+        uint64_t getMaxXP() const
+        {
+            return m_levels_xp[m_level_max];
+        }
+
+        uint64_t m_level_changes; /*!< Number of onLevelUp and onLevelDown calls. Read to keep calls from being optimized away. */
+
+    protected:
+        uint64_t m_levels_xp[257]; /*!< XP associated with each level. */
+
+        virtual void onLevelUp()
+        {
+            ++m_level_changes;
+        }
+
+        virtual void onLevelDown()
+        {
+            ++m_level_changes;
+        }
+
+        virtual uint64_t getLevelXp(uint8_t level) const
+        {
+            return m_levels_xp[level];
+        }
+    };
+
+    /*!
+    * @brief Result of a benchmark scenario
+    */
+    struct BenchmarkResult
+    {
+        double ns_per_op; /*!< Mean duration of an operation in nanoseconds. */
+        double allocations_per_op; /*!< Mean number of heap allocations per operation. */
+    };
+
+    typedef uint64_t (*Scenario)(BenchmarkCharacter&, uint64_t iterations);
+
+    /*!
+    * @brief Grant all XP up to level max in a single call, then reset character
+    */
+    uint64_t singleLargeGrant(BenchmarkCharacter& character, uint64_t iterations)
+    {
+        uint64_t max_xp = character.getMaxXP();
+        for(uint64_t i = 0; i < iterations; ++i)
+        {
+            character.restoreState(1, 0);
+            character.gainXP(max_xp);
+        }
+        return iterations;
+    }
+
+    /*!
+    * @brief Grant 1/1000 of max XP per call until level max is reached
+    */
+    uint64_t manySmallGrants(BenchmarkCharacter& character, uint64_t iterations)
+    {
+        uint64_t max_xp = character.getMaxXP();
+        uint64_t grant = max_xp / 1000 + 1;
+        uint64_t operations = 0;
+        for(uint64_t i = 0; i < iterations / 1000 + 1; ++i)
+        {
+            character.restoreState(1, 0);
+            while(character.getXP() < max_xp)
+            {
+                character.gainXP(grant);
+                ++operations;
+            }
+        }
+        return operations;
+    }
+
+    /*!
+    * @brief Alternate gains and losses crossing several levels each time
+    */
+    uint64_t levelDownChurn(BenchmarkCharacter& character, uint64_t iterations)
+    {
+        uint64_t delta = character.getMaxXP() / 4;
+        character.restoreState(character.getLevelMax(), character.getMaxXP());
+        character.loseXP(delta);
+        for(uint64_t i = 0; i < iterations; ++i)
+        {
+            character.loseXP(delta);
+            character.gainXP(delta);
+        }
+        return 2 * iterations;
+    }
+
+    /*!
+    * @brief Grant XP to a character already at level max
+    */
+    uint64_t maxLevelSaturation(BenchmarkCharacter& character, uint64_t iterations)
+    {
+        character.restoreState(character.getLevelMax(), character.getMaxXP());
+        for(uint64_t i = 0; i < iterations; ++i)
+        {
+            character.gainXP(i);
+        }
+        return iterations;
+    }
+
+    /*!
+    * @brief Run a scenario and measure it
+    */
+    BenchmarkResult runScenario(Scenario scenario, XPCurve curve, uint8_t level_max, uint64_t iterations)
+    {
+        BenchmarkCharacter character(curve, level_max);
+        scenario(character, iterations / 10 + 1); // Warm up
+
+        uint64_t allocations_start = ShadeEngine::MemoryProfiler::getTotalStatistics().allocation_count;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        uint64_t operations = scenario(character, iterations);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        uint64_t allocations = ShadeEngine::MemoryProfiler::getTotalStatistics().allocation_count - allocations_start;
+
+        if(character.m_level_changes == 0xFFFFFFFFFFFFFFFFull) // Never true, prevents the compiler from discarding progression
+        {
+            std::printf("\n");
+        }
+
+        BenchmarkResult result;
+        result.ns_per_op = std::chrono::duration<double, std::nano>(end - start).count() / operations;
+        result.allocations_per_op = static_cast<double>(allocations) / operations;
+        return result;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint64_t iterations = argc > 1 ? std::strtoull(argv[1], NULL, 10) : 100000;
+
+    const char* scenario_names[] = {"single_large_grant", "many_small_grants", "level_down_churn", "max_level_saturation"};
+    Scenario scenarios[] = {singleLargeGrant, manySmallGrants, levelDownChurn, maxLevelSaturation};
+    const char* curve_names[] = {"linear", "quadratic", "exponential"};
+    XPCurve curves[] = {LINEAR, QUADRATIC, EXPONENTIAL};
+    uint8_t levels_max[] = {10, 100, 200};
+
+    std::printf("%-22s %-12s %9s %12s %12s\n", "scenario", "curve", "level_max", "ns/op", "allocs/op");
+    for(unsigned int s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); ++s)
+    {
+        for(unsigned int c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c)
+        {
+            for(unsigned int l = 0; l < sizeof(levels_max) / sizeof(levels_max[0]); ++l)
+            {
+                BenchmarkResult result = runScenario(scenarios[s], curves[c], levels_max[l], iterations);
+                std::printf("%-22s %-12s %9u %12.2f %12.4f\n", scenario_names[s], curve_names[c], levels_max[l], result.ns_per_op, result.allocations_per_op);
+            }
+        }
+    }
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,39 @@
+#-------------------------------------------------
+#
+# End to end test of state replication over localhost
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = ReplicationLoopback
+TEMPLATE = app
+CONFIG += console release
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp \
+    ../../src/Network/BitStream.cpp \
+    ../../src/Network/ReplicationCodec.cpp \
+    ../../src/Network/ReplicationServer.cpp \
+    ../../src/Network/ReplicationClient.cpp \
+    ../../src/Graphics/SceneGraph.cpp \
+    ../../src/Characters/AbstractRPGCharacter.cpp
+
+HEADERS += \
+    ../../include/Network/ReplicationFormat.h \
+    ../../include/Network/BitStream.h \
+    ../../include/Network/ReplicationCodec.h \
+    ../../include/Network/ReplicationServer.h \
+    ../../include/Network/ReplicationClient.h \
+    ../../include/Graphics/SceneGraph.h \
+    ../../include/Characters/AbstractRPGCharacter.h \
+    ../../include/Characters/LevelEventChannel.h \
+    ../../include/Core/EventChannel.h
+
+LIBS += -lsfml-network -lsfml-graphics -lsfml-system
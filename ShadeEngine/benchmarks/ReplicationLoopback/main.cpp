@@ -0,0 +1,317 @@
+/*!
+ * @file main.cpp
+ * @brief End to end test of state replication over localhost.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Runs a ReplicationServer and a ReplicationClient on 127.0.0.1, with a relay between them dropping packets at random. <br>
+ * Entities move, appear and disappear for a while, the server restarts and the network goes down longer than REPLICATION_TIMEOUT. <br>
+ * Once entities stop changing, the state mirrored by the client must match the server state exactly, up to quantization. Reports bandwidth used and exits with 1 on mismatch.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <map>
+
+#include "include/Network/ReplicationClient.h"
+#include "include/Network/ReplicationServer.h"
+
+namespace
+{
+    const unsigned int FRAME_MS = 16; /*!< Duration of a simulated frame in milliseconds. */
+    const unsigned int MOVING_FRAMES = 300; /*!< Number of frames during which entities change. */
+    const unsigned int RESTART_FRAME = 100; /*!< Frame at which the server restarts. */
+    const unsigned int OUTAGE_FRAME = 200; /*!< Frame at which the network goes down. */
+    const float SETTLE_TIMEOUT = 10.f; /*!< Time in seconds left to the client to catch up once entities stop changing. */
+
+    /*! \class LossyRelay
+    * \brief Class forwarding packets between a client and a server, dropping some of them.
+    *
+    * Client connects to the relay instead of the server. The first address other than the server sending a packet is taken as the client.
+    *
+    */
+    class LossyRelay
+    {
+    public:
+        LossyRelay(unsigned short server_port, unsigned int loss_percent) : m_server_port(server_port), m_client_port(0), m_loss_percent(loss_percent), m_down(false)
+        {
+            m_socket.bind(sf::Socket::AnyPort);
+            m_socket.setBlocking(false);
+        }
+
+        unsigned short getPort() const
+        {
+            return m_socket.getLocalPort();
+        }
+
+        void setDown(bool down)
+        {
+            m_down = down;
+        }
+
+        void forward()
+        {
+            uint8_t buffer[ShadeEngine::REPLICATION_MAX_PACKET_SIZE];
+            std::size_t received = 0;
+            sf::IpAddress address;
+            unsigned short port = 0;
+            while(m_socket.receive(buffer, sizeof(buffer), received, address, port) == sf::Socket::Done)
+            {
+                if(m_down || static_cast<unsigned int>(std::rand() % 100) < m_loss_percent)
+                {
+                    continue;
+                }
+                if(port == m_server_port)
+                {
+                    if(m_client_port != 0)
+                    {
+                        m_socket.send(buffer, received, sf::IpAddress::LocalHost, m_client_port);
+                    }
+                }
+                else
+                {
+                    m_client_port = port;
+                    m_socket.send(buffer, received, sf::IpAddress::LocalHost, m_server_port);
+                }
+            }
+        }
+
+    protected:
+        sf::UdpSocket m_socket; /*!< Socket exchanging packets with both sides. */
+        unsigned short m_server_port; /*!< Port of the server. */
+        unsigned short m_client_port; /*!< Port of the client or 0 if unknown. */
+        unsigned int m_loss_percent; /*!< Probability of dropping a packet in percents. */
+        bool m_down; /*!< Whether all packets are dropped. */
+    };
+
+    /*!
+    * @brief Count entities whose mirrored state differs from the server state
+    */
+    unsigned int countMismatches(const std::map<uint32_t, ShadeEngine::ReplicatedEntity>& expected, const std::map<uint32_t, ShadeEngine::ReplicatedEntity>& mirrored)
+    {
+        unsigned int mismatches = 0;
+        for(std::map<uint32_t, ShadeEngine::ReplicatedEntity>::const_iterator it = expected.begin(); it != expected.end(); ++it)
+        {
+            std::map<uint32_t, ShadeEngine::ReplicatedEntity>::const_iterator mirrored_it = mirrored.find(it->first);
+            if(mirrored_it == mirrored.end() || ShadeEngine::ReplicationCodec::getChangedFields(ShadeEngine::ReplicationCodec::quantize(it->first, mirrored_it->second),
+                                                                                                ShadeEngine::ReplicationCodec::quantize(it->first, it->second)) != 0)
+            {
+                ++mismatches;
+            }
+        }
+        for(std::map<uint32_t, ShadeEngine::ReplicatedEntity>::const_iterator it = mirrored.begin(); it != mirrored.end(); ++it)
+        {
+            if(expected.find(it->first) == expected.end()) // Entity removed on server but still mirrored
+            {
+                ++mismatches;
+            }
+        }
+        return mismatches;
+    }
+
+    /*!
+    * @brief Create an entity at a random place
+    */
+    ShadeEngine::ReplicatedEntity createEntity()
+    {
+        ShadeEngine::ReplicatedEntity entity;
+        entity.position = sf::Vector2f(std::rand() % 4000 - 2000.f, std::rand() % 4000 - 2000.f);
+        entity.sprite = std::rand() % 64;
+        entity.layer = std::rand() % 4;
+        entity.level = 1 + std::rand() % 99;
+        entity.xp = std::rand();
+        return entity;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int entity_count = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 500;
+    unsigned int loss_percent = argc > 2 ? std::strtoul(argv[2], NULL, 10) : 30;
+    unsigned int bytes_per_second = argc > 3 ? std::strtoul(argv[3], NULL, 10) : 16384;
+    std::srand(1);
+
+    ShadeEngine::ReplicationServer server(bytes_per_second);
+    if(!server.start(0))
+    {
+        std::printf("Could not start server\n");
+        return 1;
+    }
+    unsigned short server_port = server.getPort();
+    LossyRelay relay(server_port, loss_percent);
+    ShadeEngine::ReplicationClient client;
+    if(!client.connect(sf::IpAddress::LocalHost, relay.getPort()))
+    {
+        std::printf("Could not start client\n");
+        return 1;
+    }
+
+    std::map<uint32_t, ShadeEngine::ReplicatedEntity> entities;
+    uint32_t next_id = 0;
+    for(unsigned int i = 0; i < entity_count; ++i)
+    {
+        entities[next_id] = createEntity();
+        server.setEntity(next_id, entities[next_id]);
+        ++next_id;
+    }
+
+    sf::Clock clock;
+    uint64_t sent_bytes = 0;
+    unsigned int frame = 0;
+    float settle_start = 0.f;
+    bool outage = false;
+    sf::Clock outage_clock;
+    while(true)
+    {
+        if(frame < MOVING_FRAMES)
+        {
+            // Move a few entities, replace one now and then
+            for(unsigned int i = 0; i < entity_count / 20 + 1; ++i)
+            {
+                std::map<uint32_t, ShadeEngine::ReplicatedEntity>::iterator it = entities.begin();
+                std::advance(it, std::rand() % entities.size());
+                it->second.position += sf::Vector2f(std::rand() % 9 - 4.f, std::rand() % 9 - 4.f);
+                it->second.rotation = std::rand() % 720 - 360.f;
+                it->second.xp += std::rand() % 100;
+                server.setEntity(it->first, it->second);
+            }
+            if(frame % 25 == 0)
+            {
+                server.removeEntity(entities.begin()->first);
+                entities.erase(entities.begin());
+                entities[next_id] = createEntity();
+                server.setEntity(next_id, entities[next_id]);
+                ++next_id;
+            }
+
+            if(frame == RESTART_FRAME) // Server forgets clients and history
+            {
+                sent_bytes += server.getSentBytes();
+                server.stop();
+                if(!server.start(server_port))
+                {
+                    std::printf("Could not restart server\n");
+                    return 1;
+                }
+            }
+        }
+
+        if(frame == OUTAGE_FRAME && !outage) // Frames are frozen during the outage
+        {
+            outage = true;
+            outage_clock.restart();
+            relay.setDown(true);
+        }
+        if(outage && outage_clock.getElapsedTime().asSeconds() > ShadeEngine::REPLICATION_TIMEOUT + 1.f)
+        {
+            outage = false;
+            relay.setDown(false);
+        }
+        if(!outage)
+        {
+            ++frame;
+            if(frame == MOVING_FRAMES)
+            {
+                settle_start = clock.getElapsedTime().asSeconds();
+            }
+        }
+
+        server.update();
+        relay.forward();
+        client.update();
+        relay.forward();
+        sf::sleep(sf::milliseconds(FRAME_MS));
+
+        if(frame >= MOVING_FRAMES)
+        {
+            unsigned int mismatches = countMismatches(entities, client.getEntities());
+            float elapsed = clock.getElapsedTime().asSeconds();
+            if(mismatches == 0 || elapsed - settle_start > SETTLE_TIMEOUT)
+            {
+                sent_bytes += server.getSentBytes();
+                std::printf("entities %zu, loss %u%%, mismatches %u, settled in %.2f s, sent %llu bytes over %.1f s (%.0f B/s), received %llu bytes\n",
+                            entities.size(), loss_percent, mismatches, elapsed - settle_start, static_cast<unsigned long long>(sent_bytes), elapsed,
+                            sent_bytes / elapsed, static_cast<unsigned long long>(client.getReceivedBytes()));
+                return mismatches == 0 ? 0 : 1;
+            }
+        }
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,214 @@
+/*!
+ * @file AbstractAudioDevice.h
+ * @brief Interface of the audio outputs driven by the audio mixer.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the interface used by AudioMixer to play sounds and music. <br>
+ * A device owns a fixed number of voices, each one able to play one sound buffer at a time, plus one streamed music.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef ABSTRACT_AUDIO_DEVICE_H
+#define ABSTRACT_AUDIO_DEVICE_H
+
+#include <string>
+#include <SFML/Audio.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class AbstractAudioDevice
+    * \brief Class defining interface of audio outputs.
+    *
+    * Definition of a class abstracting the audio backend so that the mixer can run without sound card. <br>
+    * Voices are identified by their index, between 0 and the voice count. Volumes range from 0 to 100. <br>
+    * Abstract class.
+    *
+    */
+    class AbstractAudioDevice
+    {
+    public:
+        /*!
+        * @brief Destructor of the AbstractAudioDevice class
+        *
+        * Virtual method. Does nothing.
+        *
+        */
+        virtual ~AbstractAudioDevice() = default;
+
+        /*!
+        * @brief Get number of voices
+        * @return Number of sounds that can be played at the same time
+        *
+        * Constant method. <br>
+        * Abstract method.
+        *
+        */
+        virtual unsigned int getVoiceCount() const = 0;
+
+        /*!
+        * @brief Play a sound on a voice
+        * @param voice : Index of the voice. Sound played by the voice is stopped.
+        * @param buffer : Samples to play. Must stay alive until voice is stopped.
+        * @param volume : Volume of the sound.
+        * @param pitch : Pitch of the sound. 1 plays samples at their rate.
+        *
+        * Abstract method.
+        *
+        */
+        virtual void playVoice(unsigned int voice, const sf::SoundBuffer& buffer, float volume, float pitch) = 0;
+
+        /*!
+        * @brief Stop a voice
+        * @param voice : Index of the voice.
+        *
+        * Voice no longer references its buffer afterwards. <br>
+        * Abstract method.
+        *
+        */
+        virtual void stopVoice(unsigned int voice) = 0;
+
+        /*!
+        * @brief Change volume of a voice
+        * @param voice : Index of the voice.
+        * @param volume : Volume of the sound.
+        *
+        * Abstract method.
+        *
+        */
+        virtual void setVoiceVolume(unsigned int voice, float volume) = 0;
+
+        /*!
+        * @brief Tell if a voice is playing
+        * @param voice : Index of the voice.
+        * @return True if voice has not reached the end of its sound
+        *
+        * Constant method. <br>
+        * Abstract method.
+        *
+        */
+        virtual bool isVoicePlaying(unsigned int voice) const = 0;
+
+        /*!
+        * @brief Stream a music file
+        * @param path : Path of the music file. Music played before is stopped.
+        * @param volume : Volume of the music.
+        * @param loop : True to restart music when it ends.
+        * @return False if file could not be opened
+        *
+        * Music is decoded progressively while playing instead of being loaded at once. <br>
+        * Abstract method.
+        *
+        */
+        virtual bool playMusic(const std::string& path, float volume, bool loop) = 0;
+
+        /*!
+        * @brief Stop music
+        *
+        * Abstract method.
+        *
+        */
+        virtual void stopMusic() = 0;
+
+        /*!
+        * @brief Change volume of music
+        * @param volume : Volume of the music.
+        *
+        * Abstract method.
+        *
+        */
+        virtual void setMusicVolume(float volume) = 0;
+
+        /*!
+        * @brief Tell if music is playing
+        * @return True if a music is playing
+        *
+        * Constant method. <br>
+        * Abstract method.
+        *
+        */
+        virtual bool isMusicPlaying() const = 0;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
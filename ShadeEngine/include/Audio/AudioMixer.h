@@ -0,0 +1,333 @@
+/*!
+ * @file AudioMixer.h
+ * @brief Class used to play sound effects and music.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of an audio manager playing sounds on a fixed pool of voices. <br>
+ * Sounds triggered during a frame are merged and started together on update. When all voices are busy, the least important sound is stopped to make room.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "AbstractAudioDevice.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class AudioMixer
+    * \brief Class allowing to play footsteps, jingles and music without allocating while the game runs.
+    *
+    * Definition of a class scheduling sounds on the voices of an audio device. <br>
+    * Sound buffers are loaded once and shared by all triggers of the same file. A buffer is kept alive by the voices playing it. <br>
+    * Not thread safe. Triggers and update must be called from the thread owning the mixer, typically once per frame.
+    *
+    */
+    class AudioMixer
+    {
+    public:
+        /*!
+        * @brief Constructor of the AudioMixer class
+        * @param device : Audio output. Use a NullAudioDevice to run without sound card.
+        *
+        */
+        AudioMixer(std::unique_ptr<AbstractAudioDevice> device);
+
+        /*!
+        * @brief Destructor of the AudioMixer class
+        *
+        * Stops all sounds and music.
+        *
+        */
+        ~AudioMixer();
+
+        AudioMixer(const AudioMixer&) = delete;
+        AudioMixer& operator=(const AudioMixer&) = delete;
+
+        /*!
+        * @brief Get a sound buffer loaded from a file
+        * @param path : Path of the sound file, used as key.
+        * @return Buffer or NULL if file could not be loaded
+        *
+        * The file is loaded the first time it is requested only. Load sounds when a scene starts to avoid loading during gameplay.
+        *
+        */
+        std::shared_ptr<const sf::SoundBuffer> getSoundBuffer(const std::string& path);
+
+        /*!
+        * @brief Release sound buffers used neither outside the mixer nor by a voice
+        *
+        * Call it after a scene change to free the sounds of the previous scene.
+        *
+        */
+        void releaseUnused();
+
+        /*!
+        * @brief Request a sound to be played
+        * @param buffer : Sound to play. Ignored if NULL.
+        * @param priority : Importance of the sound. A sound can only replace playing sounds of lower or equal priority. Default is 0.
+        * @param volume : Volume of the sound, from 0 to 100. Default is 100.
+        * @param pitch : Pitch of the sound. Default is 1.
+        *
+        * Sound starts on next update. Triggers of the same buffer within a frame are merged into one sound, keeping the highest priority and volume.
+        *
+        */
+        void trigger(const std::shared_ptr<const sf::SoundBuffer>& buffer, int priority = 0, float volume = 100.f, float pitch = 1.f);
+
+        /*!
+        * @brief Start sounds triggered since previous update
+        *
+        * Frees voices whose sound ended, then assigns voices to triggered sounds by decreasing priority. <br>
+        * When no voice is free, the sound with the lowest priority, the oldest one among equals, is stopped if its priority does not exceed the new one. Otherwise the new sound is dropped. <br>
+        * Sounds started by the same update are never stopped, so extra triggers of a busy frame are dropped.
+        *
+        */
+        void update();
+
+        /*!
+        * @brief Stop all sounds
+        *
+        * Pending triggers are discarded too. Music is not stopped.
+        *
+        */
+        void stopAllSounds();
+
+        /*!
+        * @brief Stream a music file
+        * @param path : Path of the music file. Music played before is stopped.
+        * @param loop : True to restart music when it ends. Default is true.
+        * @return False if file could not be opened
+        *
+        * Music is decoded on a background thread while it plays.
+        *
+        */
+        bool playMusic(const std::string& path, bool loop = true);
+
+        /*!
+        * @brief Stop music
+        *
+        */
+        void stopMusic();
+
+        /*!
+        * @brief Set volume of sounds
+        * @param volume : Volume multiplying volume of each sound, from 0 to 100.
+        *
+        * Applied to playing sounds too.
+        *
+        */
+        void setSoundVolume(float volume);
+
+        /*!
+        * @brief Get volume of sounds
+        * @return Volume of sounds
+        *
+        * Constant method.
+        *
+        */
+        float getSoundVolume() const;
+
+        /*!
+        * @brief Set volume of music
+        * @param volume : Volume of music, from 0 to 100.
+        *
+        */
+        void setMusicVolume(float volume);
+
+        /*!
+        * @brief Get volume of music
+        * @return Volume of music
+        *
+        * Constant method.
+        *
+        */
+        float getMusicVolume() const;
+
+        /*!
+        * @brief Get the audio output
+        * @return Device voices and music are played on
+        *
+        * Allows to advance time of a NullAudioDevice.
+        *
+        */
+        AbstractAudioDevice& getDevice();
+
+        /*!
+        * @brief Get number of voices playing a sound
+        * @return Number of busy voices as of last update
+        *
+        * Constant method.
+        *
+        */
+        unsigned int getActiveVoiceCount() const;
+
+        /*!
+        * @brief Get number of sounds stopped to make room for more important ones
+        * @return Number of stolen voices since creation
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getStolenCount() const;
+
+        /*!
+        * @brief Get number of sounds not played because all voices were busy with more important sounds
+        * @return Number of dropped sounds since creation
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getDroppedCount() const;
+
+        /*!
+        * @brief Get number of triggers merged with another trigger of the same frame
+        * @return Number of merged triggers since creation
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getMergedCount() const;
+
+    protected:
+        /*!
+        * @brief Sound requested during current frame
+        */
+        struct Trigger
+        {
+            std::shared_ptr<const sf::SoundBuffer> buffer; /*!< Sound to play. */
+            int priority; /*!< Importance of the sound. */
+            float volume; /*!< Volume of the sound. */
+            float pitch; /*!< Pitch of the sound. */
+        };
+
+        /*!
+        * @brief Voice of the audio device
+        */
+        struct Voice
+        {
+            std::shared_ptr<const sf::SoundBuffer> buffer; /*!< Sound played, keeping buffer alive, or NULL if voice is free. */
+            int priority; /*!< Importance of the sound. */
+            float volume; /*!< Volume of the sound before applying sound volume. */
+            uint64_t start_order; /*!< Number of sounds started before this one. Smaller is older. */
+        };
+
+        std::unique_ptr<AbstractAudioDevice> m_device; /*!< Audio output. */
+        std::map< std::string, std::shared_ptr<const sf::SoundBuffer> > m_buffers; /*!< Loaded sound buffers indexed by path. */
+        std::vector<Trigger> m_triggers; /*!< Sounds requested since previous update. Keeps its capacity between frames. */
+        std::vector<Voice> m_voices; /*!< State of device voices. */
+        float m_sound_volume; /*!< Volume of sounds. */
+        float m_music_volume; /*!< Volume of music. */
+        unsigned int m_active_voice_count; /*!< Number of busy voices. */
+        uint64_t m_start_count; /*!< Number of sounds started. */
+        uint64_t m_stolen_count; /*!< Number of stolen voices. */
+        uint64_t m_dropped_count; /*!< Number of dropped sounds. */
+        uint64_t m_merged_count; /*!< Number of merged triggers. */
+
+        /*!
+        * @brief Find voice to play a sound on
+        * @param priority : Priority of the sound.
+        * @param first_new_start : Start order of the first sound started by current update. Voices started from it on cannot be stolen.
+        * @return Index of a free voice, else of the voice to steal, else voice count if sound must be dropped
+        *
+        * Constant method.
+        *
+        */
+        unsigned int findVoice(int priority, uint64_t first_new_start) const;
+
+        /*!
+        * @brief Stop a voice and release its buffer
+        * @param voice : Index of the voice.
+        *
+        */
+        void releaseVoice(unsigned int voice);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
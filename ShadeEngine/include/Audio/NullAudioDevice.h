@@ -0,0 +1,267 @@
+/*!
+ * @file NullAudioDevice.h
+ * @brief Audio output producing no sound.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of an audio device simulating voices. <br>
+ * Allows to run the mixer on machines without sound card, such as build servers, and to check which sounds would have been played.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef NULL_AUDIO_DEVICE_H
+#define NULL_AUDIO_DEVICE_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "AbstractAudioDevice.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class NullAudioDevice
+    * \brief Class simulating voices without playing them.
+    *
+    * Definition of an audio device keeping track of voice states only. <br>
+    * Time does not flow by itself: a sound keeps playing until advance has been called for its whole duration. Music plays until stopped.
+    *
+    */
+    class NullAudioDevice : public AbstractAudioDevice
+    {
+    public:
+        /*!
+        * @brief Constructor of the NullAudioDevice class
+        * @param voice_count : Number of sounds that can be played at the same time. Default is 32.
+        *
+        */
+        NullAudioDevice(unsigned int voice_count = 32);
+
+        /*!
+        * @brief Get number of voices
+        * @return Number of sounds that can be played at the same time
+        *
+        * Constant method. <br>
+        * Virtual method.
+        *
+        */
+        virtual unsigned int getVoiceCount() const;
+
+        /*!
+        * @brief Play a sound on a voice
+        * @param voice : Index of the voice. Sound played by the voice is stopped.
+        * @param buffer : Samples to play. Must stay alive until voice is stopped.
+        * @param volume : Volume of the sound.
+        * @param pitch : Pitch of the sound. 1 plays samples at their rate.
+        *
+        * Voice plays for the duration of the buffer divided by pitch. <br>
+        * Virtual method.
+        *
+        */
+        virtual void playVoice(unsigned int voice, const sf::SoundBuffer& buffer, float volume, float pitch);
+
+        /*!
+        * @brief Stop a voice
+        * @param voice : Index of the voice.
+        *
+        * Virtual method.
+        *
+        */
+        virtual void stopVoice(unsigned int voice);
+
+        /*!
+        * @brief Change volume of a voice
+        * @param voice : Index of the voice.
+        * @param volume : Volume of the sound.
+        *
+        * Virtual method.
+        *
+        */
+        virtual void setVoiceVolume(unsigned int voice, float volume);
+
+        /*!
+        * @brief Tell if a voice is playing
+        * @param voice : Index of the voice.
+        * @return True if voice has not reached the end of its sound
+        *
+        * Constant method. <br>
+        * Virtual method.
+        *
+        */
+        virtual bool isVoicePlaying(unsigned int voice) const;
+
+        /*!
+        * @brief Stream a music file
+        * @param path : Path of the music file. Music played before is stopped.
+        * @param volume : Volume of the music.
+        * @param loop : True to restart music when it ends.
+        * @return False if file could not be opened
+        *
+        * File is not opened, so it always succeeds. <br>
+        * Virtual method.
+        *
+        */
+        virtual bool playMusic(const std::string& path, float volume, bool loop);
+
+        /*!
+        * @brief Stop music
+        *
+        * Virtual method.
+        *
+        */
+        virtual void stopMusic();
+
+        /*!
+        * @brief Change volume of music
+        * @param volume : Volume of the music.
+        *
+        * Virtual method.
+        *
+        */
+        virtual void setMusicVolume(float volume);
+
+        /*!
+        * @brief Tell if music is playing
+        * @return True if a music is playing
+        *
+        * Constant method. <br>
+        * Virtual method.
+        *
+        */
+        virtual bool isMusicPlaying() const;
+
+        /*!
+        * @brief Simulate the passing of time
+        * @param elapsed : Time elapsed since previous call.
+        *
+        * Voices whose sound ends during elapsed time stop playing.
+        *
+        */
+        void advance(sf::Time elapsed);
+
+        /*!
+        * @brief Get buffer played by a voice
+        * @param voice : Index of the voice.
+        * @return Buffer or NULL if voice is not playing
+        *
+        * Constant method.
+        *
+        */
+        const sf::SoundBuffer* getVoiceBuffer(unsigned int voice) const;
+
+        /*!
+        * @brief Get volume of a voice
+        * @param voice : Index of the voice.
+        * @return Volume of the voice
+        *
+        * Constant method.
+        *
+        */
+        float getVoiceVolume(unsigned int voice) const;
+
+        /*!
+        * @brief Get number of sounds played since creation
+        * @return Number of calls to playVoice
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getPlayCount() const;
+
+    protected:
+        /*!
+        * @brief Simulated voice
+        */
+        struct Voice
+        {
+            const sf::SoundBuffer* buffer; /*!< Buffer played or NULL if voice is stopped. */
+            float volume; /*!< Volume of the voice. */
+            float remaining; /*!< Time left before the end of the sound in seconds. */
+        };
+
+        std::vector<Voice> m_voices; /*!< Simulated voices. */
+        bool m_music_playing; /*!< Whether a music is playing. */
+        uint64_t m_play_count; /*!< Number of sounds played. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
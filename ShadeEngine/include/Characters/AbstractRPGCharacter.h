@@ -72,6 +72,8 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #include <stdint.h>
 #include <QObject>
 
+#include "LevelEventChannel.h"
+
 /*!
 * @namespace ShadeEngine
 * @brief A namespace used to regroup all classes associated with ShadeEngine library
@@ -104,6 +106,77 @@ namespace ShadeEngine
         */
         virtual ~AbstractRPGCharacter() = default;
 
+        /*!
+        * @brief Get current level
+        * @return Current level of character (between 1 and level max)
+        *
+        * Constant method.
+        *
+        */
+        uint8_t getLevel() const;
+
+        /*!
+        * @brief Get maximal level
+        * @return Maximal level of character
+        *
+        * Constant method.
+        *
+        */
+        uint8_t getLevelMax() const;
+
+        /*!
+        * @brief Get current accumulated experience points
+        * @return Current XP of character
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getXP() const;
+
+        /*!
+        * @brief Indicate if character can loose XP and level down
+        * @return True if character can level down
+        *
+        * Constant method.
+        *
+        */
+        bool canLevelDown() const;
+
+        /*!
+        * @brief Restore a previously saved progression state
+        * @param level : Level to restore. Clamped between 1 and level max.
+        * @param xp : Accumulated experience points to restore.
+        * @return False if xp cannot be reached at this level, state is then left unchanged
+        *
+        * Directly overwrites level and XP without replaying XP gains or losses. onLevelUp and onLevelDown are not called. <br>
+        * XP must not exceed XP of level max nor reach XP of next level. It must be at least XP of the level, or XP of previous level for characters able to level down. <br>
+        * Used to deserialize characters (see XPLedger).
+        *
+        */
+        bool restoreState(uint8_t level, uint64_t xp);
+
+        /*!
+        * @brief Set channel on which level changes are published
+        * @param channel : Channel receiving level events. NULL disables publication. Not owned by the character.
+        *
+        * After each XP gain or loss changing character level, a single event going from the previous level to the new one is published, whatever the number of levels crossed. <br>
+        * Several characters may share the same channel.
+        *
+        */
+        void setLevelEventChannel(LevelEventChannel* channel);
+
+        /*!
+        * @brief Apply an XP change with the base progression rules
+        * @param xp : XP gained or lost.
+        * @param is_loss : True if XP is lost.
+        * @param notify : True to call onLevelUp and onLevelDown and publish level events.
+        *
+        * Follows the rules of AbstractRPGCharacter::gainXP and AbstractRPGCharacter::loseXP, ignoring any redefinition of them. <br>
+        * Used by XPLedger so that recorded and replayed XP changes lead to the same levels.
+        *
+        */
+        void applyXP(uint64_t xp, bool is_loss, bool notify);
+
     public slots:
         /*!
         * @brief Gain experience points if not at level max and level up if enough XP has been gathered.
@@ -132,6 +205,32 @@ namespace ShadeEngine
         uint8_t m_level_max; /*!< Maximal character level. */
         bool m_can_level_down; /*!< Can character loose XP and level down ? */
         uint64_t m_xp; /*!< Current accumulated experience points. */
+        LevelEventChannel* m_level_event_channel; /*!< Channel on which level changes are published. May be NULL. */
+
+        /*!
+        * @brief Publish a level change on the level event channel
+        * @param from_level : Level before XP change.
+        *
+        * Does nothing if level did not change or if no channel is set.
+        *
+        */
+        void publishLevelChange(uint8_t from_level);
+
+        /*!
+        * @brief Add XP and level up accordingly
+        * @param xp_gained : XP gained.
+        * @param notify : True to call onLevelUp and publish level change.
+        *
+        */
+        void applyXPGain(uint64_t xp_gained, bool notify);
+
+        /*!
+        * @brief Remove XP and level down accordingly
+        * @param xp_lost : XP lost.
+        * @param notify : True to call onLevelDown and publish level change.
+        *
+        */
+        void applyXPLoss(uint64_t xp_lost, bool notify);
 
         /*!
         * @brief User specific level up actions
@@ -0,0 +1,281 @@
+/*!
+ * @file XPLedger.h
+ * @brief Class used to persist and replay RPG characters progression.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of an event-sourced experience ledger. <br>
+ * Every XP gain or loss is appended to a log file as a pair of varints. Periodically, the state of all registered characters is written as a compact binary snapshot. <br>
+ * Loading maps the latest snapshot in memory, restores characters directly from it and only replays the part of the log written after the snapshot.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef XP_LEDGER_H
+#define XP_LEDGER_H
+
+#include <stdint.h>
+#include <vector>
+#include <QFile>
+#include <QString>
+
+#include "AbstractRPGCharacter.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class XPLedger
+    * \brief Class allowing to log, snapshot and restore characters experience.
+    *
+    * Definition of a class used to record RPG-like characters XP events in an append-only log and to restore them from binary snapshots. <br>
+    * Characters are identified by an integer id. Ids are used as indexes so they should be kept dense (0, 1, 2...). <br>
+    * Recorded and replayed events both use the base progression rules of AbstractRPGCharacter. Redefinitions of gainXP and loseXP are not called by the ledger.
+    *
+    */
+    class XPLedger
+    {
+    public:
+        /*!
+        * @brief Constructor of the XPLedger class
+        * @param log_path : Path of the append-only XP event log.
+        * @param snapshot_path : Path of the characters snapshot file.
+        *
+        * Constructor of the XPLedger class. Files are only opened when needed.
+        *
+        */
+        XPLedger(const QString& log_path, const QString& snapshot_path);
+
+        /*!
+        * @brief Destructor of the XPLedger class
+        *
+        * Flushes pending events to the log.
+        *
+        */
+        ~XPLedger();
+
+        /*!
+        * @brief Register a character in the ledger
+        * @param id : Identifier of the character in log and snapshots.
+        * @param character : Character associated with the id. Not owned by the ledger.
+        *
+        */
+        void registerCharacter(uint32_t id, AbstractRPGCharacter* character);
+
+        /*!
+        * @brief Remove a character from the ledger
+        * @param id : Identifier of the character.
+        *
+        */
+        void unregisterCharacter(uint32_t id);
+
+        /*!
+        * @brief Make a character gain XP and log the event
+        * @param id : Identifier of the character.
+        * @param xp : XP gained.
+        *
+        * Event is only buffered. It is written to the log on the next flush. Ignored if id is not registered.
+        *
+        */
+        void recordXPGain(uint32_t id, uint64_t xp);
+
+        /*!
+        * @brief Make a character lose XP and log the event
+        * @param id : Identifier of the character.
+        * @param xp : XP lost.
+        *
+        * Event is only buffered. It is written to the log on the next flush. Ignored if id is not registered.
+        *
+        */
+        void recordXPLoss(uint32_t id, uint64_t xp);
+
+        /*!
+        * @brief Append buffered events to the log file
+        * @return True if all events have been written
+        *
+        */
+        bool flush();
+
+        /*!
+        * @brief Write a snapshot of all registered characters
+        * @return True if snapshot has been written
+        *
+        * Flushes the log first so that the snapshot can record the log position it is consistent with. <br>
+        * The snapshot file is replaced atomically.
+        *
+        */
+        bool writeSnapshot();
+
+        /*!
+        * @brief Restore registered characters from snapshot and log
+        * @return True if characters have been restored, false if a file cannot be read or a snapshot record has XP inconsistent with its level
+        *
+        * Maps the snapshot file, restores levels and XP of registered characters, then replays events logged after the snapshot. <br>
+        * A missing snapshot is treated as an empty one, the whole log is then replayed. A truncated trailing event in the log is ignored. <br>
+        * Level hooks are not called and level events are not published while loading.
+        *
+        */
+        bool load();
+
+    protected:
+        /*!
+        * @brief Header of snapshot files
+        */
+        struct SnapshotHeader
+        {
+            uint32_t magic; /*!< Magic number identifying snapshot files. */
+            uint16_t version; /*!< Format version. */
+            uint16_t record_size; /*!< Size of a character record in bytes. */
+            uint64_t record_count; /*!< Number of character records following the header. */
+            uint64_t log_offset; /*!< Size of the log when snapshot was written. */
+        };
+
+        /*!
+        * @brief Character record of snapshot files
+        */
+        struct SnapshotRecord
+        {
+            uint32_t id; /*!< Character identifier. */
+            uint8_t level; /*!< Character level. */
+            uint8_t padding[3]; /*!< Unused. Keeps XP aligned. */
+            uint64_t xp; /*!< Character XP. */
+        };
+
+        QString m_log_path; /*!< Path of the XP event log. */
+        QString m_snapshot_path; /*!< Path of the snapshot file. */
+        QFile m_log_file; /*!< XP event log opened in append mode. */
+        std::vector<AbstractRPGCharacter*> m_characters; /*!< Registered characters indexed by id. */
+        std::vector<uint8_t> m_pending_events; /*!< Encoded events not yet written to the log. */
+
+        /*!
+        * @brief Encode an event and apply it to the character
+        * @param id : Identifier of the character.
+        * @param xp : Amount of XP.
+        * @param is_loss : True for an XP loss, false for an XP gain.
+        *
+        */
+        void record(uint32_t id, uint64_t xp, bool is_loss);
+
+        /*!
+        * @brief Replay encoded events
+        * @param data : Encoded events.
+        * @param size : Size of encoded events in bytes.
+        *
+        * Events are applied directly to characters through AbstractRPGCharacter::applyXP, without notification and without being logged again.
+        *
+        */
+        void replay(const uint8_t* data, uint64_t size);
+
+        /*!
+        * @brief Get registered character associated with id
+        * @param id : Identifier of the character.
+        * @return Character or NULL if id is not registered
+        *
+        * Constant method.
+        *
+        */
+        AbstractRPGCharacter* getCharacter(uint32_t id) const;
+
+        /*!
+        * @brief Append a value to a buffer using LEB128 varint encoding
+        * @param buffer : Buffer to append to.
+        * @param value : Value to encode.
+        *
+        * Static method.
+        *
+        */
+        static void writeVarint(std::vector<uint8_t>& buffer, uint64_t value);
+
+        /*!
+        * @brief Decode a LEB128 varint
+        * @param data : Pointer on current position, advanced past the varint.
+        * @param end : End of encoded data.
+        * @param value : Decoded value.
+        * @return False if data ends before the varint does
+        *
+        * Static method.
+        *
+        */
+        static bool readVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
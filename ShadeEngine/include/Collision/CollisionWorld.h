@@ -0,0 +1,409 @@
+/*!
+ * @file CollisionWorld.h
+ * @brief Class used to detect collisions between sprites and characters.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a collision world made of box and circle colliders. <br>
+ * A uniform grid broad phase finds colliders sharing cells, then a narrow phase tests their exact shapes. <br>
+ * Collider data is stored as contiguous arrays and only colliders that move are reinserted in the grid.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef COLLISION_WORLD_H
+#define COLLISION_WORLD_H
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    typedef uint32_t ColliderId; /*!< Identifier of a collider. Identifiers of destroyed colliders are reused. */
+
+    /*!
+    * @brief Shapes of colliders
+    */
+    enum ColliderShape
+    {
+        COLLIDER_BOX, /*!< Axis aligned rectangle. */
+        COLLIDER_CIRCLE /*!< Circle. */
+    };
+
+    /*!
+    * @brief Pair of colliding colliders
+    */
+    struct CollisionPair
+    {
+        ColliderId first; /*!< Collider with the lowest identifier. */
+        ColliderId second; /*!< Collider with the highest identifier. */
+    };
+
+    /*! \class CollisionWorld
+    * \brief Class allowing to find overlapping colliders.
+    *
+    * Definition of a class storing colliders in a uniform grid of square cells. <br>
+    * Cell size should be close to the size of common colliders: large colliders span many cells, while many small colliders in a cell are tested pairwise. <br>
+    * Colliders only test each other if their masks share at least one bit. Not thread safe.
+    *
+    */
+    class CollisionWorld
+    {
+    public:
+        static const ColliderId INVALID_COLLIDER; /*!< Identifier never associated with a collider. */
+        static const uint32_t ALL_MASKS; /*!< Mask colliding with every collider. */
+
+        /*!
+        * @brief Constructor of the CollisionWorld class
+        * @param cell_size : Size of grid cells in world units. Default is 64.
+        *
+        * Creates an empty world.
+        *
+        */
+        CollisionWorld(float cell_size = 64.f);
+
+        /*!
+        * @brief Create a box collider
+        * @param box : Rectangle covered by the collider.
+        * @param mask : Collision mask of the collider. Default is ALL_MASKS.
+        * @return Identifier of the collider
+        *
+        */
+        ColliderId createBox(const sf::FloatRect& box, uint32_t mask = ALL_MASKS);
+
+        /*!
+        * @brief Create a circle collider
+        * @param center : Center of the circle.
+        * @param radius : Radius of the circle.
+        * @param mask : Collision mask of the collider. Default is ALL_MASKS.
+        * @return Identifier of the collider
+        *
+        */
+        ColliderId createCircle(const sf::Vector2f& center, float radius, uint32_t mask = ALL_MASKS);
+
+        /*!
+        * @brief Destroy a collider
+        * @param collider : Identifier of the collider. Ignored if invalid.
+        *
+        */
+        void destroyCollider(ColliderId collider);
+
+        /*!
+        * @brief Tell if an identifier is associated with a collider
+        * @param collider : Identifier to check.
+        * @return True if collider exists
+        *
+        * Constant method.
+        *
+        */
+        bool isValid(ColliderId collider) const;
+
+        /*!
+        * @brief Turn a collider into a box
+        * @param collider : Identifier of the collider.
+        * @param box : Rectangle covered by the collider.
+        *
+        * Grid cells are only updated if the collider covers other cells than before.
+        *
+        */
+        void setBox(ColliderId collider, const sf::FloatRect& box);
+
+        /*!
+        * @brief Turn a collider into a circle
+        * @param collider : Identifier of the collider.
+        * @param center : Center of the circle.
+        * @param radius : Radius of the circle.
+        *
+        * Grid cells are only updated if the collider covers other cells than before.
+        *
+        */
+        void setCircle(ColliderId collider, const sf::Vector2f& center, float radius);
+
+        /*!
+        * @brief Move a collider
+        * @param collider : Identifier of the collider.
+        * @param offset : Translation applied to the collider.
+        *
+        * Grid cells are only updated if the collider covers other cells than before.
+        *
+        */
+        void move(ColliderId collider, const sf::Vector2f& offset);
+
+        /*!
+        * @brief Set the collision mask of a collider
+        * @param collider : Identifier of the collider.
+        * @param mask : Collision mask. Colliders only collide with colliders whose mask shares a bit.
+        *
+        */
+        void setMask(ColliderId collider, uint32_t mask);
+
+        /*!
+        * @brief Get the collision mask of a collider
+        * @param collider : Identifier of the collider.
+        * @return Collision mask of the collider
+        *
+        * Constant method.
+        *
+        */
+        uint32_t getMask(ColliderId collider) const;
+
+        /*!
+        * @brief Get the shape of a collider
+        * @param collider : Identifier of the collider.
+        * @return Shape of the collider
+        *
+        * Constant method.
+        *
+        */
+        ColliderShape getShape(ColliderId collider) const;
+
+        /*!
+        * @brief Get the bounding box of a collider
+        * @param collider : Identifier of the collider.
+        * @return Axis aligned bounding box of the collider
+        *
+        * Constant method.
+        *
+        */
+        sf::FloatRect getBounds(ColliderId collider) const;
+
+        /*!
+        * @brief Get number of colliders
+        * @return Number of existing colliders
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getColliderCount() const;
+
+        /*!
+        * @brief Find all pairs of colliding colliders
+        * @param pairs : Receives colliding pairs. Cleared first, its capacity is reused.
+        *
+        * Each pair is reported once even if colliders share several cells. <br>
+        * Constant method.
+        *
+        */
+        void findPairs(std::vector<CollisionPair>& pairs) const;
+
+        /*!
+        * @brief Find colliders overlapping a rectangle
+        * @param area : Rectangle to test.
+        * @param colliders : Receives overlapping colliders. Cleared first, its capacity is reused.
+        * @param mask : Only colliders whose mask shares a bit with this mask are reported. Default is ALL_MASKS.
+        *
+        * Constant method.
+        *
+        */
+        void queryArea(const sf::FloatRect& area, std::vector<ColliderId>& colliders, uint32_t mask = ALL_MASKS) const;
+
+        /*!
+        * @brief Find colliders containing a point
+        * @param point : Point to test.
+        * @param colliders : Receives colliders containing the point. Cleared first, its capacity is reused.
+        * @param mask : Only colliders whose mask shares a bit with this mask are reported. Default is ALL_MASKS.
+        *
+        * Constant method.
+        *
+        */
+        void queryPoint(const sf::Vector2f& point, std::vector<ColliderId>& colliders, uint32_t mask = ALL_MASKS) const;
+
+        /*!
+        * @brief Release memory of grid cells left empty
+        *
+        * Empty cells are kept so that colliders moving back and forth do not allocate. Call it when colliders left a region of the world for good.
+        *
+        */
+        void releaseEmptyCells();
+
+    protected:
+        /*!
+        * @brief Range of grid cells covered by a collider
+        */
+        struct CellRange
+        {
+            int32_t min_x; /*!< First column. */
+            int32_t min_y; /*!< First row. */
+            int32_t max_x; /*!< Last column. */
+            int32_t max_y; /*!< Last row. */
+        };
+
+        float m_cell_size; /*!< Size of grid cells. */
+        float m_inverse_cell_size; /*!< Inverse of cell size, so that cell lookups multiply. */
+        std::vector<float> m_min_x; /*!< Left of the bounding box of each collider. */
+        std::vector<float> m_min_y; /*!< Top of the bounding box of each collider. */
+        std::vector<float> m_max_x; /*!< Right of the bounding box of each collider. */
+        std::vector<float> m_max_y; /*!< Bottom of the bounding box of each collider. */
+        std::vector<float> m_radiuses; /*!< Radius of each circle collider. */
+        std::vector<uint8_t> m_shapes; /*!< Shape of each collider. */
+        std::vector<uint8_t> m_alive; /*!< Flags indicating identifiers associated with a collider. */
+        std::vector<uint32_t> m_masks; /*!< Collision mask of each collider. */
+        std::vector<CellRange> m_cell_ranges; /*!< Cells each collider is inserted in. */
+        std::vector<ColliderId> m_free_ids; /*!< Identifiers available for reuse. */
+        std::size_t m_collider_count; /*!< Number of existing colliders. */
+        std::unordered_map< uint64_t, std::vector<ColliderId> > m_cells; /*!< Colliders of each grid cell, indexed by packed cell coordinates. */
+
+        /*!
+        * @brief Create a collider
+        * @param shape : Shape of the collider.
+        * @param mask : Collision mask of the collider.
+        * @return Identifier of the collider
+        *
+        * Bounds must be set and collider inserted into the grid by the caller.
+        *
+        */
+        ColliderId createCollider(ColliderShape shape, uint32_t mask);
+
+        /*!
+        * @brief Update grid cells of a collider after its bounds changed
+        * @param collider : Identifier of the collider.
+        *
+        */
+        void updateCells(ColliderId collider);
+
+        /*!
+        * @brief Insert a collider in a range of cells
+        * @param collider : Identifier of the collider.
+        * @param range : Cells to insert in.
+        *
+        */
+        void insertInCells(ColliderId collider, const CellRange& range);
+
+        /*!
+        * @brief Remove a collider from a range of cells
+        * @param collider : Identifier of the collider.
+        * @param range : Cells to remove from.
+        *
+        */
+        void removeFromCells(ColliderId collider, const CellRange& range);
+
+        /*!
+        * @brief Compute cells covered by a rectangle
+        * @param min_x : Left of the rectangle.
+        * @param min_y : Top of the rectangle.
+        * @param max_x : Right of the rectangle.
+        * @param max_y : Bottom of the rectangle.
+        * @return Covered cells
+        *
+        * Constant method.
+        *
+        */
+        CellRange computeCellRange(float min_x, float min_y, float max_x, float max_y) const;
+
+        /*!
+        * @brief Get the column or row of a coordinate
+        * @param coordinate : World coordinate.
+        * @return Cell column or row
+        *
+        * Constant method.
+        *
+        */
+        int32_t getCellCoordinate(float coordinate) const;
+
+        /*!
+        * @brief Test the exact shapes of two colliders
+        * @param first : First collider.
+        * @param second : Second collider.
+        * @return True if colliders overlap
+        *
+        * Bounding boxes must already overlap. <br>
+        * Constant method.
+        *
+        */
+        bool testShapes(ColliderId first, ColliderId second) const;
+
+        /*!
+        * @brief Pack cell coordinates into a key
+        * @param x : Cell column.
+        * @param y : Cell row.
+        * @return Key of the cell
+        *
+        * Static method.
+        *
+        */
+        static uint64_t getCellKey(int32_t x, int32_t y);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,206 @@
+/*!
+ * @file ArenaAllocator.h
+ * @brief Class used to store STL containers in a frame arena.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of an STL compatible allocator taking its memory from a FrameArena. <br>
+ * Containers using it must not outlive the arena reset, typically the end of the frame.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef ARENA_ALLOCATOR_H
+#define ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <vector>
+
+#include "FrameArena.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class ArenaAllocator
+    * \brief Class allowing STL containers to allocate from a frame arena.
+    *
+    * Definition of a stateful allocator referencing a FrameArena. Deallocation does nothing, memory is reclaimed when the arena is reset. <br>
+    * Growing a container leaves its previous storage unused in the arena, so containers should be reserved to their final size when it is known.
+    *
+    */
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+        typedef T value_type; /*!< Type of allocated elements. */
+
+        /*!
+        * @brief Allocator rebound to another element type
+        */
+        template<typename U>
+        struct rebind
+        {
+            typedef ArenaAllocator<U> other; /*!< Allocator of U elements using the same arena. */
+        };
+
+        /*!
+        * @brief Constructor of the ArenaAllocator class
+        * @param arena : Arena memory is taken from.
+        *
+        */
+        explicit ArenaAllocator(FrameArena& arena) : m_arena(&arena)
+        {
+        }
+
+        /*!
+        * @brief Copy constructor from an allocator of another type
+        * @param other : Allocator whose arena is used.
+        *
+        */
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.getArena())
+        {
+        }
+
+        /*!
+        * @brief Allocate storage for elements
+        * @param count : Number of elements.
+        * @return Pointer on storage
+        *
+        */
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        /*!
+        * @brief Release storage of elements
+        *
+        * Does nothing. Storage is released when the arena is reset.
+        *
+        */
+        void deallocate(T*, std::size_t)
+        {
+        }
+
+        /*!
+        * @brief Get arena memory is taken from
+        * @return Arena of the allocator
+        *
+        * Constant method.
+        *
+        */
+        FrameArena* getArena() const
+        {
+            return m_arena;
+        }
+
+    protected:
+        FrameArena* m_arena; /*!< Arena memory is taken from. */
+    };
+
+    /*!
+    * @brief Tell if two allocators share their arena
+    */
+    template<typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+    {
+        return a.getArena() == b.getArena();
+    }
+
+    /*!
+    * @brief Tell if two allocators use different arenas
+    */
+    template<typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+    {
+        return a.getArena() != b.getArena();
+    }
+
+    /*!
+    * @brief Vector whose storage lives in a frame arena
+    */
+    template<typename T>
+    using FrameVector = std::vector< T, ArenaAllocator<T> >;
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
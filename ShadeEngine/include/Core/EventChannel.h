@@ -0,0 +1,294 @@
+/*!
+ * @file EventChannel.h
+ * @brief Class used to broadcast typed events between threads.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a bounded lock-free multi-producer multi-consumer event channel. <br>
+ * Every subscribed consumer receives every published event. Consumers drain events in batches from their own thread without any lock. <br>
+ * Template class.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef EVENT_CHANNEL_H
+#define EVENT_CHANNEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class EventChannel
+    * \brief Class allowing to broadcast events to several consumers without locks nor allocations.
+    *
+    * Definition of a ring buffer of events shared by producers and consumers. <br>
+    * Producers claim slots with an atomic cursor. An event is dropped rather than overwriting a slot not yet read by every consumer, so producers never block. <br>
+    * Each consumer owns a read cursor and must only be drained from one thread at a time. <br>
+    * Template class. Event should be cheap to copy. Capacity must be a power of 2.
+    *
+    */
+    template<typename Event, std::size_t Capacity = 1024, std::size_t MaxConsumers = 8>
+    class EventChannel
+    {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "EventChannel capacity must be a power of 2");
+
+    public:
+        /*!
+        * @brief Constructor of the EventChannel class
+        *
+        * Creates a channel without any consumer.
+        *
+        */
+        EventChannel() : m_claim_cursor(0), m_dropped_count(0)
+        {
+            for(std::size_t i = 0; i < Capacity; ++i)
+            {
+                m_slots[i].sequence.store(0, std::memory_order_relaxed);
+            }
+            for(std::size_t i = 0; i < MaxConsumers; ++i)
+            {
+                m_consumer_cursors[i].value.store(UNUSED_CURSOR, std::memory_order_relaxed);
+            }
+        }
+
+        EventChannel(const EventChannel&) = delete;
+        EventChannel& operator=(const EventChannel&) = delete;
+
+        /*!
+        * @brief Subscribe a new consumer
+        * @return Identifier of the consumer or -1 if MaxConsumers is reached
+        *
+        * The consumer only receives events published after subscription.
+        *
+        */
+        int subscribe()
+        {
+            for(std::size_t i = 0; i < MaxConsumers; ++i)
+            {
+                uint64_t expected = UNUSED_CURSOR;
+                if(m_consumer_cursors[i].value.compare_exchange_strong(expected, m_claim_cursor.load(std::memory_order_acquire), std::memory_order_acq_rel))
+                {
+                    return static_cast<int>(i);
+                }
+            }
+            return -1;
+        }
+
+        /*!
+        * @brief Unsubscribe a consumer
+        * @param consumer : Identifier returned by subscribe. Identifiers out of range are ignored.
+        *
+        * Pending events of the consumer are discarded.
+        *
+        */
+        void unsubscribe(int consumer)
+        {
+            if(consumer < 0 || static_cast<std::size_t>(consumer) >= MaxConsumers)
+            {
+                return;
+            }
+            m_consumer_cursors[consumer].value.store(UNUSED_CURSOR, std::memory_order_release);
+        }
+
+        /*!
+        * @brief Publish an event to all consumers
+        * @param event : Event to publish.
+        * @return False if the event has been dropped because the slowest consumer is Capacity events late, or the previous event of the slot is still being written
+        *
+        * May be called from any thread, even while no consumer is subscribed. Never blocks.
+        *
+        */
+        bool publish(const Event& event)
+        {
+            uint64_t claim = m_claim_cursor.load(std::memory_order_relaxed);
+            do
+            {
+                uint64_t previous_sequence = claim < Capacity ? 0 : claim - Capacity + 1;
+                if(claim - getSlowestCursor(claim) >= Capacity // Slot still holds an event not read by some consumer
+                   || m_slots[claim & (Capacity - 1)].sequence.load(std::memory_order_acquire) != previous_sequence) // Producer a lap behind still writes the slot
+                {
+                    m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            } while(!m_claim_cursor.compare_exchange_weak(claim, claim + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+            Slot& slot = m_slots[claim & (Capacity - 1)];
+            slot.event = event;
+            slot.sequence.store(claim + 1, std::memory_order_release); // Sequence is index + 1 once published so that 0 means empty
+            return true;
+        }
+
+        /*!
+        * @brief Copy pending events of a consumer
+        * @param consumer : Identifier returned by subscribe. Nothing is copied for identifiers out of range.
+        * @param events : Array receiving the events.
+        * @param max_events : Size of the events array.
+        * @return Number of events copied
+        *
+        * Events are copied in publication order. Must not be called concurrently for the same consumer.
+        *
+        */
+        std::size_t drain(int consumer, Event* events, std::size_t max_events)
+        {
+            if(consumer < 0 || static_cast<std::size_t>(consumer) >= MaxConsumers)
+            {
+                return 0;
+            }
+            std::atomic<uint64_t>& consumer_cursor = m_consumer_cursors[consumer].value;
+            uint64_t cursor = consumer_cursor.load(std::memory_order_relaxed);
+            std::size_t count = 0;
+            while(count < max_events)
+            {
+                const Slot& slot = m_slots[cursor & (Capacity - 1)];
+                if(slot.sequence.load(std::memory_order_acquire) != cursor + 1) // Not published yet
+                {
+                    break;
+                }
+                events[count++] = slot.event;
+                ++cursor;
+            }
+            consumer_cursor.store(cursor, std::memory_order_release); // Releases slots to producers
+            return count;
+        }
+
+        /*!
+        * @brief Get number of events dropped since creation
+        * @return Number of dropped events
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getDroppedCount() const
+        {
+            return m_dropped_count.load(std::memory_order_relaxed);
+        }
+
+    protected:
+        static const uint64_t UNUSED_CURSOR = ~static_cast<uint64_t>(0); /*!< Cursor value of consumers not subscribed. */
+
+        /*!
+        * @brief Slot of the ring buffer
+        */
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence; /*!< Index + 1 of the event stored in slot once published. */
+            Event event; /*!< Stored event. */
+        };
+
+        /*!
+        * @brief Cursor isolated on its own cache line to avoid false sharing between consumers
+        */
+        struct alignas(64) PaddedCursor
+        {
+            std::atomic<uint64_t> value; /*!< Index of the next event to read. */
+        };
+
+        Slot m_slots[Capacity]; /*!< Ring buffer of events. */
+        alignas(64) std::atomic<uint64_t> m_claim_cursor; /*!< Index of the next slot to claim for publication. */
+        std::atomic<uint64_t> m_dropped_count; /*!< Number of events dropped because of a full ring buffer. */
+        PaddedCursor m_consumer_cursors[MaxConsumers]; /*!< Read cursors of consumers. */
+
+        /*!
+        * @brief Get cursor of the slowest consumer
+        * @param claim : Current claim cursor, returned if there is no consumer.
+        * @return Smallest consumer cursor
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getSlowestCursor(uint64_t claim) const
+        {
+            uint64_t slowest = claim;
+            for(std::size_t i = 0; i < MaxConsumers; ++i)
+            {
+                uint64_t cursor = m_consumer_cursors[i].value.load(std::memory_order_acquire);
+                (cursor != UNUSED_CURSOR && cursor < slowest) && (slowest = cursor);
+            }
+            return slowest;
+        }
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
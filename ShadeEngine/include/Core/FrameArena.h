@@ -0,0 +1,197 @@
+/*!
+ * @file FrameArena.h
+ * @brief Class used to allocate transient data of a frame.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a linear memory arena reset once per frame. <br>
+ * Allocating is a pointer bump inside a preallocated block and freeing is done for all allocations at once, so frame preparation does not need the heap.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class FrameArena
+    * \brief Class allowing to allocate memory released all at once.
+    *
+    * Definition of a linear allocator. Allocations are carved one after another in a single block and are never freed individually. <br>
+    * When a frame needs more than the block capacity, extra blocks are taken from the heap. On reset, they are released and the block grows so that following frames fit in it. <br>
+    * The number of heap allocations made by the arena is counted, so that overflowing frames can be detected. It does not account for allocations made outside the arena. <br>
+    * Not thread safe.
+    *
+    */
+    class FrameArena
+    {
+    public:
+        /*!
+        * @brief Constructor of the FrameArena class
+        * @param capacity : Initial size of the block in bytes. Default is 256 kB.
+        *
+        */
+        explicit FrameArena(std::size_t capacity = 256 * 1024);
+
+        /*!
+        * @brief Destructor of the FrameArena class
+        *
+        * Releases all memory. Pointers given by the arena become invalid.
+        *
+        */
+        ~FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /*!
+        * @brief Allocate memory until next reset
+        * @param size : Size of the allocation in bytes.
+        * @param alignment : Alignment of the allocation. Must be a power of 2.
+        * @return Pointer on allocated memory
+        *
+        */
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /*!
+        * @brief Release all allocations
+        *
+        * Grows the block if the previous frame did not fit in it.
+        *
+        */
+        void reset();
+
+        /*!
+        * @brief Get size of the block
+        * @return Capacity of the block in bytes
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getCapacity() const;
+
+        /*!
+        * @brief Get memory used since last reset
+        * @return Used memory in bytes, including memory taken from the heap
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getUsed() const;
+
+        /*!
+        * @brief Get highest memory usage of a frame
+        * @return Peak usage in bytes
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getPeakUsage() const;
+
+        /*!
+        * @brief Get number of heap allocations made by the arena
+        * @return Number of heap allocations since construction
+        *
+        * Once the block is large enough for a frame, this counter stops increasing. <br>
+        * Constant method.
+        *
+        */
+        uint64_t getHeapAllocationCount() const;
+
+    protected:
+        char* m_block; /*!< Preallocated block. */
+        std::size_t m_capacity; /*!< Size of the block in bytes. */
+        std::size_t m_offset; /*!< Offset of the first free byte of the block. */
+        std::vector<char*> m_overflow_blocks; /*!< Heap blocks allocated when the block was full. */
+        std::size_t m_overflow_size; /*!< Size of heap blocks allocated since last reset. */
+        std::size_t m_peak_usage; /*!< Highest memory usage of a frame in bytes. */
+        uint64_t m_heap_allocation_count; /*!< Number of heap allocations made by the arena. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
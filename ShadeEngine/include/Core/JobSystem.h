@@ -0,0 +1,287 @@
+/*!
+ * @file JobSystem.h
+ * @brief Class used to run engine tasks on all cores.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a work stealing job system. <br>
+ * Each worker thread owns a deque of jobs: it runs its own jobs newest first and steals the oldest jobs of other workers when it runs out. <br>
+ * Jobs are tracked with counters, which can be waited for and used as dependencies of other jobs.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    typedef std::function<void()> Job; /*!< Task run by the job system. */
+
+    /*! \class JobCounter
+    * \brief Class counting jobs not finished yet.
+    *
+    * Definition of a counter incremented when a job is submitted with it and decremented when that job ends. <br>
+    * Jobs depending on the counter are held back until it reaches 0. A counter can be reused once it reached 0. It must outlive its jobs.
+    *
+    */
+    class JobCounter
+    {
+        friend class JobSystem;
+
+    public:
+        /*!
+        * @brief Constructor of the JobCounter class
+        *
+        * Counter starts at 0.
+        *
+        */
+        JobCounter();
+
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        /*!
+        * @brief Tell if all jobs counted have ended
+        * @return True if counter is 0
+        *
+        * Constant method.
+        *
+        */
+        bool isDone() const;
+
+    protected:
+        std::atomic<int> m_count; /*!< Number of jobs not finished. */
+    };
+
+    /*! \class JobSystem
+    * \brief Class allowing to run engine tasks on a shared pool of worker threads.
+    *
+    * Definition of a pool of worker threads, one per core by default, sharing jobs through work stealing. <br>
+    * Only WorldStreamer cell builds are submitted to it so far. Scene updates, resource decoding and batch building still run on their own threads or timers. <br>
+    * Waiting for a counter runs other jobs meanwhile, so jobs can wait for the jobs they spawned without blocking a worker. <br>
+    * All methods are thread safe.
+    *
+    */
+    class JobSystem
+    {
+    public:
+        /*!
+        * @brief Constructor of the JobSystem class
+        * @param worker_count : Number of worker threads. 0 uses one per core minus one for the GUI thread, at least 1. Default is 0.
+        *
+        */
+        JobSystem(unsigned int worker_count = 0);
+
+        /*!
+        * @brief Destructor of the JobSystem class
+        *
+        * Runs jobs still queued, then stops and joins worker threads. Jobs held back by a dependency that never completes are dropped.
+        *
+        */
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /*!
+        * @brief Get number of worker threads
+        * @return Number of workers
+        *
+        * Constant method.
+        *
+        */
+        unsigned int getWorkerCount() const;
+
+        /*!
+        * @brief Submit a job
+        * @param job : Job to run.
+        * @param counter : Counter incremented now and decremented when job ends. Default is NULL.
+        * @param dependency : Counter that must reach 0 before job starts. Default is NULL.
+        *
+        * Jobs submitted by a worker go to its own deque, others are spread over workers.
+        *
+        */
+        void submit(Job job, JobCounter* counter = NULL, JobCounter* dependency = NULL);
+
+        /*!
+        * @brief Wait until all jobs of a counter have ended
+        * @param counter : Counter to wait for.
+        *
+        * Runs queued jobs while waiting, from any thread. The calling thread only sleeps when no job is queued.
+        *
+        */
+        void wait(const JobCounter& counter);
+
+        /*!
+        * @brief Tell if calling thread is a worker of this job system
+        * @return True if called from a job
+        *
+        * Constant method.
+        *
+        */
+        bool isWorkerThread() const;
+
+    protected:
+        /*!
+        * @brief Job and the counter it decrements
+        */
+        struct QueuedJob
+        {
+            Job job; /*!< Job to run. */
+            JobCounter* counter; /*!< Counter of the job or NULL. */
+        };
+
+        /*!
+        * @brief Deque of jobs owned by a worker
+        *
+        * Owner pushes and pops at the back, thieves take from the front.
+        */
+        struct WorkerQueue
+        {
+            std::mutex mutex; /*!< Mutex protecting jobs. Contended only when stealing. */
+            std::deque<QueuedJob> jobs; /*!< Jobs queued on the worker. */
+        };
+
+        /*!
+        * @brief Job held back until a counter reaches 0
+        */
+        struct HeldJob
+        {
+            const JobCounter* dependency; /*!< Counter job waits for. Only compared, never dereferenced once it reached 0. */
+            QueuedJob queued_job; /*!< Job to queue once dependency is met. */
+        };
+
+        std::vector< std::unique_ptr<WorkerQueue> > m_queues; /*!< Deque of each worker. */
+        std::vector<std::thread> m_workers; /*!< Worker threads. */
+        std::atomic<int> m_queued_count; /*!< Number of jobs in all deques. */
+        std::atomic<unsigned int> m_next_queue; /*!< Deque receiving the next job submitted from outside workers. */
+        std::mutex m_held_mutex; /*!< Mutex protecting held jobs and counter decrements, so that a counter reaching 0 releases all its dependent jobs. */
+        std::vector<HeldJob> m_held_jobs; /*!< Jobs whose dependency is not met. */
+        std::mutex m_sleep_mutex; /*!< Mutex used to sleep while no job is queued. */
+        std::condition_variable m_sleep_condition; /*!< Condition notified when jobs are queued or workers must stop. */
+        bool m_stopping; /*!< Flag indicating workers must stop. Protected by sleep mutex. */
+
+        /*!
+        * @brief Main loop of worker threads
+        * @param index : Index of the worker and of its deque.
+        *
+        */
+        void workerLoop(unsigned int index);
+
+        /*!
+        * @brief Queue a job whose dependency is met
+        * @param job : Job to queue.
+        *
+        */
+        void enqueue(QueuedJob job);
+
+        /*!
+        * @brief Run one queued job
+        * @return False if no job was queued
+        *
+        * Takes the newest job of the calling worker, else the oldest job of another deque.
+        *
+        */
+        bool runOneJob();
+
+        /*!
+        * @brief Signal the end of a job to its counter
+        * @param counter : Counter of the job or NULL.
+        *
+        * Queues jobs depending on the counter when it reaches 0, then wakes threads waiting for it. Counter is not accessed after reaching 0, as its owner may destroy it right away.
+        *
+        */
+        void finishJob(JobCounter* counter);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
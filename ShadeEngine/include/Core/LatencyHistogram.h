@@ -0,0 +1,198 @@
+/*!
+ * @file LatencyHistogram.h
+ * @brief Class used to accumulate a distribution of durations.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a fixed size log-linear histogram of durations. <br>
+ * Durations below 16 microseconds have their own bucket, then each power of two is split into 8 buckets, giving a relative precision of 12.5% up to more than an hour.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <ostream>
+#include <stdint.h>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class LatencyHistogram
+    * \brief Class allowing to record durations and query their distribution.
+    *
+    * Definition of a histogram whose recording is a constant time operation without allocation.
+    *
+    */
+    class LatencyHistogram
+    {
+    public:
+        static const unsigned int BUCKET_COUNT = 256; /*!< Number of buckets of the histogram. */
+
+        /*!
+        * @brief Constructor of the LatencyHistogram class
+        *
+        * Creates an empty histogram.
+        *
+        */
+        LatencyHistogram();
+
+        /*!
+        * @brief Add a duration to the histogram
+        * @param duration_ns : Duration in nanoseconds.
+        *
+        */
+        void record(uint64_t duration_ns);
+
+        /*!
+        * @brief Remove all recorded durations
+        *
+        */
+        void reset();
+
+        /*!
+        * @brief Get number of recorded durations
+        * @return Number of recorded durations
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getCount() const;
+
+        /*!
+        * @brief Get a percentile of recorded durations
+        * @param percentile : Percentile between 0 and 100.
+        * @return Upper bound in microseconds of the bucket containing the percentile, 0 if histogram is empty
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getPercentile(double percentile) const;
+
+        /*!
+        * @brief Get longest recorded duration
+        * @return Longest duration in microseconds
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getMax() const;
+
+        /*!
+        * @brief Write the distribution as text
+        * @param stream : Stream to write to.
+        *
+        * Writes count, main percentiles and one line per non empty bucket. <br>
+        * Constant method.
+        *
+        */
+        void dump(std::ostream& stream) const;
+
+    protected:
+        uint64_t m_buckets[BUCKET_COUNT]; /*!< Number of durations recorded in each bucket. */
+        uint64_t m_count; /*!< Number of recorded durations. */
+        uint64_t m_max_us; /*!< Longest recorded duration in microseconds. */
+
+        /*!
+        * @brief Get bucket of a duration
+        * @param duration_us : Duration in microseconds.
+        * @return Bucket index
+        *
+        * Static method.
+        *
+        */
+        static unsigned int getBucket(uint64_t duration_us);
+
+        /*!
+        * @brief Get lowest duration of a bucket
+        * @param bucket : Bucket index.
+        * @return Lowest duration in microseconds
+        *
+        * Static method.
+        *
+        */
+        static uint64_t getBucketLowerBound(unsigned int bucket);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,288 @@
+/*!
+ * @file MemoryProfiler.h
+ * @brief Class used to measure heap usage of the engine subsystems.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of an opt-in heap instrumentation layer. <br>
+ * When SHADE_ENGINE_MEMORY_PROFILING is defined, global operator new and delete are replaced to count allocations, bytes and live memory. <br>
+ * Allocations are attributed to the memory tag of the scope they are made in, so that render, scene update and resource loading can be told apart.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef MEMORY_PROFILER_H
+#define MEMORY_PROFILER_H
+
+#include <ostream>
+#include <stdint.h>
+
+#ifdef SHADE_ENGINE_MEMORY_PROFILING
+#define SHADE_ENGINE_MEMORY_SCOPE_CONCAT_IMPL(a, b) a##b
+#define SHADE_ENGINE_MEMORY_SCOPE_CONCAT(a, b) SHADE_ENGINE_MEMORY_SCOPE_CONCAT_IMPL(a, b)
+#define SHADE_ENGINE_MEMORY_SCOPE(tag) ShadeEngine::ScopedMemoryTag SHADE_ENGINE_MEMORY_SCOPE_CONCAT(shade_engine_memory_scope_, __LINE__)(tag) /*!< Attribute allocations of the enclosing scope to tag. */
+#else
+#define SHADE_ENGINE_MEMORY_SCOPE(tag) /*!< Compiled out when memory profiling is disabled. */
+#endif
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*!
+    * @brief Subsystems heap usage is attributed to
+    */
+    enum MemoryTag
+    {
+        MEMORY_TAG_UNTAGGED, /*!< Allocations made outside any tagged scope. */
+        MEMORY_TAG_RENDER, /*!< Frame rendering. */
+        MEMORY_TAG_SCENE_UPDATE, /*!< Sprite layers, chunks and scene graph updates. */
+        MEMORY_TAG_RESOURCES, /*!< Texture, geometry and scene loading. */
+        MEMORY_TAG_COUNT /*!< Number of tags. */
+    };
+
+    /*!
+    * @brief Heap usage counters
+    */
+    struct MemoryStatistics
+    {
+        uint64_t allocation_count; /*!< Number of allocations. */
+        uint64_t deallocation_count; /*!< Number of deallocations. */
+        uint64_t allocated_bytes; /*!< Number of bytes allocated. */
+        int64_t live_bytes; /*!< Number of bytes currently allocated. */
+        int64_t peak_live_bytes; /*!< Highest number of bytes allocated at the same time. */
+    };
+
+    /*! \class MemoryProfiler
+    * \brief Class allowing to read heap usage of the engine.
+    *
+    * Definition of a class gathering heap statistics per memory tag, both since program start and since the beginning of the current frame. <br>
+    * Counters are only updated when SHADE_ENGINE_MEMORY_PROFILING is defined, otherwise all statistics stay at 0. <br>
+    * Memory freed is attributed to the tag it was allocated with. Allocations made while profiling is paused are ignored, even when freed later. <br>
+    * All methods are static and thread safe.
+    *
+    */
+    class MemoryProfiler
+    {
+    public:
+        /*!
+        * @brief Tell if profiling is compiled in
+        * @return True if SHADE_ENGINE_MEMORY_PROFILING was defined when building the engine
+        *
+        * Static method.
+        *
+        */
+        static bool isAvailable();
+
+        /*!
+        * @brief Pause or resume counting
+        * @param enabled : True to count allocations. Counting is enabled by default.
+        *
+        * Static method.
+        *
+        */
+        static void setEnabled(bool enabled);
+
+        /*!
+        * @brief Start a new frame
+        *
+        * Resets frame statistics of all tags. AbstractShadeWidget calls it at the beginning of each repaint, so with several widgets a frame is the repaint of one widget. <br>
+        * Static method.
+        *
+        */
+        static void beginFrame();
+
+        /*!
+        * @brief Get heap usage of a tag since program start
+        * @param tag : Memory tag.
+        * @return Statistics of the tag
+        *
+        * Static method.
+        *
+        */
+        static MemoryStatistics getTotalStatistics(MemoryTag tag);
+
+        /*!
+        * @brief Get heap usage of a tag since the beginning of the frame
+        * @param tag : Memory tag.
+        * @return Statistics of the tag. Peak is the highest live memory of the tag during the frame
+        *
+        * Static method.
+        *
+        */
+        static MemoryStatistics getFrameStatistics(MemoryTag tag);
+
+        /*!
+        * @brief Get heap usage of all tags since program start
+        * @return Statistics of the whole program
+        *
+        * Static method.
+        *
+        */
+        static MemoryStatistics getTotalStatistics();
+
+        /*!
+        * @brief Get heap usage of all tags since the beginning of the frame
+        * @return Statistics of the whole program
+        *
+        * Static method.
+        *
+        */
+        static MemoryStatistics getFrameStatistics();
+
+        /*!
+        * @brief Get name of a tag
+        * @param tag : Memory tag.
+        * @return Printable name of the tag
+        *
+        * Static method.
+        *
+        */
+        static const char* getTagName(MemoryTag tag);
+
+        /*!
+        * @brief Write statistics of all tags as text
+        * @param stream : Stream to write to.
+        *
+        * Static method.
+        *
+        */
+        static void dump(std::ostream& stream);
+
+        /*!
+        * @brief Get tag allocations of calling thread are attributed to
+        * @return Current memory tag of the thread
+        *
+        * Static method.
+        *
+        */
+        static MemoryTag getCurrentTag();
+
+        /*!
+        * @brief Set tag allocations of calling thread are attributed to
+        * @param tag : New memory tag of the thread.
+        * @return Previous memory tag of the thread
+        *
+        * Prefer ScopedMemoryTag or SHADE_ENGINE_MEMORY_SCOPE. <br>
+        * Static method.
+        *
+        */
+        static MemoryTag setCurrentTag(MemoryTag tag);
+    };
+
+    /*! \class ScopedMemoryTag
+    * \brief Class attributing allocations of a scope to a memory tag.
+    *
+    * Sets the memory tag of the calling thread on construction and restores the previous one on destruction, so scopes can be nested.
+    *
+    */
+    class ScopedMemoryTag
+    {
+    public:
+        /*!
+        * @brief Constructor of the ScopedMemoryTag class
+        * @param tag : Tag allocations of the scope are attributed to.
+        *
+        */
+        explicit ScopedMemoryTag(MemoryTag tag) : m_previous_tag(MemoryProfiler::setCurrentTag(tag))
+        {
+        }
+
+        /*!
+        * @brief Destructor of the ScopedMemoryTag class
+        *
+        * Restores previous tag.
+        *
+        */
+        ~ScopedMemoryTag()
+        {
+            MemoryProfiler::setCurrentTag(m_previous_tag);
+        }
+
+        ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+        ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+    protected:
+        MemoryTag m_previous_tag; /*!< Tag restored on destruction. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
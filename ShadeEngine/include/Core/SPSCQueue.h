@@ -0,0 +1,191 @@
+/*!
+ * @file SPSCQueue.h
+ * @brief Class used to pass values from one thread to another without locks.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a bounded lock-free single-producer single-consumer queue. <br>
+ * Template class.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class SPSCQueue
+    * \brief Class allowing one producer thread to send values to one consumer thread.
+    *
+    * Definition of a fixed size ring buffer with atomic read and write cursors. <br>
+    * Neither push nor pop ever block or allocate. A value pushed in a full queue is dropped. <br>
+    * Template class. Capacity must be a power of 2.
+    *
+    */
+    template<typename T, std::size_t Capacity>
+    class SPSCQueue
+    {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of 2");
+
+    public:
+        /*!
+        * @brief Constructor of the SPSCQueue class
+        *
+        * Creates an empty queue.
+        *
+        */
+        SPSCQueue() : m_write_cursor(0), m_read_cursor(0), m_dropped_count(0)
+        {
+        }
+
+        SPSCQueue(const SPSCQueue&) = delete;
+        SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+        /*!
+        * @brief Add a value at the end of the queue
+        * @param value : Value to add.
+        * @param reserved : Number of slots that must stay free after the push. Keeps room for values that should not be dropped. Must be lower than Capacity.
+        * @return False if queue is full and value has been dropped
+        *
+        * Must only be called from the producer thread.
+        *
+        */
+        bool push(const T& value, std::size_t reserved = 0)
+        {
+            uint64_t write = m_write_cursor.load(std::memory_order_relaxed);
+            if(write - m_read_cursor.load(std::memory_order_acquire) >= Capacity - reserved)
+            {
+                m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            m_values[write & (Capacity - 1)] = value;
+            m_write_cursor.store(write + 1, std::memory_order_release); // Publishes value to consumer
+            return true;
+        }
+
+        /*!
+        * @brief Remove the value at the front of the queue
+        * @param value : Receives removed value.
+        * @return False if queue is empty
+        *
+        * Must only be called from the consumer thread.
+        *
+        */
+        bool pop(T& value)
+        {
+            uint64_t read = m_read_cursor.load(std::memory_order_relaxed);
+            if(read == m_write_cursor.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            value = m_values[read & (Capacity - 1)];
+            m_read_cursor.store(read + 1, std::memory_order_release); // Releases slot to producer
+            return true;
+        }
+
+        /*!
+        * @brief Get number of values dropped because queue was full
+        * @return Number of dropped values
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getDroppedCount() const
+        {
+            return m_dropped_count.load(std::memory_order_relaxed);
+        }
+
+    protected:
+        T m_values[Capacity]; /*!< Ring buffer of values. */
+        alignas(64) std::atomic<uint64_t> m_write_cursor; /*!< Number of values pushed since creation. Written by producer only. */
+        alignas(64) std::atomic<uint64_t> m_read_cursor; /*!< Number of values popped since creation. Written by consumer only. */
+        std::atomic<uint64_t> m_dropped_count; /*!< Number of values dropped because queue was full. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,229 @@
+/*!
+ * @file Tracer.h
+ * @brief Class used to record a timeline of engine scopes.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of an opt-in timeline instrumentation layer. <br>
+ * When SHADE_ENGINE_TRACING is defined, SHADE_ENGINE_TRACE_SCOPE records the start and duration of the enclosing scope in a ring buffer owned by the calling thread. <br>
+ * The latest events of all threads can be exported as Chrome trace JSON, to be opened in chrome://tracing or Perfetto to inspect single slow frames.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <ostream>
+#include <stdint.h>
+
+#ifdef SHADE_ENGINE_TRACING
+#define SHADE_ENGINE_TRACE_CONCAT_IMPL(a, b) a##b
+#define SHADE_ENGINE_TRACE_CONCAT(a, b) SHADE_ENGINE_TRACE_CONCAT_IMPL(a, b)
+#define SHADE_ENGINE_TRACE_SCOPE(name) ShadeEngine::ScopedTrace SHADE_ENGINE_TRACE_CONCAT(shade_engine_trace_scope_, __LINE__)(name) /*!< Record the enclosing scope under name, which must be a string literal. */
+#else
+#define SHADE_ENGINE_TRACE_SCOPE(name) /*!< Compiled out when tracing is disabled. */
+#endif
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class Tracer
+    * \brief Class allowing to record and export a timeline of engine scopes.
+    *
+    * Definition of a class gathering trace events in one ring buffer per thread, so that recording neither locks nor allocates once the buffer of the thread exists. <br>
+    * Each buffer keeps the latest EVENTS_PER_THREAD events, older ones are overwritten. Events are only recorded when SHADE_ENGINE_TRACING is defined. <br>
+    * Buffers of finished threads are exported until a new thread reuses them, along with their trace thread identifier. <br>
+    * All methods are static and thread safe.
+    *
+    */
+    class Tracer
+    {
+    public:
+        static const uint32_t EVENTS_PER_THREAD = 65536; /*!< Capacity of the ring buffer of each thread. Power of 2. */
+
+        /*!
+        * @brief Tell if tracing is compiled in
+        * @return True if SHADE_ENGINE_TRACING was defined when building the engine
+        *
+        * Static method.
+        *
+        */
+        static bool isAvailable();
+
+        /*!
+        * @brief Pause or resume recording
+        * @param enabled : True to record events. Recording is enabled by default.
+        *
+        * Static method.
+        *
+        */
+        static void setEnabled(bool enabled);
+
+        /*!
+        * @brief Name the calling thread in exported traces
+        * @param name : Name of the thread. Must be a string literal or outlive the tracer.
+        *
+        * Threads without name are shown with their index. <br>
+        * Static method.
+        *
+        */
+        static void setThreadName(const char* name);
+
+        /*!
+        * @brief Get current time of the trace clock
+        * @return Nanoseconds elapsed since the first call
+        *
+        * Static method.
+        *
+        */
+        static uint64_t getTimestamp();
+
+        /*!
+        * @brief Record a scope in the buffer of the calling thread
+        * @param name : Name of the scope. Must be a string literal or outlive the tracer.
+        * @param start_ns : Start of the scope as returned by getTimestamp.
+        * @param end_ns : End of the scope as returned by getTimestamp.
+        *
+        * Prefer ScopedTrace or SHADE_ENGINE_TRACE_SCOPE. Buffer of the thread is allocated on its first event. <br>
+        * Static method.
+        *
+        */
+        static void record(const char* name, uint64_t start_ns, uint64_t end_ns);
+
+        /*!
+        * @brief Forget recorded events
+        *
+        * Static method.
+        *
+        */
+        static void clear();
+
+        /*!
+        * @brief Write recorded events as Chrome trace JSON
+        * @param stream : Stream to write to.
+        *
+        * Threads may keep recording meanwhile. Events overwritten during the export are left out. <br>
+        * Static method.
+        *
+        */
+        static void exportChromeTrace(std::ostream& stream);
+    };
+
+    /*! \class ScopedTrace
+    * \brief Class recording the duration of a scope.
+    *
+    * Measures time between construction and destruction, then records it in the buffer of the calling thread.
+    *
+    */
+    class ScopedTrace
+    {
+    public:
+        /*!
+        * @brief Constructor of the ScopedTrace class
+        * @param name : Name of the scope. Must be a string literal or outlive the tracer.
+        *
+        */
+        explicit ScopedTrace(const char* name) : m_name(name), m_start_ns(Tracer::getTimestamp())
+        {
+        }
+
+        /*!
+        * @brief Destructor of the ScopedTrace class
+        *
+        * Records the scope.
+        *
+        */
+        ~ScopedTrace()
+        {
+            Tracer::record(m_name, m_start_ns, Tracer::getTimestamp());
+        }
+
+        ScopedTrace(const ScopedTrace&) = delete;
+        ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+    protected:
+        const char* m_name; /*!< Name of the scope. */
+        uint64_t m_start_ns; /*!< Start of the scope. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
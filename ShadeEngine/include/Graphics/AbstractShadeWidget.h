@@ -69,10 +69,19 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #ifndef ABSTRACT_SHADE_WIDGET_H
 #define ABSTRACT_SHADE_WIDGET_H
 
+#include <ostream>
+#include <vector>
 #include <QWidget>
 #include <QTimer>
 #include <SFML/Graphics.hpp>
 
+#include "include/Core/ArenaAllocator.h"
+#include "include/Core/FrameArena.h"
+#include "include/Core/LatencyHistogram.h"
+#include "include/Core/SPSCQueue.h"
+#include "include/Input/InputEvent.h"
+#include "include/Input/InputState.h"
+
 /*!
 * @namespace ShadeEngine
 * @brief A namespace used to regroup all classes associated with ShadeEngine library
@@ -84,6 +93,7 @@ namespace ShadeEngine
     *
     * Definition of a class used to manage SFML rendering and integrating it into Qt windows. <br>
     * Abstract class. Must be inherited depending on your rendering requirements in order to be used. <br>
+    * The OpenGL contexts of all widgets share their objects, so textures and geometry obtained from SharedResources are uploaded once and drawn by every widget. <br>
     * Inherits from QWidget and sf::RenderWindow.
     *
     */
@@ -128,10 +138,65 @@ namespace ShadeEngine
         */
         sf::Color getBackgroundColor() const;
 
+        /*!
+        * @brief Enable or disable input-to-display latency measurement
+        * @param enabled : True to measure latency.
+        *
+        * When enabled, every key press and mouse button press drained at the beginning of a frame is considered as having its effect in this frame. <br>
+        * Auto-repeated keys, mouse moves and wheel events are not measured. <br>
+        * Once the frame has been displayed, the delay between Qt event reception and the end of display() is recorded in the latency histogram. <br>
+        * Disabled by default.
+        *
+        */
+        void setLatencyMeasurementEnabled(bool enabled);
+
+        /*!
+        * @brief Get input-to-display latency distribution
+        * @return Histogram of latencies recorded since measurement was enabled
+        *
+        * Constant method.
+        *
+        */
+        const LatencyHistogram& getLatencyHistogram() const;
+
+        /*!
+        * @brief Write input-to-display latency distribution as text
+        * @param stream : Stream to write to.
+        *
+        * Constant method.
+        *
+        */
+        void dumpLatencyHistogram(std::ostream& stream) const;
+
+        /*!
+        * @brief Get number of heap allocations made by the frame arena
+        * @return Number of heap allocations since construction
+        *
+        * Stops increasing once the arena is large enough for a frame. Only covers data allocated in the arena, use MemoryProfiler render counters for every render allocation. <br>
+        * Constant method.
+        *
+        */
+        uint64_t getFrameArenaHeapAllocationCount() const;
+
+        /*!
+        * @brief Get highest frame arena usage
+        * @return Peak usage of the frame arena in bytes
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getFrameArenaPeakUsage() const;
+
     protected:
         QTimer m_refresh_timer; /*!< Timer used to trigger window repaint. */
         bool m_initialized; /*!< Flag indicating if rendering has been initialized. */
         sf::Color m_background_color; /*!< Color with which the background is repainted. */
+        SPSCQueue<InputEvent, 256> m_input_queue; /*!< Input events sent by Qt event handlers to the frame loop. */
+        InputState m_input_state; /*!< Keyboard and mouse state updated once per frame. */
+        std::vector<InputEvent> m_frame_input_events; /*!< Input events drained at the beginning of current frame. */
+        bool m_latency_measurement_enabled; /*!< Flag indicating if input-to-display latency is recorded. */
+        LatencyHistogram m_latency_histogram; /*!< Distribution of input-to-display latencies. */
+        FrameArena m_frame_arena; /*!< Arena holding transient data of current frame. */
 
         /*!
         * @brief Redefinition of QWidget's paintEngine
@@ -160,7 +225,8 @@ namespace ShadeEngine
         * @brief Actions performed on a paint event
         * @param Unused paint event
         *
-        * Redefinition of QWidget's paint event handler. Updates display with user action (via onUpdate). <br>
+        * Redefinition of QWidget's paint event handler. Drains input events then updates display with user action (via onUpdate). <br>
+        * If latency measurement is enabled, records latency of drained key and button presses once display is done. Frame arena is reset at the end. <br>
         * Virtual method cannot be redefined in child classes.
         *
         */
@@ -176,6 +242,106 @@ namespace ShadeEngine
         */
         virtual void resizeEvent(QResizeEvent*) final;
 
+        /*!
+        * @brief Actions performed on a key press event
+        * @param event : Key event
+        *
+        * Redefinition of QWidget's key press event handler. Converts event into an input record queued for next frame. <br>
+        * Virtual method cannot be redefined in child classes.
+        *
+        */
+        virtual void keyPressEvent(QKeyEvent* event) final;
+
+        /*!
+        * @brief Actions performed on a key release event
+        * @param event : Key event
+        *
+        * Redefinition of QWidget's key release event handler. Converts event into an input record queued for next frame. <br>
+        * Virtual method cannot be redefined in child classes.
+        *
+        */
+        virtual void keyReleaseEvent(QKeyEvent* event) final;
+
+        /*!
+        * @brief Actions performed on a mouse press event
+        * @param event : Mouse event
+        *
+        * Redefinition of QWidget's mouse press event handler. Converts event into an input record queued for next frame. <br>
+        * Virtual method cannot be redefined in child classes.
+        *
+        */
+        virtual void mousePressEvent(QMouseEvent* event) final;
+
+        /*!
+        * @brief Actions performed on a mouse release event
+        * @param event : Mouse event
+        *
+        * Redefinition of QWidget's mouse release event handler. Converts event into an input record queued for next frame. <br>
+        * Virtual method cannot be redefined in child classes.
+        *
+        */
+        virtual void mouseReleaseEvent(QMouseEvent* event) final;
+
+        /*!
+        * @brief Actions performed on a mouse move event
+        * @param event : Mouse event
+        *
+        * Redefinition of QWidget's mouse move event handler. Converts event into an input record queued for next frame. <br>
+        * Virtual method cannot be redefined in child classes.
+        *
+        */
+        virtual void mouseMoveEvent(QMouseEvent* event) final;
+
+        /*!
+        * @brief Actions performed on a wheel event
+        * @param event : Wheel event
+        *
+        * Redefinition of QWidget's wheel event handler. Converts event into an input record queued for next frame. <br>
+        * Virtual method cannot be redefined in child classes.
+        *
+        */
+        virtual void wheelEvent(QWheelEvent* event) final;
+
+        /*!
+        * @brief Actions performed when widget loses keyboard focus
+        * @param event : Focus event
+        *
+        * Redefinition of QWidget's focus out event handler. Queues an input record releasing all keys and buttons on next frame, as their release events will go to another widget. <br>
+        * Virtual method cannot be redefined in child classes.
+        *
+        */
+        virtual void focusOutEvent(QFocusEvent* event) final;
+
+        /*!
+        * @brief Get keyboard and mouse state of current frame
+        * @return Input state updated with all events received before current frame
+        *
+        * Intended to be used in onUpdate. <br>
+        * Constant method.
+        *
+        */
+        const InputState& getInputState() const;
+
+        /*!
+        * @brief Get input events received since previous frame
+        * @return Input events in reception order
+        *
+        * Intended to be used in onUpdate. <br>
+        * Constant method.
+        *
+        */
+        const std::vector<InputEvent>& getFrameInputEvents() const;
+
+        /*!
+        * @brief Get arena for transient data of current frame
+        * @return Frame arena
+        *
+        * Intended to be used in onUpdate for temporary containers (sorted draw lists, culled indexes, vertex scratch space...), for example through FrameVector. <br>
+        * Everything allocated from it is released at once after the frame is displayed, so it must not be kept across frames.
+        *
+        */
+        FrameArena& getFrameArena();
+
         /*!
         * @brief Clears window content and applies background color
         *
@@ -186,6 +352,24 @@ namespace ShadeEngine
         */
         void fillBackground();
 
+        /*!
+        * @brief Drain input queue and update input state
+        *
+        * Called once per frame before onUpdate. Never blocks the frame on the GUI thread.
+        *
+        */
+        void pollInput();
+
+        /*!
+        * @brief Queue an input record
+        * @param event : Input record. Its timestamp is set by this method.
+        *
+        * Called by Qt event handlers on the GUI thread. Event is dropped if the queue is full. <br>
+        * The last slots of the queue are kept for key and button releases and focus loss, so that a burst of moves or presses cannot leave keys stuck down.
+        *
+        */
+        void queueInputEvent(InputEvent event);
+
         /*!
         * @brief User specific rendering initialization
         *
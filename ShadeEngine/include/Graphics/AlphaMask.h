@@ -0,0 +1,158 @@
+/*!
+ * @file AlphaMask.h
+ * @brief Class used to know which pixels of a texture are transparent.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a bitset storing one bit per texture pixel. <br>
+ * Masks are computed once per texture and allow pixel accurate hit testing without reading texture memory back.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef ALPHA_MASK_H
+#define ALPHA_MASK_H
+
+#include <stdint.h>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class AlphaMask
+    * \brief Class storing the opaque pixels of an image.
+    *
+    * Definition of a class keeping one bit per pixel, set when the pixel is opaque enough to be clicked. <br>
+    * Rows are padded to 64 bits so that a pixel test is a shift and a mask.
+    *
+    */
+    class AlphaMask
+    {
+    public:
+        /*!
+        * @brief Constructor of the AlphaMask class
+        * @param image : Image whose alpha channel is read.
+        * @param alpha_threshold : Minimum alpha of opaque pixels. Default is 1, any visible pixel is opaque.
+        *
+        */
+        AlphaMask(const sf::Image& image, uint8_t alpha_threshold = 1);
+
+        /*!
+        * @brief Get size of the mask
+        * @return Size of the image the mask was built from
+        *
+        * Constant method.
+        *
+        */
+        sf::Vector2u getSize() const;
+
+        /*!
+        * @brief Tell if a pixel is opaque
+        * @param x : Column of the pixel.
+        * @param y : Row of the pixel.
+        * @return True if pixel is opaque, false if it is transparent or out of the mask
+        *
+        * Constant method.
+        *
+        */
+        bool isOpaque(unsigned int x, unsigned int y) const;
+
+        /*!
+        * @brief Tell if a point of a sprite lies on an opaque pixel
+        * @param sprite : Sprite whose texture the mask was built from.
+        * @param local_point : Point in sprite local coordinates, between (0,0) and the absolute size of its texture rect.
+        * @return True if pixel displayed at this point is opaque
+        *
+        * Handles texture rects with negative sizes, used to flip sprites. <br>
+        * Constant method.
+        *
+        */
+        bool isOpaque(const sf::Sprite& sprite, const sf::Vector2f& local_point) const;
+
+    protected:
+        sf::Vector2u m_size; /*!< Size of the image the mask was built from. */
+        std::size_t m_words_per_row; /*!< Number of 64 bits words storing a row. */
+        std::vector<uint64_t> m_bits; /*!< Opacity bits, row after row. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
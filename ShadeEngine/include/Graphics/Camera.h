@@ -0,0 +1,280 @@
+/*!
+ * @file Camera.h
+ * @brief Class used to scroll and zoom over the rendered world.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a 2D camera computing SFML views. <br>
+ * Camera can be panned, zoomed and can smoothly follow a target. Each layer can scroll at its own speed to create parallax effects.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class Camera
+    * \brief Class describing which part of the world is rendered.
+    *
+    * Definition of a class computing the view applied to each rendering layer. <br>
+    * Scrolling is performed by the view transform on the GPU, so sprites positions never need to be updated when the camera moves. <br>
+    * A camera that has never been positioned is centered on the middle of the rendering area, which reproduces the default SFML view.
+    *
+    */
+    class Camera
+    {
+    public:
+        /*!
+        * @brief Constructor of the Camera class
+        *
+        * Constructor of the Camera class. Zoom is 1, parallax of all layers is 1, pixel snapping is enabled.
+        *
+        */
+        Camera();
+
+        /*!
+        * @brief Set position of the camera center in world coordinates
+        * @param center : New center of the camera.
+        *
+        * Stops following target.
+        *
+        */
+        void setCenter(const sf::Vector2f& center);
+
+        /*!
+        * @brief Get position of the camera center in world coordinates
+        * @return Center of the camera
+        *
+        * Constant method.
+        *
+        */
+        sf::Vector2f getCenter() const;
+
+        /*!
+        * @brief Tell if camera has been positioned
+        * @return False if camera has never been positioned and reproduces the default view
+        *
+        * Constant method.
+        *
+        */
+        bool isPositioned() const;
+
+        /*!
+        * @brief Move the camera center
+        * @param offset : Offset added to the center in world coordinates.
+        *
+        * Stops following target.
+        *
+        */
+        void move(const sf::Vector2f& offset);
+
+        /*!
+        * @brief Set zoom factor of the camera
+        * @param zoom : Zoom factor. Values greater than 1 magnify the world. Ignored if not strictly positive.
+        *
+        */
+        void setZoom(float zoom);
+
+        /*!
+        * @brief Get zoom factor of the camera
+        * @return Zoom factor of the camera
+        *
+        * Constant method.
+        *
+        */
+        float getZoom() const;
+
+        /*!
+        * @brief Make camera follow a target
+        * @param target : Position the camera center moves to, in world coordinates.
+        * @param smoothing : Speed at which the camera catches up with the target in 1/s. 0 snaps the camera on the target.
+        *
+        * Must be called each time the target moves. Camera converges to the target independently of the frame rate.
+        *
+        */
+        void follow(const sf::Vector2f& target, float smoothing = 8.f);
+
+        /*!
+        * @brief Stop following target
+        *
+        * Camera stays where it currently is.
+        *
+        */
+        void stopFollowing();
+
+        /*!
+        * @brief Set parallax factor of a layer
+        * @param layer : Index of the layer.
+        * @param factor : Ratio between layer scrolling and camera scrolling. 0 keeps layer static on screen as with the default view, 1 scrolls it with the world, values in between make it look farther away.
+        *
+        */
+        void setLayerParallax(std::size_t layer, float factor);
+
+        /*!
+        * @brief Get parallax factor of a layer
+        * @param layer : Index of the layer.
+        * @return Parallax factor of the layer
+        *
+        * Constant method.
+        *
+        */
+        float getLayerParallax(std::size_t layer) const;
+
+        /*!
+        * @brief Enable or disable sub-pixel snapping
+        * @param enabled : True to round view positions to whole screen pixels.
+        *
+        * Snapping avoids the shimmering of pixel art sprites while scrolling at non integer speeds.
+        *
+        */
+        void setPixelSnapping(bool enabled);
+
+        /*!
+        * @brief Tell if sub-pixel snapping is enabled
+        * @return True if view positions are rounded to whole screen pixels
+        *
+        * Constant method.
+        *
+        */
+        bool isPixelSnapping() const;
+
+        /*!
+        * @brief Move camera toward followed target
+        * @param elapsed_seconds : Time elapsed since previous update.
+        *
+        * Does nothing if no target is followed.
+        *
+        */
+        void update(float elapsed_seconds);
+
+        /*!
+        * @brief Compute the view used to render a layer
+        * @param layer : Index of the layer.
+        * @param target_size : Size of the rendering area in pixels.
+        * @return View to apply before drawing the layer
+        *
+        * Constant method.
+        *
+        */
+        sf::View getLayerView(std::size_t layer, const sf::Vector2u& target_size) const;
+
+        /*!
+        * @brief Compute the world area visible in a layer
+        * @param layer : Index of the layer.
+        * @param target_size : Size of the rendering area in pixels.
+        * @return Rectangle of the layer coordinates that is visible, used to skip sprites out of screen
+        *
+        * Constant method.
+        *
+        */
+        sf::FloatRect getLayerVisibleArea(std::size_t layer, const sf::Vector2u& target_size) const;
+
+    protected:
+        sf::Vector2f m_center; /*!< Center of the camera in world coordinates. */
+        bool m_center_set; /*!< Flag indicating if camera has been positioned. */
+        float m_zoom; /*!< Zoom factor of the camera. */
+        bool m_following; /*!< Flag indicating if camera follows a target. */
+        sf::Vector2f m_target; /*!< Position of the followed target. */
+        float m_smoothing; /*!< Speed at which the camera catches up with the target in 1/s. */
+        std::vector<float> m_layer_parallax; /*!< Parallax factor of each layer. Layers beyond vector size use 1. */
+        bool m_pixel_snapping; /*!< Flag indicating if view positions are rounded to whole screen pixels. */
+
+        /*!
+        * @brief Compute center of the view of a layer
+        * @param layer : Index of the layer.
+        * @param target_size : Size of the rendering area in pixels.
+        * @return Center of the layer view, snapped if required
+        *
+        * Constant method.
+        *
+        */
+        sf::Vector2f getLayerCenter(std::size_t layer, const sf::Vector2u& target_size) const;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,311 @@
+/*!
+ * @file LightMap.h
+ * @brief Class used to light a scene with point lights.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a light map accumulating lights into a reduced resolution render texture multiplied over the scene. <br>
+ * Static lights are baked once in world space. The light map is only re-rendered when a light, the ambient color or the view changes.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef LIGHT_MAP_H
+#define LIGHT_MAP_H
+
+#include <stdint.h>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    typedef uint32_t LightId; /*!< Identifier of a light. Identifiers of destroyed lights are reused. */
+
+    /*! \class LightMap
+    * \brief Class allowing to light a scene with static and dynamic point lights.
+    *
+    * Definition of a class drawing lights as radial gradients added into a light map, cleared with the ambient color. <br>
+    * The light map covers the view at a fraction of the target resolution and is stretched with smoothing, which also softens light edges. <br>
+    * Static lights inside the static area are baked into a world space texture once, then drawn into the light map as a single quad. <br>
+    * Lights of the light map are drawn with a single draw call. Not thread safe.
+    *
+    */
+    class LightMap
+    {
+    public:
+        static const LightId INVALID_LIGHT; /*!< Identifier never associated with a light. */
+
+        /*!
+        * @brief Constructor of the LightMap class
+        *
+        * Creates a light map without lights, with a black ambient color, a resolution scale of 0.25 and 128 pixels wide light gradients.
+        *
+        */
+        LightMap();
+
+        /*!
+        * @brief Create a point light
+        * @param position : Center of the light in world units.
+        * @param radius : Distance at which light fades out completely.
+        * @param color : Color of the light at its center.
+        * @param is_static : True if light never moves, so that it can be baked. Default is false.
+        * @return Identifier of the light
+        *
+        */
+        LightId createLight(const sf::Vector2f& position, float radius, const sf::Color& color, bool is_static = false);
+
+        /*!
+        * @brief Destroy a light
+        * @param light : Identifier of the light. Ignored if invalid.
+        *
+        */
+        void destroyLight(LightId light);
+
+        /*!
+        * @brief Tell if an identifier is associated with a light
+        * @param light : Identifier to check.
+        * @return True if light exists
+        *
+        * Constant method.
+        *
+        */
+        bool isValid(LightId light) const;
+
+        /*!
+        * @brief Move a light
+        * @param light : Identifier of the light.
+        * @param position : Center of the light in world units.
+        *
+        * Moving a static light rebakes all static lights.
+        *
+        */
+        void setLightPosition(LightId light, const sf::Vector2f& position);
+
+        /*!
+        * @brief Set the radius of a light
+        * @param light : Identifier of the light.
+        * @param radius : Distance at which light fades out completely.
+        *
+        */
+        void setLightRadius(LightId light, float radius);
+
+        /*!
+        * @brief Set the color of a light
+        * @param light : Identifier of the light.
+        * @param color : Color of the light at its center.
+        *
+        */
+        void setLightColor(LightId light, const sf::Color& color);
+
+        /*!
+        * @brief Set the light received everywhere
+        * @param color : Ambient color. White leaves the scene unchanged.
+        *
+        */
+        void setAmbientColor(const sf::Color& color);
+
+        /*!
+        * @brief Get the light received everywhere
+        * @return Ambient color
+        *
+        * Constant method.
+        *
+        */
+        sf::Color getAmbientColor() const;
+
+        /*!
+        * @brief Set the resolution of the light map
+        * @param scale : Size of the light map relatively to the target, clamped between 1/16 and 1. Lower is faster and blurrier.
+        *
+        */
+        void setResolutionScale(float scale);
+
+        /*!
+        * @brief Set the quality of light gradients
+        * @param size : Width in pixels of the texture holding the radial gradient of lights. Clamped between 8 and 1024.
+        *
+        */
+        void setGradientSize(unsigned int size);
+
+        /*!
+        * @brief Set the area in which static lights are baked
+        * @param area : Area in world units. An empty area disables baking, static lights are then drawn like dynamic ones.
+        * @param texels_per_unit : Resolution of the baked texture. Default is 0.25, one texel every 4 world units.
+        *
+        * Static lights out of the area are drawn like dynamic ones.
+        *
+        */
+        void setStaticArea(const sf::FloatRect& area, float texels_per_unit = 0.25f);
+
+        /*!
+        * @brief Multiply the light map over a render target
+        * @param target : Render target containing the scene to light. Its view is modified.
+        * @param view : View the scene has been drawn with.
+        *
+        * Rebakes static lights if needed, re-renders the light map if anything changed since the previous call, then draws it over the whole target with a multiplicative blend.
+        *
+        */
+        void render(sf::RenderTarget& target, const sf::View& view);
+
+        /*!
+        * @brief Get number of times the light map has been re-rendered
+        * @return Number of light map renderings since creation
+        *
+        * Allows to check that frames without light or view change reuse the light map. <br>
+        * Constant method.
+        *
+        */
+        std::size_t getRenderCount() const;
+
+    protected:
+        /*!
+        * @brief Point light
+        */
+        struct Light
+        {
+            sf::Vector2f position; /*!< Center of the light. */
+            float radius; /*!< Distance at which light fades out. */
+            sf::Color color; /*!< Color of the light at its center. */
+            bool is_static; /*!< Whether light can be baked. */
+            bool alive; /*!< Whether identifier is associated with a light. */
+        };
+
+        std::vector<Light> m_lights; /*!< Lights indexed by identifier. */
+        std::vector<LightId> m_free_ids; /*!< Identifiers available for reuse. */
+        sf::Color m_ambient_color; /*!< Light received everywhere. */
+        float m_resolution_scale; /*!< Size of the light map relatively to the target. */
+        unsigned int m_gradient_size; /*!< Width of the gradient texture. */
+        sf::FloatRect m_static_area; /*!< Area in which static lights are baked. */
+        float m_static_density; /*!< Texels per world unit of the baked texture. */
+
+        sf::Texture m_gradient; /*!< Radial gradient shared by all lights. */
+        sf::RenderTexture m_static_map; /*!< Static lights baked in world space. */
+        sf::RenderTexture m_light_map; /*!< Lights of the current view. */
+        std::vector<sf::Vertex> m_vertices; /*!< Quads of the lights drawn into a map. Keeps its capacity. */
+        bool m_gradient_outdated; /*!< Flag indicating gradient texture must be regenerated. */
+        bool m_static_outdated; /*!< Flag indicating static lights must be rebaked. */
+        bool m_light_map_outdated; /*!< Flag indicating light map must be re-rendered. */
+        bool m_static_map_valid; /*!< Flag indicating static map holds baked lights. */
+        sf::Vector2f m_view_center; /*!< Center of the view of last rendering. */
+        sf::Vector2f m_view_size; /*!< Size of the view of last rendering. */
+        float m_view_rotation; /*!< Rotation of the view of last rendering. */
+        std::size_t m_render_count; /*!< Number of light map renderings. */
+
+        /*!
+        * @brief Tell if a light is baked into the static map
+        * @param light : Light to check.
+        * @return True if light is static and inside the static area
+        *
+        * Constant method.
+        *
+        */
+        bool isBaked(const Light& light) const;
+
+        /*!
+        * @brief Flag maps affected by a change of a light
+        * @param light : Changed light.
+        *
+        */
+        void invalidate(const Light& light);
+
+        /*!
+        * @brief Regenerate the radial gradient texture
+        *
+        */
+        void updateGradient();
+
+        /*!
+        * @brief Bake static lights into the static map
+        *
+        */
+        void bakeStaticLights();
+
+        /*!
+        * @brief Append the quad of a light to the vertex buffer
+        * @param light : Light to append.
+        *
+        */
+        void appendLight(const Light& light);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
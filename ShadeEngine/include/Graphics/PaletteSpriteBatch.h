@@ -0,0 +1,254 @@
+/*!
+ * @file PaletteSpriteBatch.h
+ * @brief Class used to draw palette-swapped sprites in a single draw call.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a sprite batch drawing indexed textures through a palette lookup shader. <br>
+ * Indexed textures store a palette entry in their red channel. Palettes are the rows of a lookup texture and each sprite selects its row, so that one indexed texture serves every palette.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef PALETTE_SPRITE_BATCH_H
+#define PALETTE_SPRITE_BATCH_H
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+#include "SpriteBatch.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class PaletteSpriteBatch
+    * \brief Class allowing to draw palette-swapped sprites with a single draw call.
+    *
+    * Definition of a class batching sprites using indexed textures and drawing them with a palette lookup shader. <br>
+    * The palette of a sprite is stored in the red channel of its vertex color, so sprites with different palettes still share a batch as long as they share a texture. <br>
+    * The alpha of the sprite color is kept as opacity. Tints such as a damage flash are expressed as additional palette rows. <br>
+    * Requires shader support, see isAvailable. Without it, or without palettes, sprites are refused rather than drawn with their raw palette color. <br>
+    * Standalone: widgets opt in by drawing their indexed sprites through it, SpriteLayersRenderer does not use it.
+    *
+    */
+    class PaletteSpriteBatch
+    {
+    public:
+        static const unsigned int PALETTE_SIZE; /*!< Number of entries of a palette, which is the width of palette textures. */
+
+        /*!
+        * @brief Constructor of the PaletteSpriteBatch class
+        *
+        * Compiles the palette lookup shader. Creates an empty batch without palettes.
+        *
+        */
+        PaletteSpriteBatch();
+
+        /*!
+        * @brief Check whether the palette lookup shader can be used
+        * @return True if shader has been compiled
+        *
+        * Constant method.
+        *
+        */
+        bool isValid() const;
+
+        /*!
+        * @brief Set texture holding palettes
+        * @param palettes : Palette texture, one palette per row of PALETTE_SIZE pixels. Smoothing must be disabled.
+        *
+        * Pending sprites must be flushed before palettes are changed.
+        *
+        */
+        void setPalettes(const std::shared_ptr<const sf::Texture>& palettes);
+
+        /*!
+        * @brief Get texture holding palettes
+        * @return Palette texture or NULL if none has been set
+        *
+        * Constant method.
+        *
+        */
+        const std::shared_ptr<const sf::Texture>& getPalettes() const;
+
+        /*!
+        * @brief Get number of palettes
+        * @return Number of rows of the palette texture
+        *
+        * Constant method.
+        *
+        */
+        unsigned int getPaletteCount() const;
+
+        /*!
+        * @brief Add a sprite to the batch
+        * @param target : Render target in which the pending batch is drawn if sprite texture differs from batch texture.
+        * @param sprite : Sprite using an indexed texture.
+        * @param palette : Row of the palette texture used to color the sprite.
+        * @param states : Render states used to draw the pending batch. Texture and shader are overwritten. Default is default render states.
+        * @return False if shader is not available, no palettes are set or palette is not lower than getPaletteCount(). Sprite is not drawn.
+        *
+        */
+        bool draw(sf::RenderTarget& target, const sf::Sprite& sprite, uint8_t palette, const sf::RenderStates& states = sf::RenderStates::Default);
+
+        /*!
+        * @brief Add a sprite to the batch with an additional transform
+        * @param target : Render target in which the pending batch is drawn if sprite texture differs from batch texture.
+        * @param sprite : Sprite using an indexed texture.
+        * @param palette : Row of the palette texture used to color the sprite.
+        * @param transform : Transform applied on top of sprite transform.
+        * @param states : Render states used to draw the pending batch. Texture and shader are overwritten. Default is default render states.
+        * @return False if shader is not available, no palettes are set or palette is not lower than getPaletteCount(). Sprite is not drawn.
+        *
+        */
+        bool draw(sf::RenderTarget& target, const sf::Sprite& sprite, uint8_t palette, const sf::Transform& transform, const sf::RenderStates& states = sf::RenderStates::Default);
+
+        /*!
+        * @brief Draw pending sprites
+        * @param target : Render target in which the batch is drawn.
+        * @param states : Render states used to draw. Texture and shader are overwritten. Default is default render states.
+        *
+        * Batch is empty after this call.
+        *
+        */
+        void flush(sf::RenderTarget& target, const sf::RenderStates& states = sf::RenderStates::Default);
+
+        /*!
+        * @brief Get number of draw calls issued since creation
+        * @return Number of draw calls
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getDrawCallCount() const;
+
+        /*!
+        * @brief Check whether the graphics driver supports shaders
+        * @return True if shaders are supported
+        *
+        * Static method.
+        *
+        */
+        static bool isAvailable();
+
+        /*!
+        * @brief Build a palette texture image
+        * @param palettes : Colors of each palette. Entries beyond PALETTE_SIZE are ignored, missing entries are transparent.
+        * @return Image with one row per palette
+        *
+        * Static method.
+        *
+        */
+        static sf::Image createPaletteImage(const std::vector< std::vector<sf::Color> >& palettes);
+
+        /*!
+        * @brief Convert a colored image into an indexed image
+        * @param source : Colored image, for example the texture of a character in its default palette.
+        * @param palette : Palette the source image is drawn with.
+        * @param indexed : Image receiving palette entries in red channel. Fully transparent pixels stay transparent.
+        * @return False if the source uses a color that is not in the palette
+        *
+        * Static method.
+        *
+        */
+        static bool createIndexedImage(const sf::Image& source, const std::vector<sf::Color>& palette, sf::Image& indexed);
+
+    protected:
+        SpriteBatch m_batch; /*!< Batch accumulating the quads of pending sprites. */
+        sf::Shader m_shader; /*!< Palette lookup shader. */
+        bool m_shader_loaded; /*!< Whether palette lookup shader has been compiled. */
+        std::shared_ptr<const sf::Texture> m_palettes; /*!< Texture holding one palette per row. */
+
+        /*!
+        * @brief Build render states drawing through the palette lookup shader
+        * @param states : Render states provided by the caller.
+        * @return Render states using palette lookup shader
+        *
+        * Constant method.
+        *
+        */
+        sf::RenderStates getPaletteStates(const sf::RenderStates& states) const;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
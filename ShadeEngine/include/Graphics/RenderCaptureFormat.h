@@ -0,0 +1,193 @@
+/*!
+ * @file RenderCaptureFormat.h
+ * @brief Binary layout of render capture files.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the records composing render capture files. <br>
+ * A capture file is made of a header followed by a stream of records, each one starting with its type and payload size. <br>
+ * Records describe scene updates (textures, layers, chunks, sorting modes) and frames (camera state and scene graph sprites drawn). Values are stored in little endian and records are not aligned.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef RENDER_CAPTURE_FORMAT_H
+#define RENDER_CAPTURE_FORMAT_H
+
+#include <stdint.h>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    const uint32_t RENDER_CAPTURE_MAGIC = 0x43524853; /*!< "SHRC" in little endian. */
+    const uint16_t RENDER_CAPTURE_VERSION = 1; /*!< Current version of capture files. */
+    const uint32_t RENDER_CAPTURE_NO_TEXTURE = 0xFFFFFFFF; /*!< Texture identifier of sprites without texture. */
+
+    /*!
+    * @brief Types of capture records
+    */
+    enum RenderCaptureRecordType
+    {
+        CAPTURE_TEXTURE = 1, /*!< CaptureTextureRecord followed by texture key. Declares a texture before its first use. */
+        CAPTURE_LAYERS = 2, /*!< Sprite layers replacing the layers array. */
+        CAPTURE_CHUNK_ATTACH = 3, /*!< Chunk key (uint64_t) followed by sprite layers. */
+        CAPTURE_CHUNK_DETACH = 4, /*!< Chunk key (uint64_t). */
+        CAPTURE_SORT_MODE = 5, /*!< Layer index (uint32_t) followed by sort mode (uint32_t). */
+        CAPTURE_FRAME = 6 /*!< CaptureFrameRecord followed by parallax factors (float) and CaptureOverlaySpriteRecord. Rendering of a frame. */
+    };
+
+    /*!
+    * @brief Header of capture files
+    */
+    struct RenderCaptureHeader
+    {
+        uint32_t magic; /*!< RENDER_CAPTURE_MAGIC. */
+        uint16_t version; /*!< RENDER_CAPTURE_VERSION. */
+        uint16_t reserved; /*!< Unused. Must be 0. */
+    };
+
+    /*!
+    * @brief Header of every record
+    *
+    * Sprite layers payloads are made of a layer count (uint32_t) then, for each layer, a sprite count (uint32_t) followed by CaptureSpriteRecord.
+    */
+    struct RenderCaptureRecordHeader
+    {
+        uint32_t type; /*!< Record type, one of RenderCaptureRecordType. Unknown types are skipped. */
+        uint32_t size; /*!< Size of payload following the header in bytes. */
+    };
+
+    /*!
+    * @brief Texture used by captured sprites
+    */
+    struct CaptureTextureRecord
+    {
+        uint32_t id; /*!< Identifier of the texture in sprite records. */
+        uint32_t width; /*!< Width of the texture in pixels. */
+        uint32_t height; /*!< Height of the texture in pixels. */
+        uint32_t key_length; /*!< Length of the key following the record. Key is the SharedResources key of the texture, empty if unknown. */
+    };
+
+    /*!
+    * @brief Sprite of layers and chunks
+    */
+    struct CaptureSpriteRecord
+    {
+        uint32_t texture; /*!< Identifier of the texture or RENDER_CAPTURE_NO_TEXTURE. */
+        int32_t rect[4]; /*!< Texture rect: left, top, width, height. */
+        uint32_t color; /*!< Color as RGBA integer. */
+        float position[2]; /*!< Position. */
+        float origin[2]; /*!< Origin. */
+        float scale[2]; /*!< Scale. */
+        float rotation; /*!< Rotation in degrees. */
+    };
+
+    /*!
+    * @brief Sprite of scene graph nodes, with its whole transform
+    */
+    struct CaptureOverlaySpriteRecord
+    {
+        uint32_t layer; /*!< Layer the sprite is drawn on top of. */
+        uint32_t texture; /*!< Identifier of the texture or RENDER_CAPTURE_NO_TEXTURE. */
+        int32_t rect[4]; /*!< Texture rect: left, top, width, height. */
+        uint32_t color; /*!< Color as RGBA integer. */
+        float transform[6]; /*!< Affine transform combining node and sprite transforms, row major: a00 a01 a02 a10 a11 a12. */
+    };
+
+    /*!
+    * @brief Frame rendering
+    */
+    struct CaptureFrameRecord
+    {
+        uint32_t width; /*!< Width of the render target in pixels. */
+        uint32_t height; /*!< Height of the render target in pixels. */
+        float center[2]; /*!< Camera center. Ignored if camera is not positioned. */
+        float zoom; /*!< Camera zoom. */
+        uint8_t positioned; /*!< 1 if camera has been positioned, 0 if it uses the default view. */
+        uint8_t pixel_snapping; /*!< 1 if camera snaps views on pixels. */
+        uint16_t reserved; /*!< Unused. Must be 0. */
+        uint32_t parallax_count; /*!< Number of parallax factors following the record, one per layer. */
+        uint32_t overlay_sprite_count; /*!< Number of overlay sprite records following parallax factors. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
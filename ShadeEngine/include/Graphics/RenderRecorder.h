@@ -0,0 +1,315 @@
+/*!
+ * @file RenderRecorder.h
+ * @brief Class used to capture the workload of a sprite layers renderer.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a recorder writing scene updates and frames submitted to a SpriteLayersRenderer into a capture file. <br>
+ * Captures can be replayed headlessly by the RenderReplay tool to compare renderer changes on identical workloads.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef RENDER_RECORDER_H
+#define RENDER_RECORDER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <QFile>
+#include <QString>
+#include <SFML/Graphics.hpp>
+
+#include "RenderCaptureFormat.h"
+#include "SpriteLayersRenderer.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class RenderRecorder
+    * \brief Class allowing to record rendering workload into a capture file.
+    *
+    * Definition of a class encoding the inputs of a SpriteLayersRenderer in the capture format. <br>
+    * Records are buffered in memory and full buffers are written by a background thread, so that recording never waits for the disk. <br>
+    * Textures are identified by their SharedResources key so that the replay can reload them. A cached texture destroyed since its declaration is declared again under a new identifier, even when a new texture reuses its address. <br>
+    * Not thread safe.
+    *
+    */
+    class RenderRecorder
+    {
+    public:
+        /*!
+        * @brief Constructor of the RenderRecorder class
+        * @param path : Path of the capture file. Overwritten if it exists.
+        *
+        * Opens the file and writes the capture header. Use isOpen to check the file could be created.
+        *
+        */
+        explicit RenderRecorder(const QString& path);
+
+        /*!
+        * @brief Destructor of the RenderRecorder class
+        *
+        * Writes buffered records, waits for the background thread and closes the file.
+        *
+        */
+        ~RenderRecorder();
+
+        /*!
+        * @brief Tell if capture file is open
+        * @return True if records can be written
+        *
+        * Constant method.
+        *
+        */
+        bool isOpen() const;
+
+        /*!
+        * @brief Record a replacement of the layers array
+        * @param sprite_layers : New sprite layers.
+        *
+        */
+        void recordLayers(const std::vector< std::vector<sf::Sprite> >& sprite_layers);
+
+        /*!
+        * @brief Record the whole content of a renderer
+        * @param renderer : Renderer whose layers, chunks and sorting modes are recorded.
+        *
+        * Called when recording starts so that the replay starts from the same scene.
+        *
+        */
+        void recordState(const SpriteLayersRenderer& renderer);
+
+        /*!
+        * @brief Record the attachment of a chunk
+        * @param key : Identifier of the chunk.
+        * @param chunk_layers : Sprite layers of the chunk.
+        *
+        */
+        void recordChunkAttach(quint64 key, const std::vector< std::vector<sf::Sprite> >& chunk_layers);
+
+        /*!
+        * @brief Record the detachment of a chunk
+        * @param key : Identifier of the chunk.
+        *
+        */
+        void recordChunkDetach(quint64 key);
+
+        /*!
+        * @brief Record a change of layer sorting mode
+        * @param layer : Index of the layer.
+        * @param mode : New sorting mode.
+        *
+        */
+        void recordSortMode(std::size_t layer, LayerSortMode mode);
+
+        /*!
+        * @brief Record the rendering of a frame
+        * @param renderer : Renderer that has just rendered the frame.
+        * @param target_size : Size of the render target in pixels.
+        *
+        * Stores camera state and sprites of scene graph nodes, which change without going through the other record methods.
+        *
+        */
+        void recordFrame(SpriteLayersRenderer& renderer, const sf::Vector2u& target_size);
+
+        /*!
+        * @brief Hand buffered records to the background thread
+        * @return False if file is not open or a previous write failed
+        *
+        * Does not wait for records to be written.
+        *
+        */
+        bool flush();
+
+        /*!
+        * @brief Get number of recorded frames
+        * @return Number of frames
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getFrameCount() const;
+
+    protected:
+        static const std::size_t FLUSH_THRESHOLD = 1024 * 1024; /*!< Size of buffered records triggering a write. */
+
+        /*!
+        * @brief Texture already declared
+        */
+        struct DeclaredTexture
+        {
+            uint32_t id; /*!< Identifier of the texture in records. */
+            sf::Vector2u size; /*!< Size of the texture when declared. */
+            bool cached; /*!< Whether texture was in the SharedResources cache when declared. */
+            std::weak_ptr<const sf::Texture> cached_texture; /*!< Cached texture. Expires when it is destroyed. */
+        };
+
+        QFile m_file; /*!< Capture file. Only written by the background thread. */
+        std::vector<uint8_t> m_buffer; /*!< Records not yet handed to the background thread. */
+        std::unordered_map<const sf::Texture*, DeclaredTexture> m_texture_ids; /*!< Declaration of each texture address. */
+        uint32_t m_next_texture_id; /*!< Identifier of the next declared texture. */
+        uint64_t m_frame_count; /*!< Number of recorded frames. */
+
+        std::thread m_writer; /*!< Background thread writing buffers. */
+        std::mutex m_writer_mutex; /*!< Mutex protecting pending and free buffers. */
+        std::condition_variable m_writer_condition; /*!< Condition notified when a buffer is pending or writer must stop. */
+        std::deque< std::vector<uint8_t> > m_pending_buffers; /*!< Buffers waiting to be written. */
+        std::vector< std::vector<uint8_t> > m_free_buffers; /*!< Written buffers, reused to avoid allocations. */
+        bool m_stopping; /*!< Flag indicating writer must stop once pending buffers are written. */
+        std::atomic<bool> m_write_failed; /*!< Whether a write failed. */
+
+        /*!
+        * @brief Main loop of the background thread
+        *
+        */
+        void writerLoop();
+
+        /*!
+        * @brief Append bytes to buffer
+        * @param data : Bytes to append.
+        * @param size : Number of bytes.
+        *
+        */
+        void append(const void* data, std::size_t size);
+
+        /*!
+        * @brief Start a record
+        * @param type : Type of the record.
+        * @return Offset of the record header in buffer, used to finish it
+        *
+        */
+        std::size_t beginRecord(RenderCaptureRecordType type);
+
+        /*!
+        * @brief Finish a record by writing its payload size
+        * @param header_offset : Offset returned by beginRecord.
+        *
+        * Writes buffer to file if it grew beyond threshold.
+        *
+        */
+        void endRecord(std::size_t header_offset);
+
+        /*!
+        * @brief Get identifier of a texture, declaring it if needed
+        * @param texture : Texture of a sprite. May be NULL.
+        * @return Identifier of the texture
+        *
+        * Texture declarations are full records, so it must not be called while a record is in progress.
+        *
+        */
+        uint32_t getTextureId(const sf::Texture* texture);
+
+        /*!
+        * @brief Get identifier of a texture declared by getTextureId
+        * @param texture : Texture of a sprite. May be NULL.
+        * @return Identifier of the texture
+        *
+        * Never declares, so it can be called while a record is in progress. <br>
+        * Constant method.
+        *
+        */
+        uint32_t findTextureId(const sf::Texture* texture) const;
+
+        /*!
+        * @brief Declare textures of sprite layers
+        * @param sprite_layers : Sprite layers about to be recorded.
+        *
+        */
+        void declareTextures(const std::vector< std::vector<sf::Sprite> >& sprite_layers);
+
+        /*!
+        * @brief Append sprite layers payload
+        * @param sprite_layers : Sprite layers whose textures have been declared.
+        *
+        */
+        void appendLayers(const std::vector< std::vector<sf::Sprite> >& sprite_layers);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,331 @@
+/*!
+ * @file SceneGraph.h
+ * @brief Class used to organize sprites as a hierarchy of nodes.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a scene graph in which each node is positioned relatively to its parent. <br>
+ * Moving a node moves its whole subtree (for example a character with its equipment, shadow and name tag). <br>
+ * Nodes are stored in flat arrays sorted by depth so that world transforms are updated in a single linear sweep, only for dirty subtrees.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef SCENE_GRAPH_H
+#define SCENE_GRAPH_H
+
+#include <functional>
+#include <stdint.h>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class SceneGraph
+    * \brief Class allowing to manage a hierarchy of transformed nodes carrying sprites.
+    *
+    * Definition of a class storing parent/child nodes and caching their world transforms. <br>
+    * Nodes are referenced by stable identifiers. Internally, a node is stored at an index such that parents always come before children. <br>
+    * Created nodes are appended. Reparenting under a node stored after the moved one moves its subtree right after the new parent. Destroyed nodes are removed on next update. <br>
+    * Sprites of a layer are drawn in storage order. Transform changes and reparenting only mark the node dirty, so that only dirty subtrees are recomputed.
+    *
+    */
+    class SceneGraph
+    {
+    public:
+        typedef uint32_t NodeId; /*!< Stable identifier of a node. */
+
+        static const NodeId ROOT = 0; /*!< Identifier of the root node. Always exists and keeps identity transform. */
+        static const NodeId INVALID_NODE = 0xFFFFFFFF; /*!< Identifier never associated with a node. */
+
+        /*!
+        * @brief Constructor of the SceneGraph class
+        *
+        * Creates a graph containing only the root node.
+        *
+        */
+        SceneGraph();
+
+        /*!
+        * @brief Create a node
+        * @param parent : Parent of the new node. Default is root.
+        * @return Identifier of the new node or INVALID_NODE if parent does not exist
+        *
+        */
+        NodeId createNode(NodeId parent = ROOT);
+
+        /*!
+        * @brief Destroy a node and all its descendants
+        * @param node : Node to destroy. Root cannot be destroyed.
+        *
+        * Linear in the number of nodes stored after node. Identifiers of destroyed nodes may be reused by creations following next update.
+        *
+        */
+        void destroyNode(NodeId node);
+
+        /*!
+        * @brief Attach a node to a new parent
+        * @param node : Node to move in hierarchy.
+        * @param parent : New parent. Must not be a descendant of node.
+        * @return False if nodes do not exist or if reparenting would create a cycle
+        *
+        * Local transform is kept, so world position of the node follows its new parent. <br>
+        * Linear in the number of nodes when the new parent is stored after node, constant otherwise.
+        *
+        */
+        bool setParent(NodeId node, NodeId parent);
+
+        /*!
+        * @brief Check if a node exists
+        * @param node : Node identifier.
+        * @return True if node has been created and not destroyed
+        *
+        * Constant method.
+        *
+        */
+        bool isValid(NodeId node) const;
+
+        /*!
+        * @brief Set position of node relatively to its parent
+        * @param node : Node to move. Root cannot be moved.
+        * @param position : New local position.
+        *
+        */
+        void setPosition(NodeId node, const sf::Vector2f& position);
+
+        /*!
+        * @brief Set rotation of node relatively to its parent
+        * @param node : Node to rotate. Root cannot be rotated.
+        * @param angle : New local rotation in degrees.
+        *
+        */
+        void setRotation(NodeId node, float angle);
+
+        /*!
+        * @brief Set scale of node relatively to its parent
+        * @param node : Node to scale. Root cannot be scaled.
+        * @param factors : New local scale factors.
+        *
+        */
+        void setScale(NodeId node, const sf::Vector2f& factors);
+
+        /*!
+        * @brief Set origin of node local transformations
+        * @param node : Node to modify. Root origin cannot be changed.
+        * @param origin : New local origin.
+        *
+        */
+        void setOrigin(NodeId node, const sf::Vector2f& origin);
+
+        /*!
+        * @brief Get transformation of node relatively to its parent
+        * @param node : Node identifier.
+        * @return Local transformable of the node
+        *
+        * Constant method.
+        *
+        */
+        const sf::Transformable& getLocalTransformable(NodeId node) const;
+
+        /*!
+        * @brief Get cached world transform of node
+        * @param node : Node identifier.
+        * @return Transform from node local space to world space
+        *
+        * Value is the one computed by the last call to update. <br>
+        * Constant method.
+        *
+        */
+        const sf::Transform& getWorldTransform(NodeId node) const;
+
+        /*!
+        * @brief Attach a sprite to a node
+        * @param node : Node carrying the sprite.
+        * @param sprite : Sprite drawn with node world transform. Its own transform is applied in node local space.
+        * @param layer : Index of the rendering layer in which sprite is drawn.
+        *
+        */
+        void setSprite(NodeId node, const sf::Sprite& sprite, std::size_t layer);
+
+        /*!
+        * @brief Detach sprite of a node
+        * @param node : Node carrying the sprite.
+        *
+        */
+        void clearSprite(NodeId node);
+
+        /*!
+        * @brief Get number of layers containing sprites attached to nodes
+        * @return Highest layer index used plus one
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getLayerCount() const;
+
+        /*!
+        * @brief Update cached world transforms
+        *
+        * Removes destroyed nodes, then recomputes world transforms of dirty nodes and of their descendants in a single sweep.
+        *
+        */
+        void update();
+
+        /*!
+        * @brief Draw sprites of a layer
+        * @param target : Render target to draw in.
+        * @param layer : Index of the layer to draw.
+        * @param states : Render states combined with node transforms. Default is default render states.
+        *
+        * Only visits nodes carrying a sprite on this layer. World transforms must have been updated before. <br>
+        * Constant method.
+        *
+        */
+        void draw(sf::RenderTarget& target, std::size_t layer, sf::RenderStates states = sf::RenderStates::Default) const;
+
+        /*!
+        * @brief Visit sprites attached to nodes
+        * @param visitor : Function called with layer, sprite and node world transform of each sprite, in drawing order.
+        *
+        * World transforms must have been updated before. <br>
+        * Constant method.
+        *
+        */
+        void forEachSprite(const std::function<void(std::size_t layer, const sf::Sprite& sprite, const sf::Transform& world_transform)>& visitor) const;
+
+        /*!
+        * @brief Find the topmost node of a layer whose sprite passes a test
+        * @param layer : Index of the layer.
+        * @param hit_test : Function called with sprite and node world transform, from the last drawn sprite to the first, until it returns true.
+        * @return Identifier of the node or INVALID_NODE if no sprite passes the test
+        *
+        * World transforms must have been updated before. <br>
+        * Constant method.
+        *
+        */
+        NodeId findTopmostNode(std::size_t layer, const std::function<bool(const sf::Sprite& sprite, const sf::Transform& world_transform)>& hit_test) const;
+
+    protected:
+        static const int32_t NO_LAYER = -1; /*!< Layer of nodes without sprite. */
+
+        std::vector<NodeId> m_node_ids; /*!< Identifier of node stored at each index. */
+        std::vector<int32_t> m_parent_indexes; /*!< Index of parent of node stored at each index. -1 for root. */
+        std::vector<sf::Transformable> m_local_transforms; /*!< Transform of each node relatively to its parent. */
+        std::vector<sf::Transform> m_world_transforms; /*!< Cached transform of each node relatively to the world. */
+        std::vector<uint8_t> m_dirty; /*!< Flags indicating nodes whose world transform must be recomputed. */
+        std::vector<uint8_t> m_destroyed; /*!< Flags indicating nodes destroyed since last update. */
+        std::vector<int32_t> m_sprite_layers; /*!< Layer of the sprite attached to each node or NO_LAYER. */
+        std::vector<sf::Sprite> m_sprites; /*!< Sprite attached to each node. */
+
+        std::vector<uint32_t> m_node_indexes; /*!< Index at which each node identifier is stored. INVALID_NODE if identifier is free. */
+        std::vector<NodeId> m_free_ids; /*!< Identifiers available for reuse. */
+        std::vector< std::vector<uint32_t> > m_layer_nodes; /*!< Indexes of nodes carrying a sprite, per layer, sorted. */
+        std::size_t m_layer_count; /*!< Highest layer index used plus one. */
+        bool m_nodes_destroyed; /*!< Flag indicating destroyed nodes must be removed. */
+
+        /*!
+        * @brief Store nodes in a new order
+        * @param order : Old index of each node kept, parents first. Nodes left out are removed and their identifiers released.
+        *
+        * Permutes all arrays, keeping dirty flags, then rebuilds sprite lists of layers.
+        *
+        */
+        void applyOrder(const std::vector<uint32_t>& order);
+
+        /*!
+        * @brief Add a node to the sprite list of its layer
+        * @param index : Index of the node.
+        *
+        */
+        void addToLayer(uint32_t index);
+
+        /*!
+        * @brief Remove a node from the sprite list of its layer
+        * @param index : Index of the node.
+        *
+        */
+        void removeFromLayer(uint32_t index);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,244 @@
+/*!
+ * @file SharedResources.h
+ * @brief Class used to share GPU resources between rendering widgets.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a process wide cache of textures and static geometry. <br>
+ * SFML makes every window context share its objects with all others, so a texture uploaded once can be drawn in every widget. This cache makes sure each resource is only uploaded once.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef SHARED_RESOURCES_H
+#define SHARED_RESOURCES_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <SFML/Graphics.hpp>
+
+#include "AlphaMask.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class SharedResources
+    * \brief Class allowing rendering widgets to share textures and static geometry.
+    *
+    * Definition of a class storing resources used by several AbstractShadeWidget instances, such as the viewports of an editor. <br>
+    * Resources are identified by a key (the file path for textures loaded from disk) and handed out as shared pointers. A resource stays in the cache until releaseUnused is called while no one else holds it. <br>
+    * All methods are thread safe.
+    *
+    */
+    class SharedResources
+    {
+    public:
+        /*!
+        * @brief Get the resources shared by all widgets of the process
+        * @return Process wide resources
+        *
+        * Static method.
+        *
+        */
+        static SharedResources& getInstance();
+
+        /*!
+        * @brief Get a texture loaded from a file
+        * @param path : Path of the texture file, used as key.
+        * @return Texture or NULL if file could not be loaded
+        *
+        * The file is loaded and uploaded the first time it is requested only. Loading is done without holding the lock. <br>
+        * If two threads request the same new texture at once, both load it but only the first one inserted is kept and returned.
+        *
+        */
+        std::shared_ptr<const sf::Texture> getTexture(const std::string& path);
+
+        /*!
+        * @brief Upload an image as a shared texture
+        * @param key : Key identifying the texture, for example the name of an atlas.
+        * @param image : Pixels of the texture.
+        * @return Texture or NULL if it could not be created
+        *
+        * Replaces the cached texture with the same key. Holders of the previous texture keep it alive until they release it.
+        *
+        */
+        std::shared_ptr<const sf::Texture> addTexture(const std::string& key, const sf::Image& image);
+
+        /*!
+        * @brief Find key of a cached texture
+        * @param texture : Texture to look for.
+        * @param cached_texture : Set to the cached texture if found, so that callers can tell when it is destroyed. Default is NULL.
+        * @return Key of the texture or an empty string if texture is not in the cache
+        *
+        * Linear in the number of cached textures.
+        *
+        */
+        std::string findTextureKey(const sf::Texture* texture, std::weak_ptr<const sf::Texture>* cached_texture = NULL);
+
+        /*!
+        * @brief Get opacity mask of a cached texture
+        * @param texture : Texture whose mask is requested.
+        * @return Mask or NULL if texture is not in the cache
+        *
+        * The mask is computed the first time it is requested, by reading texture pixels back, then kept as long as the texture lives. <br>
+        * Textures not in the cache are remembered until a texture is added, so repeated lookups do not scan the cache.
+        *
+        */
+        std::shared_ptr<const AlphaMask> getAlphaMask(const sf::Texture* texture);
+
+        /*!
+        * @brief Store static geometry shared between widgets
+        * @param key : Key identifying the geometry.
+        * @param vertices : Vertices of the geometry. Moved into the cache.
+        * @return Shared geometry
+        *
+        * Replaces the cached geometry with the same key.
+        *
+        */
+        std::shared_ptr<const sf::VertexArray> addVertexArray(const std::string& key, sf::VertexArray vertices);
+
+        /*!
+        * @brief Find shared geometry
+        * @param key : Key identifying the geometry.
+        * @return Geometry or NULL if no geometry is stored with this key
+        *
+        */
+        std::shared_ptr<const sf::VertexArray> findVertexArray(const std::string& key);
+
+        /*!
+        * @brief Release resources not used outside the cache
+        *
+        * Call it after a scene change to free the textures of the previous scene.
+        *
+        */
+        void releaseUnused();
+
+        /*!
+        * @brief Release every resource of the cache
+        *
+        * Call it before leaving main. The process wide instance is destroyed during static destruction, when SFML may already be shut down. <br>
+        * Holders of resources keep them alive until they release them.
+        *
+        */
+        void releaseAll();
+
+        /*!
+        * @brief Get number of textures in the cache
+        * @return Number of cached textures
+        *
+        */
+        std::size_t getTextureCount();
+
+        /*!
+        * @brief Get number of textures uploaded since start
+        * @return Number of texture uploads
+        *
+        * Allows to check that a texture used by several widgets is uploaded once.
+        *
+        */
+        std::size_t getUploadCount();
+
+    protected:
+        std::mutex m_mutex; /*!< Mutex protecting the access to resources. */
+        std::map< std::string, std::shared_ptr<const sf::Texture> > m_textures; /*!< Cached textures indexed by key. */
+        std::map< std::string, std::shared_ptr<const sf::VertexArray> > m_vertex_arrays; /*!< Cached geometries indexed by key. */
+        std::map< const sf::Texture*, std::pair< std::weak_ptr<const sf::Texture>, std::shared_ptr<const AlphaMask> > > m_alpha_masks; /*!< Opacity masks indexed by texture. Weak pointer detects textures destroyed since. */
+        std::set<const sf::Texture*> m_unknown_textures; /*!< Textures found missing from the cache by getAlphaMask since last texture addition. */
+        std::size_t m_upload_count; /*!< Number of texture uploads since start. */
+
+        /*!
+        * @brief Constructor of the SharedResources class
+        *
+        * Protected so that only the process wide instance exists.
+        *
+        */
+        SharedResources();
+
+        SharedResources(const SharedResources&) = delete;
+        SharedResources& operator=(const SharedResources&) = delete;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
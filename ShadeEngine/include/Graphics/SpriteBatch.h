@@ -0,0 +1,165 @@
+/*!
+ * @file SpriteBatch.h
+ * @brief Class used to merge consecutive sprites sharing a texture into a single draw call.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a sprite batch accumulating sprites as textured quads. <br>
+ * As long as consecutive sprites use the same texture they are appended to the same vertex array. The batch is drawn when the texture changes or when it is flushed.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class SpriteBatch
+    * \brief Class allowing to draw runs of same-texture sprites with a single draw call.
+    *
+    * Definition of a class converting sprites into quads of a shared vertex buffer. <br>
+    * Rendering order is preserved: sprites are drawn exactly as if they were drawn one after another. <br>
+    * The vertex buffer keeps its capacity between frames so that steady state batching does not allocate.
+    *
+    */
+    class SpriteBatch
+    {
+    public:
+        /*!
+        * @brief Constructor of the SpriteBatch class
+        *
+        * Creates an empty batch.
+        *
+        */
+        SpriteBatch();
+
+        /*!
+        * @brief Add a sprite to the batch
+        * @param target : Render target in which the pending batch is drawn if sprite texture differs from batch texture.
+        * @param sprite : Sprite to add.
+        * @param states : Render states used to draw the pending batch. Texture is overwritten by batch texture. Default is default render states.
+        *
+        */
+        void draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+
+        /*!
+        * @brief Add a sprite to the batch with an additional transform
+        * @param target : Render target in which the pending batch is drawn if sprite texture differs from batch texture.
+        * @param sprite : Sprite to add.
+        * @param transform : Transform applied on top of sprite transform.
+        * @param states : Render states used to draw the pending batch. Texture is overwritten by batch texture. Default is default render states.
+        *
+        */
+        void draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::Transform& transform, const sf::RenderStates& states = sf::RenderStates::Default);
+
+        /*!
+        * @brief Draw pending sprites
+        * @param target : Render target in which the batch is drawn.
+        * @param states : Render states used to draw. Texture is overwritten by batch texture. Default is default render states.
+        *
+        * Batch is empty after this call.
+        *
+        */
+        void flush(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default);
+
+        /*!
+        * @brief Get number of draw calls issued since creation
+        * @return Number of draw calls
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getDrawCallCount() const;
+
+    protected:
+        std::vector<sf::Vertex> m_vertices; /*!< Quads of pending sprites. */
+        const sf::Texture* m_texture; /*!< Texture shared by pending sprites. */
+        std::size_t m_draw_call_count; /*!< Number of draw calls issued since creation. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,347 @@
+/*!
+ * @file SpriteLayersRenderer.h
+ * @brief Class used to render overlapping layers of sprites.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a renderer drawing layers of sprites, world chunks and scene graph sprites through a camera. <br>
+ * It draws into any SFML render target, so that the same rendering code runs in widgets and in headless tools.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef SPRITE_LAYERS_RENDERER_H
+#define SPRITE_LAYERS_RENDERER_H
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+#include <QtGlobal>
+#include <SFML/Graphics.hpp>
+
+#include "Camera.h"
+#include "LightMap.h"
+#include "SceneGraph.h"
+#include "SpriteBatch.h"
+#include "include/Core/FrameArena.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*!
+    * @brief Orders in which sprites of a layer can be drawn
+    */
+    enum LayerSortMode
+    {
+        DRAW_ORDER, /*!< Sprites are drawn in vector order. Default mode. */
+        Y_SORT /*!< Sprites are drawn by increasing bottom coordinate so that sprites lower on screen are drawn over upper ones. */
+    };
+
+    /*! \class SpriteLayersRenderer
+    * \brief Class allowing to render sprites as overlapping layers.
+    *
+    * Definition of a class holding the sprites of a scene and drawing them layer after another. <br>
+    * In each layer, sprites of chunks are drawn first, then sprites of the layers array, then sprites of scene graph nodes. <br>
+    * Not thread safe. Owners shared between threads must protect it.
+    *
+    */
+    class SpriteLayersRenderer
+    {
+    public:
+        typedef std::map< quint64, std::vector< std::vector<sf::Sprite> > > ChunkMap; /*!< Chunks of sprite layers indexed by key. */
+
+        /*!
+        * @brief Constructor of the SpriteLayersRenderer class
+        *
+        * Constructor of the SpriteLayersRenderer class. Renderer starts without any sprite.
+        *
+        */
+        SpriteLayersRenderer();
+
+        /*!
+        * @brief Destructor of the SpriteLayersRenderer class
+        *
+        * Virtual method. Does nothing.
+        *
+        */
+        virtual ~SpriteLayersRenderer() = default;
+
+        /*!
+        * @brief Get scene graph rendered with the layers
+        * @return Scene graph of the renderer
+        *
+        * World transforms are updated once per frame before rendering.
+        *
+        */
+        SceneGraph& getSceneGraph();
+
+        /*!
+        * @brief Get scene graph rendered with the layers
+        * @return Scene graph of the renderer
+        *
+        * Constant method.
+        *
+        */
+        const SceneGraph& getSceneGraph() const;
+
+        /*!
+        * @brief Get camera through which layers are rendered
+        * @return Camera of the renderer
+        *
+        * Camera is updated once per frame before rendering.
+        *
+        */
+        Camera& getCamera();
+
+        /*!
+        * @brief Get camera through which layers are rendered
+        * @return Camera of the renderer
+        *
+        * Constant method.
+        *
+        */
+        const Camera& getCamera() const;
+
+        /*!
+        * @brief Get light map multiplied over lit layers
+        * @return Light map of the renderer
+        *
+        * Only used once lighting is enabled with setLighting.
+        *
+        */
+        LightMap& getLightMap();
+
+        /*!
+        * @brief Enable or disable lighting
+        * @param enabled : True to multiply the light map over the scene.
+        * @param layer : Last lit layer. Light map is applied after this layer is drawn, so that layers above it, such as interfaces, stay unlit. Default is 0.
+        *
+        * If layer is beyond the last layer, lighting is applied after the last layer.
+        *
+        */
+        void setLighting(bool enabled, std::size_t layer = 0);
+
+        /*!
+        * @brief Tell if lighting is enabled
+        * @return True if light map is multiplied over the scene
+        *
+        * Constant method.
+        *
+        */
+        bool isLightingEnabled() const;
+
+        /*!
+        * @brief Replace the layer arrays of sprites
+        * @param sprite_layers : Array of sprite vectors to render. Swapped with the current layers, which are given back to the caller.
+        *
+        * Giving back the previous layers allows the caller to release them outside of any lock.
+        *
+        */
+        void swapLayers(std::vector< std::vector<sf::Sprite> >& sprite_layers);
+
+        /*!
+        * @brief Get the layer arrays of sprites
+        * @return Array of sprite vectors to render
+        *
+        * Constant method.
+        *
+        */
+        const std::vector< std::vector<sf::Sprite> >& getLayers() const;
+
+        /*!
+        * @brief Attach a chunk of sprite layers
+        * @param key : Identifier of the chunk. Replaces the chunk previously attached with the same key.
+        * @param chunk_layers : Array of sprite vectors, one per layer. Swapped with the previous content of the chunk, which is given back to the caller.
+        *
+        */
+        void attachChunk(quint64 key, std::vector< std::vector<sf::Sprite> >& chunk_layers);
+
+        /*!
+        * @brief Detach a chunk of sprite layers
+        * @param key : Identifier of the chunk.
+        * @param chunk_layers : Receives the content of the detached chunk.
+        * @return False if no such chunk is attached
+        *
+        */
+        bool detachChunk(quint64 key, std::vector< std::vector<sf::Sprite> >& chunk_layers);
+
+        /*!
+        * @brief Get attached chunks
+        * @return Chunks indexed by key
+        *
+        * Constant method.
+        *
+        */
+        const ChunkMap& getChunks() const;
+
+        /*!
+        * @brief Set the order in which sprites of a layer are drawn
+        * @param layer : Index of the layer.
+        * @param mode : Sorting mode of the layer.
+        *
+        * Y-sorted layers keep their drawing order from one frame to the next and only fix it incrementally, which is cheap when few sprites move. <br>
+        * Sprites of chunks and scene graph nodes are not sorted.
+        *
+        */
+        void setLayerSortMode(std::size_t layer, LayerSortMode mode);
+
+        /*!
+        * @brief Get the order in which sprites of a layer are drawn
+        * @param layer : Index of the layer.
+        * @return Sorting mode of the layer
+        *
+        * Constant method.
+        *
+        */
+        LayerSortMode getLayerSortMode(std::size_t layer) const;
+
+        /*!
+        * @brief Get the order in which sprites of a Y-sorted layer were last drawn
+        * @param layer : Index of the layer.
+        * @return Indexes of sprites of the layer in drawing order. Empty if layer has not been drawn Y-sorted yet
+        *
+        * Its size differs from the number of sprites of the layer when the layer changed since last render. <br>
+        * Constant method.
+        *
+        */
+        const std::vector<uint32_t>& getLayerDrawOrder(std::size_t layer) const;
+
+        /*!
+        * @brief Get number of layers to render
+        * @return Highest layer index used by layers array, chunks or scene graph, plus one
+        *
+        * Constant method. <br>
+        * Virtual method.
+        *
+        */
+        virtual std::size_t getLayerCount() const;
+
+        /*!
+        * @brief Render all layers
+        * @param target : Render target to draw in. Its view is restored to the default view once done.
+        * @param arena : Arena receiving transient data of the frame.
+        * @param elapsed_seconds : Time elapsed since previous frame, used for camera smoothing.
+        *
+        * Updates scene graph and camera then draws each layer through the camera view. <br>
+        * Sprites out of the camera area are skipped. Consecutive sprites sharing a texture are drawn with a single draw call. <br>
+        * If lighting is enabled, light map is multiplied over the target once the last lit layer is drawn.
+        *
+        */
+        void render(sf::RenderTarget& target, FrameArena& arena, float elapsed_seconds);
+
+    protected:
+        std::vector< std::vector<sf::Sprite> > m_sprite_layers; /*!< List of overlapping layers containing sprites to render. */
+        ChunkMap m_chunks; /*!< Chunks of sprite layers attached to the world. */
+        SceneGraph m_scene_graph; /*!< Hierarchy of nodes whose sprites are rendered with the layers. */
+        Camera m_camera; /*!< Camera defining the rendered part of the world. */
+        std::vector<LayerSortMode> m_layer_sort_modes; /*!< Sorting mode of each layer. Layers beyond vector size use DRAW_ORDER. */
+        std::vector< std::vector<uint32_t> > m_layer_draw_orders; /*!< Indexes of sprites of each Y-sorted layer in drawing order, kept between frames. */
+        SpriteBatch m_sprite_batch; /*!< Batch merging consecutive sprites sharing a texture. */
+        LightMap m_light_map; /*!< Lights multiplied over lit layers. */
+        bool m_lighting_enabled; /*!< Flag indicating light map is applied. */
+        std::size_t m_lighting_layer; /*!< Layer after which light map is applied. */
+
+        /*!
+        * @brief Draw sprites rendered on top of a layer
+        * @param target : Render target to draw in.
+        * @param layer : Index of the layer.
+        *
+        * Draws sprites of scene graph nodes belonging to the layer. <br>
+        * Virtual method.
+        *
+        */
+        virtual void drawLayerOverlay(sf::RenderTarget& target, std::size_t layer);
+
+        /*!
+        * @brief Update drawing order of a Y-sorted layer
+        * @param layer : Index of the layer to sort.
+        * @param arena : Arena receiving sort keys.
+        *
+        * Starts from previous frame order and fixes it with an insertion sort, linear on nearly sorted layers. <br>
+        * Falls back to a full stable sort when too many sprites moved. If the number of sprites of the layer changed, starts from vector order.
+        *
+        */
+        void sortLayer(std::size_t layer, FrameArena& arena);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -69,11 +69,16 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #define SPRITE_LAYERS_WIDGET_H
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <vector>
+#include <QString>
 #include <SFML/Graphics.hpp>
 
 #include "AbstractShadeWidget.h"
+#include "RenderRecorder.h"
+#include "SpriteLayersRenderer.h"
+#include "SpritePicker.h"
 
 /*!
 * @namespace ShadeEngine
@@ -112,6 +117,130 @@ namespace ShadeEngine
         */
         virtual ~SpriteLayersWidget() = default;
 
+        /*!
+        * @brief Get scene graph rendered with the layers
+        * @return Scene graph of the widget
+        *
+        * Sprites attached to scene graph nodes are drawn on top of the sprites of the layer they belong to. <br>
+        * World transforms are updated once per frame before rendering. Scene graph must only be modified from the GUI thread.
+        *
+        */
+        SceneGraph& getSceneGraph();
+
+        /*!
+        * @brief Get camera through which layers are rendered
+        * @return Camera of the widget
+        *
+        * Camera view is applied to each layer with the layer parallax factor. Sprites out of the visible area of their layer are not drawn. <br>
+        * Camera is updated once per frame before rendering. It must only be modified from the GUI thread.
+        *
+        */
+        Camera& getCamera();
+
+        /*!
+        * @brief Get light map multiplied over lit layers
+        * @return Light map of the widget
+        *
+        * Lights are drawn through the camera view of the last lit layer. Light map must only be modified from the GUI thread.
+        *
+        */
+        LightMap& getLightMap();
+
+        /*!
+        * @brief Enable or disable lighting
+        * @param enabled : True to multiply the light map over the scene.
+        * @param layer : Last lit layer. Layers above it stay unlit. Default is 0.
+        *
+        */
+        void setLighting(bool enabled, std::size_t layer = 0);
+
+        /*!
+        * @brief Set the order in which sprites of a layer are drawn
+        * @param layer : Index of the layer.
+        * @param mode : Sorting mode of the layer.
+        *
+        * Y-sorted layers keep their drawing order from one frame to the next and only fix it incrementally, which is cheap when few sprites move. <br>
+        * Sprites attached to scene graph nodes are not sorted and are still drawn on top of layer sprites.
+        *
+        */
+        void setLayerSortMode(std::size_t layer, LayerSortMode mode);
+
+        /*!
+        * @brief Get the order in which sprites of a layer are drawn
+        * @param layer : Index of the layer.
+        * @return Sorting mode of the layer
+        *
+        */
+        LayerSortMode getLayerSortMode(std::size_t layer);
+
+        /*!
+        * @brief Start recording scene updates and frames into a capture file
+        * @param path : Path of the capture file. Overwritten if it exists.
+        * @return True if capture file could be created
+        *
+        * Current content of the layers is recorded first, then every slot call and every rendered frame until recording stops. <br>
+        * Captures are replayed by the RenderReplay tool. Replaces any recording in progress.
+        *
+        */
+        bool startRecording(const QString& path);
+
+        /*!
+        * @brief Stop recording and close capture file
+        *
+        * Does nothing if no recording is in progress.
+        *
+        */
+        void stopRecording();
+
+        /*!
+        * @brief Tell if a recording is in progress
+        * @return True if scene updates and frames are recorded
+        *
+        */
+        bool isRecording();
+
+        /*!
+        * @brief Render the scene at a fixed virtual resolution
+        * @param resolution : Size of the internal render target in pixels, for example 160x144. A null size renders at widget size.
+        * @return True if internal render target could be created
+        *
+        * Layers are rendered into a small internal texture which is then presented with a single blit, scaled by the largest integer factor fitting in the widget and centered. <br>
+        * Remaining area is filled with background color. Fill cost of the scene no longer depends on widget size and pixels stay sharp. <br>
+        * If the widget is smaller than the virtual resolution, the image is presented unscaled and cropped.
+        *
+        */
+        bool setVirtualResolution(const sf::Vector2u& resolution);
+
+        /*!
+        * @brief Get the fixed virtual resolution
+        * @return Size of the internal render target or a null size if scene is rendered at widget size
+        *
+        */
+        sf::Vector2u getVirtualResolution();
+
+        /*!
+        * @brief Get area of the widget in which the scene is presented
+        * @return Area in widget pixels. Whole widget if scene is rendered at widget size
+        *
+        * Allows to convert mouse positions into virtual pixels: subtract the area position and divide by the scale, which is the area width divided by the virtual width.
+        *
+        */
+        sf::IntRect getPresentationArea();
+
+        /*!
+        * @brief Find the topmost sprite under a point of the widget
+        * @param position : Point in widget pixels, for example the position of a mouse event.
+        * @param result : Receives description of the picked sprite.
+        * @param pixel_accurate : If true, clicks on transparent pixels go through to the sprites below. Default is true.
+        * @return False if no sprite is under the point
+        *
+        * Layers are searched from the topmost down through a spatial index, as seen in the last rendered frame. <br>
+        * The index is rebuilt on the first pick following a change of layers, chunks or sort modes. <br>
+        * Pixel accuracy relies on alpha masks of textures cached in SharedResources, computed the first time a texture is tested. Other textures are tested on bounds only.
+        *
+        */
+        bool pickSprite(const QPoint& position, PickResult& result, bool pixel_accurate = true);
+
     public slots:
         /*!
         * @brief Update the layer arrays of sprites.
@@ -124,10 +253,57 @@ namespace ShadeEngine
         */
         void updateLayersArray(std::vector< std::vector<sf::Sprite> > sprite_layers);
 
+        /*!
+        * @brief Update the layer arrays of sprites with a loaded scene
+        * @param sprite_layers : Array of sprite vectors to render.
+        * @param textures : Textures used by the sprites. Held until next scene, so they outlive the sprites whatever the connection type.
+        *
+        * Same as updateLayersArray. Meant to be connected to SceneLoader::sceneLoaded. <br>
+        * Slot.
+        *
+        */
+        void updateScene(std::vector< std::vector<sf::Sprite> > sprite_layers, std::vector< std::shared_ptr<const sf::Texture> > textures);
+
+        /*!
+        * @brief Attach a chunk of sprite layers to the rendered world
+        * @param key : Identifier of the chunk. Replaces the chunk previously attached with the same key.
+        * @param chunk_layers : Array of sprite vectors, one per layer.
+        *
+        * Chunks allow parts of the world (for example streamed map regions) to be added or removed without resending the whole layers array. <br>
+        * Sprites of chunks are drawn before the sprites of the layers array in each layer. Chunk layers are moved in, so attaching does not copy sprites. <br>
+        * Slot.
+        *
+        */
+        void attachChunk(quint64 key, std::vector< std::vector<sf::Sprite> > chunk_layers);
+
+        /*!
+        * @brief Detach a chunk of sprite layers from the rendered world
+        * @param key : Identifier of the chunk. Ignored if no such chunk is attached.
+        *
+        * Slot.
+        *
+        */
+        void detachChunk(quint64 key);
+
     protected:
         std::atomic<bool> m_updated; /*!< Flag indicating if list of sprites to render has been updated. */
-        std::mutex m_layers_mutex; /*!< Mutex protecting the access to the layers vector. */
-        std::vector< std::vector<sf::Sprite> > m_sprite_layers; /*!< List of overlapping layers containing sprites to render. */
+        std::mutex m_layers_mutex; /*!< Mutex protecting the access to the renderer. */
+        SpriteLayersRenderer m_renderer; /*!< Renderer holding layers, chunks, scene graph and camera. */
+        sf::Clock m_frame_clock; /*!< Clock measuring time elapsed between frames for camera smoothing. */
+        std::unique_ptr<RenderRecorder> m_recorder; /*!< Recorder of scene updates and frames. NULL when not recording. */
+        std::unique_ptr<sf::RenderTexture> m_virtual_target; /*!< Internal render target at virtual resolution. NULL when rendering at widget size. */
+        SpritePicker m_picker; /*!< Spatial index of the sprites of the renderer. */
+        bool m_picker_outdated; /*!< Flag indicating sprites changed since picker was built. */
+        std::vector< std::shared_ptr<const sf::Texture> > m_scene_textures; /*!< Textures of the scene received through updateScene. */
+
+        /*!
+        * @brief Compute area of the widget in which the scene is presented
+        * @return Area in widget pixels
+        *
+        * Layers mutex must be held by the caller.
+        *
+        */
+        sf::IntRect computePresentationArea() const;
 
         /*!
         * @brief User specific rendering initialization
@@ -142,7 +318,8 @@ namespace ShadeEngine
         /*!
         * @brief User specific rendering operations
         *
-        * Fills the background with background color then display sprite layers one after another. <br>
+        * Fills the background with background color then renders layers through the camera view, either directly or at virtual resolution followed by an integer scaled blit. <br>
+        * Frame is recorded if a recording is in progress. <br>
         * Virtual final method.
         *
         */
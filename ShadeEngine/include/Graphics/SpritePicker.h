@@ -0,0 +1,250 @@
+/*!
+ * @file SpritePicker.h
+ * @brief Class used to find which sprite is under a point of the screen.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a spatial index over the sprites of a SpriteLayersRenderer. <br>
+ * Each layer has a bounding volume hierarchy of sprite bounds. Picking walks layers from the topmost down and can refine hits with texture alpha masks.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef SPRITE_PICKER_H
+#define SPRITE_PICKER_H
+
+#include <stdint.h>
+#include <vector>
+#include <QtGlobal>
+#include <SFML/Graphics.hpp>
+
+#include "SceneGraph.h"
+#include "SpriteLayersRenderer.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*!
+    * @brief Containers a picked sprite can belong to
+    */
+    enum PickSource
+    {
+        PICK_LAYERS, /*!< Sprite of the layers array. */
+        PICK_CHUNK, /*!< Sprite of an attached chunk. */
+        PICK_SCENE_GRAPH /*!< Sprite attached to a scene graph node. */
+    };
+
+    /*!
+    * @brief Description of a picked sprite
+    */
+    struct PickResult
+    {
+        PickSource source; /*!< Container of the sprite. */
+        std::size_t layer; /*!< Layer of the sprite. */
+        quint64 chunk_key; /*!< Key of the chunk of the sprite. Only meaningful for PICK_CHUNK. */
+        std::size_t index; /*!< Index of the sprite in its layer vector. Not meaningful for PICK_SCENE_GRAPH. */
+        SceneGraph::NodeId node; /*!< Node the sprite is attached to. Only meaningful for PICK_SCENE_GRAPH. */
+        sf::Vector2f world_position; /*!< Picked point in layer coordinates. */
+    };
+
+    /*! \class SpritePicker
+    * \brief Class allowing to find the topmost sprite under a point.
+    *
+    * Definition of a class indexing the sprites of layers array and chunks in one bounding volume hierarchy per layer. <br>
+    * Queries cost O(log n) per layer. Scene graph sprites, which usually are few and move every frame, are tested linearly. <br>
+    * The index refers to the sprites of the renderer: it must be rebuilt whenever layers, chunks or sort modes change.
+    *
+    */
+    class SpritePicker
+    {
+    public:
+        /*!
+        * @brief Constructor of the SpritePicker class
+        *
+        * Creates an empty index.
+        *
+        */
+        SpritePicker();
+
+        /*!
+        * @brief Build the index of the sprites of a renderer
+        * @param renderer : Renderer whose layers array and chunks are indexed.
+        *
+        * O(n log n) in the number of sprites. Sprites of Y-sorted layers are ranked in the drawing order of the last render. If the layer changed since, they are sorted by their bottom coordinate, like the next render will.
+        *
+        */
+        void build(const SpriteLayersRenderer& renderer);
+
+        /*!
+        * @brief Find the topmost sprite under a point of a render target
+        * @param renderer : Renderer the index has been built from.
+        * @param target_size : Size of the render target the renderer draws in.
+        * @param target_position : Point in render target pixels.
+        * @param pixel_accurate : If true, points on transparent pixels of textures cached in SharedResources do not hit.
+        * @param result : Receives description of the picked sprite.
+        * @return False if no sprite is under the point
+        *
+        * Point is converted to each layer coordinates with the current camera view of the layer. <br>
+        * In each layer, scene graph sprites are tested first since they are drawn on top. <br>
+        * Constant method.
+        *
+        */
+        bool pick(const SpriteLayersRenderer& renderer, const sf::Vector2u& target_size, const sf::Vector2f& target_position, bool pixel_accurate, PickResult& result) const;
+
+        /*!
+        * @brief Tell if a sprite covers a point
+        * @param sprite : Sprite to test.
+        * @param transform : Transform applied on top of sprite transform.
+        * @param point : Point in the coordinates the sprite is drawn in.
+        * @param pixel_accurate : If true, transparent pixels of textures cached in SharedResources do not hit.
+        * @return True if sprite covers the point
+        *
+        * Rotated and scaled sprites are tested exactly. <br>
+        * Static method.
+        *
+        */
+        static bool hitTest(const sf::Sprite& sprite, const sf::Transform& transform, const sf::Vector2f& point, bool pixel_accurate);
+
+    protected:
+        static const std::size_t LEAF_SIZE; /*!< Maximum number of sprites in a leaf of the hierarchy. */
+
+        /*!
+        * @brief Sprite indexed in a layer
+        */
+        struct PickEntry
+        {
+            sf::FloatRect bounds; /*!< Global bounds of the sprite. */
+            uint32_t rank; /*!< Drawing rank in the layer. Higher ranks are drawn on top. */
+            const sf::Sprite* sprite; /*!< Indexed sprite, owned by the renderer. */
+            PickSource source; /*!< Container of the sprite. */
+            quint64 chunk_key; /*!< Key of the chunk of the sprite. */
+            std::size_t index; /*!< Index of the sprite in its layer vector. */
+        };
+
+        /*!
+        * @brief Node of a bounding volume hierarchy
+        */
+        struct PickNode
+        {
+            sf::FloatRect bounds; /*!< Union of the bounds of sprites below the node. */
+            uint32_t max_rank; /*!< Highest rank of sprites below the node. */
+            uint32_t first; /*!< First entry of a leaf, or index of the right child of an inner node whose left child follows it. */
+            uint32_t count; /*!< Number of entries of a leaf. 0 for inner nodes. */
+        };
+
+        /*!
+        * @brief Index of a layer
+        */
+        struct LayerIndex
+        {
+            std::vector<PickEntry> entries; /*!< Sprites of the layer, grouped by leaf. */
+            std::vector<PickNode> nodes; /*!< Hierarchy nodes in depth first order. Root is the first node. */
+        };
+
+        std::vector<LayerIndex> m_layers; /*!< Index of each layer. */
+
+        /*!
+        * @brief Build a subtree over a range of entries
+        * @param layer_index : Index being built.
+        * @param begin : First entry of the range.
+        * @param end : Entry following the range.
+        *
+        * Splits ranges at the median of the longest axis.
+        *
+        */
+        void buildNode(LayerIndex& layer_index, std::size_t begin, std::size_t end);
+
+        /*!
+        * @brief Find the topmost indexed sprite of a layer under a point
+        * @param layer_index : Index of the layer.
+        * @param point : Point in layer coordinates.
+        * @param pixel_accurate : Whether transparent pixels are skipped.
+        * @return Topmost entry under the point or NULL
+        *
+        * Subtrees whose highest rank is below the best hit are skipped. <br>
+        * Constant method.
+        *
+        */
+        const PickEntry* pickEntry(const LayerIndex& layer_index, const sf::Vector2f& point, bool pixel_accurate) const;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
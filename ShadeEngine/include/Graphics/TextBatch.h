@@ -0,0 +1,275 @@
+/*!
+ * @file TextBatch.h
+ * @brief Class used to draw many text labels in a single draw call.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a text layer whose labels share the glyph atlas of a font. <br>
+ * Labels are laid out once when their string changes. Each frame, quads of visible labels are copied into one vertex buffer drawn with a single call.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef TEXT_BATCH_H
+#define TEXT_BATCH_H
+
+#include <stdint.h>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    typedef uint32_t LabelId; /*!< Identifier of a text label. Identifiers of destroyed labels are reused. */
+
+    /*! \class TextBatch
+    * \brief Class allowing to draw name tags, stats and damage numbers with a single draw call.
+    *
+    * Definition of a class holding text labels of one font and character size. <br>
+    * SFML keeps the glyphs of a font and character size in a single texture page, which is used as the atlas shared by all labels. <br>
+    * Moving or recoloring a label does not lay it out again. Labels out of the target view are skipped. Not thread safe.
+    *
+    */
+    class TextBatch
+    {
+    public:
+        static const LabelId INVALID_LABEL; /*!< Identifier never associated with a label. */
+
+        /*!
+        * @brief Constructor of the TextBatch class
+        * @param font : Font of the labels. Must outlive the batch.
+        * @param character_size : Character size of the labels in pixels.
+        *
+        */
+        TextBatch(const sf::Font& font, unsigned int character_size);
+
+        /*!
+        * @brief Create a label
+        * @param string : Text of the label. Supports line breaks.
+        * @param position : Position of the label anchor.
+        * @param color : Color of the label. Default is white.
+        * @return Identifier of the label
+        *
+        */
+        LabelId createLabel(const sf::String& string, const sf::Vector2f& position, const sf::Color& color = sf::Color::White);
+
+        /*!
+        * @brief Destroy a label
+        * @param label : Identifier of the label. Ignored if invalid.
+        *
+        */
+        void destroyLabel(LabelId label);
+
+        /*!
+        * @brief Tell if an identifier is associated with a label
+        * @param label : Identifier to check.
+        * @return True if label exists
+        *
+        * Constant method.
+        *
+        */
+        bool isValid(LabelId label) const;
+
+        /*!
+        * @brief Change the text of a label
+        * @param label : Identifier of the label.
+        * @param string : New text. Label is only laid out again if text differs.
+        *
+        */
+        void setString(LabelId label, const sf::String& string);
+
+        /*!
+        * @brief Move a label
+        * @param label : Identifier of the label.
+        * @param position : Position of the label anchor.
+        *
+        */
+        void setPosition(LabelId label, const sf::Vector2f& position);
+
+        /*!
+        * @brief Change the color of a label
+        * @param label : Identifier of the label.
+        * @param color : Color of the label.
+        *
+        */
+        void setColor(LabelId label, const sf::Color& color);
+
+        /*!
+        * @brief Set which point of a label is placed at its position
+        * @param label : Identifier of the label.
+        * @param anchor : Anchor as a fraction of label size. (0,0) is top left, default. (0.5,1) is bottom center, handy above characters.
+        *
+        */
+        void setAnchor(LabelId label, const sf::Vector2f& anchor);
+
+        /*!
+        * @brief Show or hide a label
+        * @param label : Identifier of the label.
+        * @param visible : False to skip the label when drawing.
+        *
+        */
+        void setVisible(LabelId label, bool visible);
+
+        /*!
+        * @brief Get the area covered by a label
+        * @param label : Identifier of the label.
+        * @return Bounds of the label in the coordinates it is drawn in
+        *
+        * Constant method.
+        *
+        */
+        sf::FloatRect getBounds(LabelId label) const;
+
+        /*!
+        * @brief Draw visible labels
+        * @param target : Render target to draw in, through its current view.
+        * @param states : Render states used to draw. Texture is overwritten by the glyph atlas. Default is default render states.
+        *
+        * Quads of labels intersecting the view are copied into one buffer drawn with a single draw call.
+        *
+        */
+        void draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default);
+
+        /*!
+        * @brief Get number of label layouts since creation
+        * @return Number of layouts
+        *
+        * Allows to check that only labels whose text changed are laid out again. <br>
+        * Constant method.
+        *
+        */
+        std::size_t getLayoutCount() const;
+
+        /*!
+        * @brief Get number of draw calls issued since creation
+        * @return Number of draw calls
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getDrawCallCount() const;
+
+    protected:
+        /*!
+        * @brief Text label
+        */
+        struct Label
+        {
+            sf::String string; /*!< Text of the label. */
+            sf::Vector2f position; /*!< Position of the anchor. */
+            sf::Vector2f anchor; /*!< Anchor as a fraction of label size. */
+            sf::Color color; /*!< Color of the label. */
+            sf::FloatRect local_bounds; /*!< Bounds of glyph quads relatively to the label origin. */
+            std::vector<sf::Vertex> glyph_vertices; /*!< Glyph quads relatively to the label origin. */
+            bool visible; /*!< Whether label is drawn. */
+            bool alive; /*!< Whether identifier is associated with a label. */
+        };
+
+        const sf::Font& m_font; /*!< Font of the labels. */
+        unsigned int m_character_size; /*!< Character size of the labels. */
+        std::vector<Label> m_labels; /*!< Labels indexed by identifier. */
+        std::vector<LabelId> m_free_ids; /*!< Identifiers available for reuse. */
+        std::vector<sf::Vertex> m_vertices; /*!< Quads of visible labels. Keeps its capacity between frames. */
+        std::size_t m_layout_count; /*!< Number of label layouts. */
+        std::size_t m_draw_call_count; /*!< Number of draw calls. */
+
+        /*!
+        * @brief Compute glyph quads of a label
+        * @param label : Label to lay out.
+        *
+        * Adds missing glyphs to the font atlas. Reuses the capacity of label vertices.
+        *
+        */
+        void layout(Label& label);
+
+        /*!
+        * @brief Get the position of the label origin
+        * @param label : Label whose origin is computed.
+        * @return Position of the top left corner of the label line box
+        *
+        * Constant method.
+        *
+        */
+        sf::Vector2f getOrigin(const Label& label) const;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
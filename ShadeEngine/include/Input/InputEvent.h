@@ -0,0 +1,143 @@
+/*!
+ * @file InputEvent.h
+ * @brief Compact description of user inputs.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the input record produced on the GUI thread from Qt keyboard and mouse events and consumed once per frame by the rendering loop.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef INPUT_EVENT_H
+#define INPUT_EVENT_H
+
+#include <stdint.h>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*!
+    * @brief Kinds of input events
+    */
+    enum InputEventType
+    {
+        KEY_PRESSED, /*!< A key has been pressed or auto-repeated. */
+        KEY_RELEASED, /*!< A key has been released. */
+        MOUSE_PRESSED, /*!< A mouse button has been pressed. */
+        MOUSE_RELEASED, /*!< A mouse button has been released. */
+        MOUSE_MOVED, /*!< Mouse cursor moved over the widget. */
+        MOUSE_WHEEL, /*!< Mouse wheel rotated. */
+        FOCUS_LOST /*!< Widget lost keyboard focus. Keys and buttons down will not receive their release. */
+    };
+
+    /*!
+    * @brief Mouse buttons tracked by input state
+    */
+    enum MouseButton
+    {
+        MOUSE_LEFT = 0x01, /*!< Left mouse button. */
+        MOUSE_RIGHT = 0x02, /*!< Right mouse button. */
+        MOUSE_MIDDLE = 0x04 /*!< Middle mouse button. */
+    };
+
+    /*!
+    * @brief Input event record
+    *
+    * Plain 24 bytes structure copied through the lock-free input queue.
+    *
+    */
+    struct InputEvent
+    {
+        uint64_t timestamp_ns; /*!< Steady clock time at which Qt delivered the event, in nanoseconds. */
+        uint8_t type; /*!< Kind of event (InputEventType). */
+        uint8_t button; /*!< Mouse button concerned by press or release events (MouseButton). */
+        uint8_t auto_repeat; /*!< Non zero for key presses generated by keyboard auto-repeat. */
+        uint8_t padding; /*!< Unused. */
+        uint16_t key; /*!< Compact key index of key events (see InputState::getKeyIndex). */
+        int16_t wheel_delta; /*!< Wheel rotation in eighths of degree for wheel events. */
+        int16_t x; /*!< Cursor horizontal position in widget pixels for mouse events. */
+        int16_t y; /*!< Cursor vertical position in widget pixels for mouse events. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
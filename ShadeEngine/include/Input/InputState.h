@@ -0,0 +1,231 @@
+/*!
+ * @file InputState.h
+ * @brief Class used to query keyboard and mouse state.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the keyboard and mouse state accumulated from input events. <br>
+ * Key states are stored as bitsets indexed by a compact key index so that every query is O(1).
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef INPUT_STATE_H
+#define INPUT_STATE_H
+
+#include <bitset>
+#include <stdint.h>
+#include <SFML/System.hpp>
+
+#include "InputEvent.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class InputState
+    * \brief Class allowing to query which keys and mouse buttons are down.
+    *
+    * Definition of a class accumulating input events of a frame. <br>
+    * Besides current states, keeps track of keys and buttons pressed or released during the current frame.
+    *
+    */
+    class InputState
+    {
+    public:
+        static const std::size_t KEY_COUNT = 512; /*!< Number of compact key indexes. */
+
+        /*!
+        * @brief Constructor of the InputState class
+        *
+        * Creates a state with no key nor button down.
+        *
+        */
+        InputState();
+
+        /*!
+        * @brief Convert a Qt key code into a compact key index
+        * @param qt_key : Qt::Key value.
+        * @return Index between 1 and KEY_COUNT - 1, or 0 for unsupported keys
+        *
+        * Latin-1 keys keep their code. Special keys (Qt::Key_Escape and following) are mapped after them. <br>
+        * Static method.
+        *
+        */
+        static uint16_t getKeyIndex(int qt_key);
+
+        /*!
+        * @brief Clear per frame states
+        *
+        * Forgets keys and buttons pressed or released during previous frame, as well as wheel rotation.
+        *
+        */
+        void beginFrame();
+
+        /*!
+        * @brief Update state with an input event
+        * @param event : Event to apply.
+        *
+        * Focus loss releases all keys and buttons down.
+        *
+        */
+        void apply(const InputEvent& event);
+
+        /*!
+        * @brief Check if a key is currently down
+        * @param qt_key : Qt::Key value.
+        * @return True if key is down
+        *
+        * Constant method.
+        *
+        */
+        bool isKeyDown(int qt_key) const;
+
+        /*!
+        * @brief Check if a key has been pressed during current frame
+        * @param qt_key : Qt::Key value.
+        * @return True if key has been pressed. Auto-repeats are ignored.
+        *
+        * Constant method.
+        *
+        */
+        bool wasKeyPressed(int qt_key) const;
+
+        /*!
+        * @brief Check if a key has been released during current frame
+        * @param qt_key : Qt::Key value.
+        * @return True if key has been released
+        *
+        * Constant method.
+        *
+        */
+        bool wasKeyReleased(int qt_key) const;
+
+        /*!
+        * @brief Check if a mouse button is currently down
+        * @param button : Mouse button.
+        * @return True if button is down
+        *
+        * Constant method.
+        *
+        */
+        bool isMouseButtonDown(MouseButton button) const;
+
+        /*!
+        * @brief Check if a mouse button has been pressed during current frame
+        * @param button : Mouse button.
+        * @return True if button has been pressed
+        *
+        * Constant method.
+        *
+        */
+        bool wasMouseButtonPressed(MouseButton button) const;
+
+        /*!
+        * @brief Get last known cursor position
+        * @return Cursor position in widget pixels
+        *
+        * Constant method.
+        *
+        */
+        sf::Vector2i getMousePosition() const;
+
+        /*!
+        * @brief Get wheel rotation accumulated during current frame
+        * @return Wheel rotation in eighths of degree
+        *
+        * Constant method.
+        *
+        */
+        int getWheelDelta() const;
+
+    protected:
+        std::bitset<KEY_COUNT> m_keys_down; /*!< Keys currently down. */
+        std::bitset<KEY_COUNT> m_keys_pressed; /*!< Keys pressed during current frame. */
+        std::bitset<KEY_COUNT> m_keys_released; /*!< Keys released during current frame. */
+        uint8_t m_buttons_down; /*!< Mouse buttons currently down. */
+        uint8_t m_buttons_pressed; /*!< Mouse buttons pressed during current frame. */
+        sf::Vector2i m_mouse_position; /*!< Last known cursor position. */
+        int m_wheel_delta; /*!< Wheel rotation accumulated during current frame. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
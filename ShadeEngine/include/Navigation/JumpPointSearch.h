@@ -0,0 +1,217 @@
+/*!
+ * @file JumpPointSearch.h
+ * @brief Class used to find shortest paths on tile grids.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a jump point search, an A* variant for uniform cost grids. <br>
+ * Straight and diagonal runs of tiles are skipped until a tile where the path may turn, so only a few nodes enter the open set. <br>
+ * Search buffers are kept between searches so that steady state queries do not allocate.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef JUMP_POINT_SEARCH_H
+#define JUMP_POINT_SEARCH_H
+
+#include <stdint.h>
+#include <vector>
+#include <SFML/System.hpp>
+
+#include "NavigationGrid.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class JumpPointSearch
+    * \brief Class allowing to find shortest 8-connected paths on a NavigationGrid.
+    *
+    * Definition of a class running jump point searches. Diagonal moves are only allowed when both adjacent straight tiles are walkable, so paths never cut corners. <br>
+    * Straight moves cost 1 and diagonal moves cost sqrt(2). <br>
+    * An instance is not thread safe: use one instance per thread.
+    *
+    */
+    class JumpPointSearch
+    {
+    public:
+        /*!
+        * @brief Constructor of the JumpPointSearch class
+        *
+        * Buffers are allocated on first search.
+        *
+        */
+        JumpPointSearch();
+
+        /*!
+        * @brief Find a shortest path between two tiles
+        * @param grid : Grid to search.
+        * @param start : Tile the path starts from.
+        * @param goal : Tile the path leads to.
+        * @param path : Receives every tile of the path, start and goal included. Cleared first, its capacity is reused.
+        * @return False if start or goal is blocked or if goal cannot be reached
+        *
+        */
+        bool findPath(const NavigationGrid& grid, const sf::Vector2i& start, const sf::Vector2i& goal, std::vector<sf::Vector2i>& path);
+
+        /*!
+        * @brief Get number of nodes expanded by last search
+        * @return Number of expanded nodes
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getExpandedNodeCount() const;
+
+    protected:
+        /*!
+        * @brief Node of the open set
+        */
+        struct OpenNode
+        {
+            float estimate; /*!< Cost from start plus heuristic to goal. */
+            uint32_t tile; /*!< Index of the tile. */
+        };
+
+        std::vector<float> m_costs; /*!< Cost from start of each reached tile. */
+        std::vector<uint32_t> m_parents; /*!< Jump point each reached tile was reached from. */
+        std::vector<uint32_t> m_reached_marks; /*!< Search identifier of the last search that reached each tile. */
+        std::vector<uint32_t> m_closed_marks; /*!< Search identifier of the last search that expanded each tile. */
+        std::vector<OpenNode> m_open; /*!< Binary heap of open nodes. Nodes whose cost improved are pushed again and stale entries skipped. */
+        std::vector<uint32_t> m_jump_points; /*!< Jump points of the path being rebuilt. */
+        uint32_t m_search_id; /*!< Identifier of current search. Marks of older searches are ignored, so buffers are never cleared. */
+        std::size_t m_expanded_count; /*!< Number of nodes expanded by last search. */
+
+        const uint8_t* m_tiles; /*!< Tiles of the grid being searched. */
+        int m_width; /*!< Width of the grid being searched. */
+        int m_height; /*!< Height of the grid being searched. */
+        int m_goal_x; /*!< Column of the goal of current search. */
+        int m_goal_y; /*!< Row of the goal of current search. */
+
+        /*!
+        * @brief Tell if a tile of the searched grid can be walked on
+        * @param x : Column of the tile.
+        * @param y : Row of the tile.
+        * @return True if tile is in the grid and walkable
+        *
+        * Constant method.
+        *
+        */
+        bool isWalkable(int x, int y) const;
+
+        /*!
+        * @brief Move from a tile in a direction until a jump point
+        * @param x : Column of the tile the move starts from.
+        * @param y : Row of the tile the move starts from.
+        * @param dx : Horizontal direction, -1, 0 or 1.
+        * @param dy : Vertical direction, -1, 0 or 1.
+        * @param jump_x : Receives column of the jump point.
+        * @param jump_y : Receives row of the jump point.
+        * @return False if an obstacle is reached before any jump point
+        *
+        * A jump point is the goal or a tile where a shortest path may need to turn. Diagonal moves look for jump points along both straight directions at every step. <br>
+        * Constant method.
+        *
+        */
+        bool jump(int x, int y, int dx, int dy, int& jump_x, int& jump_y) const;
+
+        /*!
+        * @brief Jump from a tile and add the jump point to the open set
+        * @param tile : Index of the expanded tile.
+        * @param dx : Horizontal direction, -1, 0 or 1.
+        * @param dy : Vertical direction, -1, 0 or 1.
+        *
+        */
+        void addSuccessor(uint32_t tile, int dx, int dy);
+
+        /*!
+        * @brief Estimate cost between two tiles
+        * @param dx : Horizontal distance.
+        * @param dy : Vertical distance.
+        * @return Octile distance, exact when no obstacle is in the way
+        *
+        * Static method.
+        *
+        */
+        static float getOctileDistance(int dx, int dy);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,172 @@
+/*!
+ * @file NavigationGrid.h
+ * @brief Class used to describe which tiles of a map can be walked on.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a grid of walkable and blocked tiles. <br>
+ * Tiles are stored as one byte each, row after row, so that path searches read them directly.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef NAVIGATION_GRID_H
+#define NAVIGATION_GRID_H
+
+#include <stdint.h>
+#include <vector>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class NavigationGrid
+    * \brief Class storing walkable tiles of a tile map.
+    *
+    * Definition of a class describing the tiles characters can walk on. Tiles out of the grid are blocked.
+    *
+    */
+    class NavigationGrid
+    {
+    public:
+        /*!
+        * @brief Constructor of the NavigationGrid class
+        * @param width : Number of tile columns.
+        * @param height : Number of tile rows.
+        * @param walkable : Initial state of all tiles. Default is true.
+        *
+        */
+        NavigationGrid(int width, int height, bool walkable = true);
+
+        /*!
+        * @brief Get number of tile columns
+        * @return Width of the grid
+        *
+        * Constant method.
+        *
+        */
+        int getWidth() const;
+
+        /*!
+        * @brief Get number of tile rows
+        * @return Height of the grid
+        *
+        * Constant method.
+        *
+        */
+        int getHeight() const;
+
+        /*!
+        * @brief Tell if a tile can be walked on
+        * @param x : Column of the tile.
+        * @param y : Row of the tile.
+        * @return True if tile is in the grid and walkable
+        *
+        * Constant method.
+        *
+        */
+        bool isWalkable(int x, int y) const;
+
+        /*!
+        * @brief Set whether a tile can be walked on
+        * @param x : Column of the tile. Ignored if out of the grid.
+        * @param y : Row of the tile. Ignored if out of the grid.
+        * @param walkable : New state of the tile.
+        *
+        */
+        void setWalkable(int x, int y, bool walkable);
+
+        /*!
+        * @brief Get tiles
+        * @return Pointer on width x height bytes, row after row. Non zero bytes are walkable.
+        *
+        * Constant method.
+        *
+        */
+        const uint8_t* getTiles() const;
+
+    protected:
+        int m_width; /*!< Number of tile columns. */
+        int m_height; /*!< Number of tile rows. */
+        std::vector<uint8_t> m_tiles; /*!< Walkable flag of each tile, row after row. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
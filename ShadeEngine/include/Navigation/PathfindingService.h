@@ -0,0 +1,296 @@
+/*!
+ * @file PathfindingService.h
+ * @brief Class used to compute character paths in the background.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of an asynchronous pathfinding service for tile maps. <br>
+ * Path requests are queued and served by worker threads running jump point searches on a snapshot of the grid. <br>
+ * Found paths are cached and delivered back on the thread owning the service.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef PATHFINDING_SERVICE_H
+#define PATHFINDING_SERVICE_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <QObject>
+#include <SFML/System.hpp>
+
+#include "NavigationGrid.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class PathfindingService
+    * \brief Class allowing characters to request paths without blocking the game loop.
+    *
+    * Definition of a class scheduling path searches on worker threads and emitting results with pathReady. <br>
+    * Workers search an immutable copy of the grid. Tile changes are copied once before the next search, and results computed on an outdated grid are searched once more. <br>
+    * If tiles changed again during that second search, its result is delivered anyway so that requests always end while the grid keeps changing. <br>
+    * Tile changes clear the path cache since an opened tile may shorten any path. <br>
+    * All methods but the destructor must be called from the thread owning the service, typically once per frame for update.
+    *
+    */
+    class PathfindingService : public QObject
+    {
+        Q_OBJECT
+    public:
+        /*!
+        * @brief Constructor of the PathfindingService class
+        * @param grid : Initial walkable tiles. Copied.
+        * @param worker_count : Number of background threads searching paths. Default is 2.
+        *
+        */
+        PathfindingService(const NavigationGrid& grid, unsigned int worker_count = 2);
+
+        /*!
+        * @brief Destructor of the PathfindingService class
+        *
+        * Virtual method. Stops and joins worker threads. Pending requests are dropped.
+        *
+        */
+        virtual ~PathfindingService();
+
+        /*!
+        * @brief Get walkable tiles
+        * @return Current grid, including changes not yet seen by workers
+        *
+        * Constant method.
+        *
+        */
+        const NavigationGrid& getGrid() const;
+
+        /*!
+        * @brief Set whether a tile can be walked on
+        * @param x : Column of the tile.
+        * @param y : Row of the tile.
+        * @param walkable : New state of the tile.
+        *
+        * Clears the path cache if the tile state changes.
+        *
+        */
+        void setWalkable(int x, int y, bool walkable);
+
+        /*!
+        * @brief Set maximal number of cached paths
+        * @param capacity : Number of paths. Oldest paths are dropped first. 0 disables the cache. Default is 1024.
+        *
+        */
+        void setCacheCapacity(std::size_t capacity);
+
+        /*!
+        * @brief Request a path between two tiles
+        * @param start : Tile the path starts from.
+        * @param goal : Tile the path leads to.
+        * @return Identifier of the request, given back with pathReady
+        *
+        * Result is delivered by a later update, even when the path is cached, so that callers handle a single flow.
+        *
+        */
+        quint64 requestPath(const sf::Vector2i& start, const sf::Vector2i& goal);
+
+        /*!
+        * @brief Get number of requests answered from the cache
+        * @return Number of cache hits since creation
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getCacheHitCount() const;
+
+    public slots:
+        /*!
+        * @brief Deliver results of finished searches
+        *
+        * Emits pathReady for every finished request. Slot.
+        *
+        */
+        void update();
+
+    signals:
+        /*!
+        * @brief Signal emitted when a requested path has been searched
+        * @param request : Identifier returned by requestPath.
+        * @param found : False if goal cannot be reached from start.
+        * @param path : Every tile of the path, start and goal included. Empty if not found.
+        *
+        */
+        void pathReady(quint64 request, bool found, std::vector<sf::Vector2i> path);
+
+    protected:
+        /*!
+        * @brief Path search request
+        */
+        struct PathRequest
+        {
+            quint64 id; /*!< Identifier of the request. */
+            sf::Vector2i start; /*!< Tile the path starts from. */
+            sf::Vector2i goal; /*!< Tile the path leads to. */
+            bool retried; /*!< True if request is searched again because its first result was outdated. */
+        };
+
+        /*!
+        * @brief Result of a path search
+        */
+        struct PathResult
+        {
+            PathRequest request; /*!< Answered request. */
+            uint64_t grid_version; /*!< Version of the grid the path was searched on. */
+            bool found; /*!< Whether a path exists. */
+            std::vector<sf::Vector2i> path; /*!< Tiles of the path. */
+        };
+
+        /*!
+        * @brief Cached result of a path search
+        */
+        struct CachedPath
+        {
+            bool found; /*!< Whether a path exists. */
+            std::vector<sf::Vector2i> path; /*!< Tiles of the path. */
+        };
+
+        NavigationGrid m_grid; /*!< Current walkable tiles. Only accessed by owning thread. */
+        uint64_t m_grid_version; /*!< Incremented on every tile change. */
+        bool m_grid_published; /*!< Flag indicating workers see current grid version. */
+        quint64 m_next_request_id; /*!< Identifier of next request. */
+        std::size_t m_cache_capacity; /*!< Maximal number of cached paths. */
+        std::unordered_map<uint64_t, CachedPath> m_cache; /*!< Cached paths indexed by packed start and goal tiles. Only accessed by owning thread. */
+        std::deque<uint64_t> m_cache_order; /*!< Keys of cached paths, oldest first. */
+        std::vector<PathResult> m_cached_results; /*!< Cache hits waiting for next update. */
+        std::size_t m_cache_hit_count; /*!< Number of cache hits since creation. */
+
+        std::mutex m_queue_mutex; /*!< Mutex protecting requests, results and grid snapshot. */
+        std::condition_variable m_queue_condition; /*!< Condition notified when requests are added or workers must stop. */
+        std::shared_ptr<const NavigationGrid> m_snapshot; /*!< Grid searched by workers. */
+        uint64_t m_snapshot_version; /*!< Grid version of the snapshot. */
+        std::deque<PathRequest> m_requests; /*!< Requests waiting for a worker. */
+        std::vector<PathResult> m_results; /*!< Results waiting for next update. */
+        bool m_stopping; /*!< Flag indicating workers must stop. */
+        std::vector<std::thread> m_workers; /*!< Worker threads searching paths. */
+
+        /*!
+        * @brief Main loop of worker threads
+        *
+        * Each worker owns its search buffers, so that searches never allocate once warmed up.
+        *
+        */
+        void workerLoop();
+
+        /*!
+        * @brief Make workers search current grid
+        *
+        * Copies the grid into a new snapshot if tiles changed since last publication.
+        *
+        */
+        void publishGrid();
+
+        /*!
+        * @brief Store a path in the cache
+        * @param key : Packed start and goal tiles.
+        * @param found : Whether a path exists.
+        * @param path : Tiles of the path.
+        *
+        */
+        void cachePath(uint64_t key, bool found, const std::vector<sf::Vector2i>& path);
+
+        /*!
+        * @brief Compute cache key of a request
+        * @param start : Tile the path starts from.
+        * @param goal : Tile the path leads to.
+        * @return Key packing both tiles, or a key never cached if a tile is out of the grid
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getCacheKey(const sf::Vector2i& start, const sf::Vector2i& goal) const;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
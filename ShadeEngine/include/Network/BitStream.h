@@ -0,0 +1,255 @@
+/*!
+ * @file BitStream.h
+ * @brief Class used to pack values on the exact number of bits they need.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a growable bit buffer with a write cursor and a read cursor. <br>
+ * Bits are packed least significant first, values may span several bytes.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef BIT_STREAM_H
+#define BIT_STREAM_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class BitStream
+    * \brief Class allowing to write and read bit-packed network packets.
+    *
+    * Definition of a buffer in which values are written on a chosen number of bits. <br>
+    * Reading never goes past written bits: read methods return false instead, so that malformed packets are detected.
+    *
+    */
+    class BitStream
+    {
+    public:
+        /*!
+        * @brief Constructor of the BitStream class
+        *
+        * Creates an empty stream.
+        *
+        */
+        BitStream();
+
+        /*!
+        * @brief Empty the stream
+        *
+        * Keeps capacity so that building packets every frame does not allocate.
+        *
+        */
+        void clear();
+
+        /*!
+        * @brief Replace content of the stream
+        * @param data : Bytes to read from.
+        * @param size : Number of bytes.
+        *
+        * Read cursor goes back to the start.
+        *
+        */
+        void setData(const void* data, std::size_t size);
+
+        /*!
+        * @brief Write the lowest bits of a value
+        * @param value : Value to write. Bits above count are ignored.
+        * @param count : Number of bits to write, up to 32.
+        *
+        */
+        void writeBits(uint32_t value, unsigned int count);
+
+        /*!
+        * @brief Write a flag on a single bit
+        * @param value : Flag to write.
+        *
+        */
+        void writeBool(bool value);
+
+        /*!
+        * @brief Write a value on as many groups of 8 bits as needed
+        * @param value : Value to write.
+        *
+        * Each group holds 7 bits of value and a continuation bit, so small values stay small.
+        *
+        */
+        void writeVarint(uint64_t value);
+
+        /*!
+        * @brief Read bits
+        * @param value : Receives bits read.
+        * @param count : Number of bits to read, up to 32.
+        * @return False if stream ends before
+        *
+        */
+        bool readBits(uint32_t& value, unsigned int count);
+
+        /*!
+        * @brief Read a flag
+        * @param value : Receives flag read.
+        * @return False if stream ends before
+        *
+        */
+        bool readBool(bool& value);
+
+        /*!
+        * @brief Read a value written by writeVarint
+        * @param value : Receives value read.
+        * @return False if stream ends before the value does
+        *
+        */
+        bool readVarint(uint64_t& value);
+
+        /*!
+        * @brief Remove last written bits
+        * @param bit_count : Number of bits to keep. Ignored if larger than written bits.
+        *
+        * Allows to cancel writing a value that does not fit in a packet.
+        *
+        */
+        void truncate(std::size_t bit_count);
+
+        /*!
+        * @brief Get number of written bits
+        * @return Number of bits
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getBitCount() const;
+
+        /*!
+        * @brief Get number of bytes holding written bits
+        * @return Number of bytes
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getByteCount() const;
+
+        /*!
+        * @brief Get written bytes
+        * @return Pointer on bytes
+        *
+        * Constant method.
+        *
+        */
+        const uint8_t* getData() const;
+
+        /*!
+        * @brief Map a value of a range to an integer
+        * @param value : Value to quantize. Clamped to the range.
+        * @param min : Lowest value of the range.
+        * @param max : Highest value of the range.
+        * @param bits : Number of bits of the result, up to 32.
+        * @return Integer between 0 and 2^bits - 1
+        *
+        * Static method.
+        *
+        */
+        static uint32_t quantize(float value, float min, float max, unsigned int bits);
+
+        /*!
+        * @brief Map an integer back to a value of a range
+        * @param value : Integer returned by quantize.
+        * @param min : Lowest value of the range.
+        * @param max : Highest value of the range.
+        * @param bits : Number of bits given to quantize.
+        * @return Value of the range
+        *
+        * Static method.
+        *
+        */
+        static float dequantize(uint32_t value, float min, float max, unsigned int bits);
+
+    protected:
+        std::vector<uint8_t> m_data; /*!< Bytes of the stream. Last byte may be partially used. */
+        std::size_t m_bit_count; /*!< Number of written bits. */
+        std::size_t m_read_position; /*!< Number of bits already read. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,222 @@
+/*!
+ * @file ReplicationClient.h
+ * @brief Class used by spectators to mirror replicated entities.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the receiving side of state replication. <br>
+ * The client rebuilds each snapshot from the baseline it references and acknowledges it, so that the server can send the next delta against it.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef REPLICATION_CLIENT_H
+#define REPLICATION_CLIENT_H
+
+#include <map>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+#include <SFML/Network.hpp>
+
+#include "ReplicationCodec.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class ReplicationClient
+    * \brief Class allowing a spectator to follow a scene replicated by a ReplicationServer.
+    *
+    * Definition of a client receiving snapshots over UDP. <br>
+    * Snapshots older than the latest applied one are ignored. The client says hello until a first snapshot arrives, then acknowledges snapshots, which also keeps it alive on the server. <br>
+    * When no snapshot is applied for REPLICATION_TIMEOUT, the client drops its history and says hello again, so that it recovers from network outages and server restarts. <br>
+    * Not thread safe. Must be used from the thread owning the client, typically once per frame.
+    *
+    */
+    class ReplicationClient
+    {
+    public:
+        /*!
+        * @brief Constructor of the ReplicationClient class
+        *
+        * Client is not connected.
+        *
+        */
+        ReplicationClient();
+
+        /*!
+        * @brief Destructor of the ReplicationClient class
+        *
+        * Says bye to the server if connected.
+        *
+        */
+        ~ReplicationClient();
+
+        /*!
+        * @brief Start receiving snapshots from a server
+        * @param address : Address of the server.
+        * @param port : Port of the server.
+        * @return False if client socket could not be bound
+        *
+        * Entities of a previous connection are cleared.
+        *
+        */
+        bool connect(const sf::IpAddress& address, unsigned short port);
+
+        /*!
+        * @brief Stop receiving snapshots
+        *
+        * Entities are kept.
+        *
+        */
+        void disconnect();
+
+        /*!
+        * @brief Process received snapshots
+        *
+        * Applies the newest snapshots and acknowledges them. Also resends hello or acknowledgement regularly so that the server does not forget the client. <br>
+        * Entities are kept while the client starts over after a timeout.
+        *
+        */
+        void update();
+
+        /*!
+        * @brief Get mirrored entities
+        * @return State of entities as of the latest applied snapshot, indexed by identifier
+        *
+        * Constant method.
+        *
+        */
+        const std::map<uint32_t, ReplicatedEntity>& getEntities() const;
+
+        /*!
+        * @brief Get sequence of latest applied snapshot
+        * @return Sequence or 0 if no snapshot has been received
+        *
+        * Constant method.
+        *
+        */
+        uint32_t getSequence() const;
+
+        /*!
+        * @brief Get number of bytes received since creation
+        * @return Size of all received packets in bytes
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getReceivedBytes() const;
+
+    protected:
+        sf::UdpSocket m_socket; /*!< Socket exchanging packets with the server. */
+        bool m_connected; /*!< Whether client is connected. */
+        sf::IpAddress m_server_address; /*!< Address of the server. */
+        unsigned short m_server_port; /*!< Port of the server. */
+        uint32_t m_sequence; /*!< Sequence of latest applied snapshot. */
+        std::vector<QuantizedSnapshot> m_history; /*!< Applied snapshots, indexed by sequence modulo REPLICATION_HISTORY_SIZE. */
+        std::vector<uint32_t> m_history_sequences; /*!< Sequence of each history snapshot. 0 if slot is empty. */
+        std::vector< std::pair<QuantizedEntity, bool> > m_changes; /*!< Changes read from a packet. Flag is true for removals. */
+        QuantizedSnapshot m_snapshot; /*!< Snapshot being rebuilt. */
+        std::map<uint32_t, ReplicatedEntity> m_entities; /*!< Mirrored entities. */
+        BitStream m_stream; /*!< Packet being read or written. */
+        sf::Clock m_send_clock; /*!< Clock measuring time since last packet sent. */
+        sf::Clock m_receive_clock; /*!< Clock measuring time since last snapshot applied or hello sent. */
+        uint64_t m_received_bytes; /*!< Number of bytes received. */
+
+        /*!
+        * @brief Apply a snapshot packet
+        * @return True if snapshot was valid and newer than the latest applied one
+        *
+        * Packet is read from m_stream, positioned after the packet type.
+        *
+        */
+        bool applySnapshot();
+
+        /*!
+        * @brief Send a packet without payload or an acknowledgement
+        * @param type : Packet type.
+        *
+        */
+        void sendPacket(ReplicationPacketType type);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
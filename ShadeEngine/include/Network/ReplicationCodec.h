@@ -0,0 +1,208 @@
+/*!
+ * @file ReplicationCodec.h
+ * @brief Class used to encode replicated entities.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the quantized form of replicated entities, shared by replication servers and clients. <br>
+ * Both sides store snapshots quantized, so that deltas compare exactly the values that are sent and do not drift.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef REPLICATION_CODEC_H
+#define REPLICATION_CODEC_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "BitStream.h"
+#include "ReplicationFormat.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*!
+    * @brief Replicated entity as sent on the network
+    */
+    struct QuantizedEntity
+    {
+        uint32_t id; /*!< Identifier of the entity. */
+        uint32_t x; /*!< Quantized horizontal position. */
+        uint32_t y; /*!< Quantized vertical position. */
+        uint32_t rotation; /*!< Quantized rotation. */
+        uint32_t sprite; /*!< Sprite identifier. */
+        uint8_t layer; /*!< Layer. */
+        uint8_t level; /*!< Character level. */
+        uint64_t xp; /*!< Character XP. */
+    };
+
+    typedef std::vector<QuantizedEntity> QuantizedSnapshot; /*!< State of all entities at a given sequence, sorted by identifier. */
+
+    /*! \class ReplicationCodec
+    * \brief Class allowing to quantize, compare and bit-pack replicated entities.
+    *
+    * Definition of the functions converting entities between their game form and their network form. <br>
+    * Only contains static methods.
+    *
+    */
+    class ReplicationCodec
+    {
+    public:
+        /*!
+        * @brief Quantize an entity
+        * @param id : Identifier of the entity.
+        * @param entity : State of the entity.
+        * @return Network form of the entity
+        *
+        * Static method.
+        *
+        */
+        static QuantizedEntity quantize(uint32_t id, const ReplicatedEntity& entity);
+
+        /*!
+        * @brief Restore an entity from its network form
+        * @param entity : Network form of the entity.
+        * @return State of the entity, up to quantization precision
+        *
+        * Static method.
+        *
+        */
+        static ReplicatedEntity dequantize(const QuantizedEntity& entity);
+
+        /*!
+        * @brief Get network form of an entity with default values
+        * @param id : Identifier of the entity.
+        * @return Baseline used for entities created since the baseline snapshot
+        *
+        * Static method.
+        *
+        */
+        static QuantizedEntity getDefault(uint32_t id);
+
+        /*!
+        * @brief Compare two entities
+        * @param entity : Current state of the entity.
+        * @param baseline : State of the entity known by the receiver.
+        * @return Mask of ReplicationField values that differ
+        *
+        * Static method.
+        *
+        */
+        static uint32_t getChangedFields(const QuantizedEntity& entity, const QuantizedEntity& baseline);
+
+        /*!
+        * @brief Write fields of an entity
+        * @param stream : Stream to write to.
+        * @param entity : Entity whose fields are written.
+        * @param fields : Mask of ReplicationField values to write.
+        *
+        * Static method.
+        *
+        */
+        static void writeFields(BitStream& stream, const QuantizedEntity& entity, uint32_t fields);
+
+        /*!
+        * @brief Read fields of an entity
+        * @param stream : Stream to read from.
+        * @param entity : Entity whose fields are overwritten. Other fields are kept.
+        * @param fields : Mask of ReplicationField values to read.
+        * @return False if stream ends before the fields do
+        *
+        * Static method.
+        *
+        */
+        static bool readFields(BitStream& stream, QuantizedEntity& entity, uint32_t fields);
+
+        /*!
+        * @brief Find an entity in a snapshot
+        * @param snapshot : Snapshot sorted by identifier.
+        * @param id : Identifier of the entity.
+        * @return Entity or NULL if snapshot does not contain it
+        *
+        * Static method.
+        *
+        */
+        static const QuantizedEntity* find(const QuantizedSnapshot& snapshot, uint32_t id);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,168 @@
+/*!
+ * @file ReplicationFormat.h
+ * @brief Layout of replication packets.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the UDP packets exchanged between replication servers and spectator clients. <br>
+ * Packets are bit-packed with BitStream and start with the protocol identifier (16 bits) and the packet type (2 bits). <br>
+ * Snapshot packets then hold the snapshot sequence (32 bits), a baseline flag (1 bit) followed by the baseline sequence (32 bits) if set, and a list of entity changes. <br>
+ * Each change starts with a continuation bit set to 1, the entity identifier (varint) and a removal flag (1 bit). Unless removed, it goes on with the changed fields mask and the changed fields. A continuation bit set to 0 ends the list. <br>
+ * Ack packets hold the sequence of the latest snapshot applied by the client (32 bits).
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef REPLICATION_FORMAT_H
+#define REPLICATION_FORMAT_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <SFML/System.hpp>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    const uint32_t REPLICATION_PROTOCOL_ID = 0x5352; /*!< "RS" in little endian. Packets with another identifier are ignored. */
+    const std::size_t REPLICATION_MAX_PACKET_SIZE = 1200; /*!< Maximal size of a packet in bytes, below usual MTUs so that packets are not fragmented. */
+    const uint32_t REPLICATION_HISTORY_SIZE = 32; /*!< Number of snapshots kept by both sides to be used as baselines. */
+    const float REPLICATION_TIMEOUT = 5.f; /*!< Time in seconds without packet after which a client is forgotten, or after which a client starts over with hello. */
+    const float REPLICATION_KEEP_ALIVE_PERIOD = 1.f; /*!< Time in seconds after which a side with nothing new to send sends a packet anyway, well below REPLICATION_TIMEOUT. */
+
+    const float REPLICATION_POSITION_MIN = -32768.f; /*!< Lowest replicated coordinate. Positions are clamped. */
+    const float REPLICATION_POSITION_MAX = 32768.f; /*!< Highest replicated coordinate. Positions are clamped. */
+    const unsigned int REPLICATION_POSITION_BITS = 20; /*!< Bits per coordinate, giving a precision of 1/16 pixel. */
+    const unsigned int REPLICATION_ROTATION_BITS = 10; /*!< Bits per rotation, giving a precision of about 0.35 degrees. */
+
+    /*!
+    * @brief Types of replication packets
+    */
+    enum ReplicationPacketType
+    {
+        REPLICATION_HELLO = 0, /*!< Client asks to receive full snapshots. No payload. */
+        REPLICATION_ACK = 1, /*!< Client acknowledges a snapshot. Keeps the client alive. */
+        REPLICATION_SNAPSHOT = 2, /*!< Server sends entity changes against a baseline. */
+        REPLICATION_BYE = 3 /*!< Client stops receiving snapshots. No payload. */
+    };
+    const unsigned int REPLICATION_PACKET_TYPE_BITS = 2; /*!< Bits storing the packet type. */
+
+    /*!
+    * @brief Fields of replicated entities, used as bits of changed fields masks
+    */
+    enum ReplicationField
+    {
+        REPLICATION_FIELD_POSITION = 1, /*!< Both coordinates, quantized. */
+        REPLICATION_FIELD_ROTATION = 2, /*!< Rotation, quantized. */
+        REPLICATION_FIELD_SPRITE = 4, /*!< Sprite identifier (varint). */
+        REPLICATION_FIELD_LAYER = 8, /*!< Layer (8 bits). */
+        REPLICATION_FIELD_LEVEL = 16, /*!< Character level (8 bits). */
+        REPLICATION_FIELD_XP = 32, /*!< Character XP (varint). */
+        REPLICATION_FIELD_ALL = 63 /*!< All fields. */
+    };
+    const unsigned int REPLICATION_FIELD_BITS = 6; /*!< Bits storing a changed fields mask. */
+
+    /*!
+    * @brief State of an entity mirrored to spectators
+    *
+    * Covers the sprite of a scene node and the progression of an RPG character. Entities only using part of it leave the rest to default values, which cost nothing to send.
+    */
+    struct ReplicatedEntity
+    {
+        sf::Vector2f position; /*!< Position in world coordinates. Default is (0,0). */
+        float rotation; /*!< Rotation in degrees. Default is 0. */
+        uint32_t sprite; /*!< Sprite displayed, application defined (animation frame, texture rect index...). Default is 0. */
+        uint8_t layer; /*!< Layer the sprite is drawn on. Default is 0. */
+        uint8_t level; /*!< Character level. Default is 0. */
+        uint64_t xp; /*!< Character XP. Default is 0. */
+
+        /*!
+        * @brief Constructor of the ReplicatedEntity structure
+        *
+        * Sets all fields to their default value.
+        *
+        */
+        ReplicatedEntity() : position(0.f, 0.f), rotation(0.f), sprite(0), layer(0), level(0), xp(0)
+        {
+        }
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
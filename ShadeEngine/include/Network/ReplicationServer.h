@@ -0,0 +1,284 @@
+/*!
+ * @file ReplicationServer.h
+ * @brief Class used to mirror entities to spectator clients.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the sending side of state replication. <br>
+ * Each update, the server sends every client the changes of entities since the last snapshot that client acknowledged, within a bandwidth budget.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef REPLICATION_SERVER_H
+#define REPLICATION_SERVER_H
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+#include <SFML/Network.hpp>
+
+#include "ReplicationCodec.h"
+#include "include/Characters/AbstractRPGCharacter.h"
+#include "include/Graphics/SceneGraph.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class ReplicationServer
+    * \brief Class allowing spectators to follow a scene over UDP.
+    *
+    * Definition of a server keeping the state of replicated entities and sending deltas to clients. <br>
+    * Any packet from an unknown address registers a client, so that clients forgotten after a timeout or a server restart are served again. <br>
+    * Snapshots sent to each client are kept so that the next delta can be computed against the latest one the client acknowledged. Lost packets are thus never resent, newer deltas cover them. <br>
+    * When changes do not fit in the budget of a client, remaining ones are sent first on next update. <br>
+    * Not thread safe. Must be used from the thread owning the server, typically once per frame.
+    *
+    */
+    class ReplicationServer
+    {
+    public:
+        /*!
+        * @brief Constructor of the ReplicationServer class
+        * @param bytes_per_second : Bandwidth budget of each client. Default is 16 kB per second.
+        *
+        */
+        ReplicationServer(unsigned int bytes_per_second = 16384);
+
+        /*!
+        * @brief Start listening for clients
+        * @param port : UDP port to listen on. 0 picks a free port.
+        * @return False if port could not be bound
+        *
+        */
+        bool start(unsigned short port);
+
+        /*!
+        * @brief Stop listening and forget clients
+        *
+        */
+        void stop();
+
+        /*!
+        * @brief Get port the server listens on
+        * @return Bound port or 0 if server is not started
+        *
+        * Constant method.
+        *
+        */
+        unsigned short getPort() const;
+
+        /*!
+        * @brief Set state of an entity
+        * @param id : Identifier of the entity. Entity is created if needed.
+        * @param entity : New state of the entity.
+        *
+        */
+        void setEntity(uint32_t id, const ReplicatedEntity& entity);
+
+        /*!
+        * @brief Copy transform of a scene node into an entity
+        * @param id : Identifier of the entity. Entity is created if needed.
+        * @param scene_graph : Scene graph holding the node. Must be updated so that world transforms are up to date.
+        * @param node : Node whose world position and rotation are copied. Ignored if invalid.
+        *
+        */
+        void setSceneNode(uint32_t id, const SceneGraph& scene_graph, SceneGraph::NodeId node);
+
+        /*!
+        * @brief Copy progression of a character into an entity
+        * @param id : Identifier of the entity. Entity is created if needed.
+        * @param character : Character whose level and XP are copied.
+        *
+        */
+        void setCharacter(uint32_t id, const AbstractRPGCharacter& character);
+
+        /*!
+        * @brief Remove an entity
+        * @param id : Identifier of the entity.
+        *
+        */
+        void removeEntity(uint32_t id);
+
+        /*!
+        * @brief Exchange packets with clients
+        *
+        * Processes hello, acknowledgement and bye packets, forgets silent clients, then sends each client a snapshot if it has something new and budget allows.
+        *
+        */
+        void update();
+
+        /*!
+        * @brief Get number of clients
+        * @return Number of clients receiving snapshots
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getClientCount() const;
+
+        /*!
+        * @brief Get number of bytes sent since creation
+        * @return Size of all sent packets in bytes
+        *
+        * Constant method.
+        *
+        */
+        uint64_t getSentBytes() const;
+
+    protected:
+        /*!
+        * @brief Spectator receiving snapshots
+        */
+        struct Client
+        {
+            sf::IpAddress address; /*!< Address of the client. */
+            unsigned short port; /*!< Port of the client. */
+            uint32_t last_sequence; /*!< Sequence of the last snapshot sent. 0 if none. */
+            uint32_t acked_sequence; /*!< Sequence of the latest snapshot acknowledged. 0 if none. */
+            uint32_t next_entity; /*!< Identifier from which changes are written, so that changes left out by the budget go first. */
+            float budget; /*!< Bytes that can be sent right now. */
+            float idle_time; /*!< Time since last packet from client in seconds. */
+            float silent_time; /*!< Time since last snapshot sent to client in seconds. */
+            std::vector<QuantizedSnapshot> history; /*!< Snapshots sent, indexed by sequence modulo REPLICATION_HISTORY_SIZE. */
+            std::vector<uint32_t> history_sequences; /*!< Sequence of each history snapshot. 0 if slot is empty. */
+        };
+
+        /*!
+        * @brief Change of an entity against a baseline
+        */
+        struct Change
+        {
+            uint32_t id; /*!< Identifier of the entity. */
+            uint32_t fields; /*!< Mask of changed fields. */
+            const QuantizedEntity* entity; /*!< Current state or NULL if entity has been removed. */
+            bool written; /*!< Whether change fit in the packet. */
+        };
+
+        sf::UdpSocket m_socket; /*!< Socket exchanging packets with clients. */
+        bool m_started; /*!< Whether socket is bound. */
+        unsigned int m_bytes_per_second; /*!< Bandwidth budget of each client. */
+        std::map<uint32_t, ReplicatedEntity> m_entities; /*!< State of entities indexed by identifier. */
+        std::vector<Client> m_clients; /*!< Clients receiving snapshots. */
+        QuantizedSnapshot m_current; /*!< Quantized state of entities for current update. */
+        std::vector<Change> m_changes; /*!< Changes against the baseline of the client being processed. */
+        BitStream m_stream; /*!< Packet being built or read. */
+        sf::Clock m_clock; /*!< Clock measuring time between updates. */
+        uint64_t m_sent_bytes; /*!< Number of bytes sent. */
+
+        /*!
+        * @brief Process packets received from clients
+        * @param elapsed : Time since previous update in seconds.
+        *
+        */
+        void receivePackets(float elapsed);
+
+        /*!
+        * @brief Find a client
+        * @param address : Address of the client.
+        * @param port : Port of the client.
+        * @return Client or NULL if no client uses this address and port
+        *
+        */
+        Client* findClient(const sf::IpAddress& address, unsigned short port);
+
+        /*!
+        * @brief Send a snapshot to a client
+        * @param client : Client to send to.
+        *
+        * Does nothing if client is up to date or budget is too low.
+        *
+        */
+        void sendSnapshot(Client& client);
+
+        /*!
+        * @brief Get the latest acknowledged snapshot of a client
+        * @param client : Client whose baseline is requested.
+        * @return Snapshot or NULL if client acknowledged nothing still in history
+        *
+        * Constant method.
+        *
+        */
+        const QuantizedSnapshot* getBaseline(const Client& client) const;
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,189 @@
+/*!
+ * @file SceneFormat.h
+ * @brief Binary layout of scene files.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of the records composing binary scene files. <br>
+ * A scene file is made of a header followed by sections of fixed size records: textures, layers, sprites, tilemaps, tiles and a string table. <br>
+ * Every section starts on an 8 bytes boundary so that the file can be memory-mapped and records read in place. Values are stored in little endian.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef SCENE_FORMAT_H
+#define SCENE_FORMAT_H
+
+#include <stdint.h>
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    const uint32_t SCENE_FILE_MAGIC = 0x43534853; /*!< "SHSC" in little endian. */
+    const uint16_t SCENE_FILE_VERSION = 1; /*!< Current version of scene files. */
+    const uint16_t SCENE_SPRITE_FULL_TEXTURE = 0x0001; /*!< Sprite flag indicating sprite uses the whole texture and texture rect is ignored. */
+    const uint16_t SCENE_EMPTY_TILE = 0xFFFF; /*!< Tile index of empty tiles. */
+
+    /*!
+    * @brief Header of scene files
+    */
+    struct SceneFileHeader
+    {
+        uint32_t magic; /*!< SCENE_FILE_MAGIC. */
+        uint16_t version; /*!< SCENE_FILE_VERSION. */
+        uint16_t reserved; /*!< Unused. Must be 0. */
+        uint32_t texture_count; /*!< Number of texture records. */
+        uint32_t layer_count; /*!< Number of layer records. */
+        uint32_t sprite_count; /*!< Number of sprite records. */
+        uint32_t tilemap_count; /*!< Number of tilemap records. */
+        uint32_t tile_count; /*!< Number of tiles. */
+        uint32_t strings_size; /*!< Size of string table in bytes. */
+        uint64_t textures_offset; /*!< Offset of texture records from file start. */
+        uint64_t layers_offset; /*!< Offset of layer records from file start. */
+        uint64_t sprites_offset; /*!< Offset of sprite records from file start. */
+        uint64_t tilemaps_offset; /*!< Offset of tilemap records from file start. */
+        uint64_t tiles_offset; /*!< Offset of tiles from file start. */
+        uint64_t strings_offset; /*!< Offset of string table from file start. */
+    };
+
+    /*!
+    * @brief Texture referenced by sprites and tilemaps
+    */
+    struct SceneTextureRecord
+    {
+        uint32_t path_offset; /*!< Offset of texture path in string table. Path is relative to scene file directory. */
+        uint32_t path_length; /*!< Length of texture path in bytes, without terminating character. */
+    };
+
+    /*!
+    * @brief Rendering layer
+    *
+    * Tilemaps of a layer are drawn before its sprites.
+    *
+    */
+    struct SceneLayerRecord
+    {
+        uint32_t first_sprite; /*!< Index of the first sprite record of the layer. */
+        uint32_t sprite_count; /*!< Number of sprites of the layer. */
+        uint32_t first_tilemap; /*!< Index of the first tilemap record of the layer. */
+        uint32_t tilemap_count; /*!< Number of tilemaps of the layer. */
+    };
+
+    /*!
+    * @brief Sprite instance
+    */
+    struct SceneSpriteRecord
+    {
+        float x; /*!< Horizontal position. */
+        float y; /*!< Vertical position. */
+        float scale_x; /*!< Horizontal scale factor. */
+        float scale_y; /*!< Vertical scale factor. */
+        float rotation; /*!< Rotation in degrees. */
+        float origin_x; /*!< Horizontal origin of transformations. */
+        float origin_y; /*!< Vertical origin of transformations. */
+        int32_t rect_left; /*!< Left of texture rect. */
+        int32_t rect_top; /*!< Top of texture rect. */
+        int32_t rect_width; /*!< Width of texture rect. */
+        int32_t rect_height; /*!< Height of texture rect. */
+        uint8_t color[4]; /*!< Red, green, blue and alpha components of sprite color. */
+        uint16_t texture; /*!< Index of texture record. */
+        uint16_t flags; /*!< Combination of SCENE_SPRITE_ flags. */
+    };
+
+    /*!
+    * @brief Grid of tiles taken from a tileset texture
+    */
+    struct SceneTilemapRecord
+    {
+        float x; /*!< Horizontal position of the top left corner of the tilemap. */
+        float y; /*!< Vertical position of the top left corner of the tilemap. */
+        uint32_t first_tile; /*!< Index of the first tile of the tilemap. Tiles are stored row by row. */
+        uint16_t texture; /*!< Index of tileset texture record. */
+        uint16_t tile_width; /*!< Width of a tile in pixels. */
+        uint16_t tile_height; /*!< Height of a tile in pixels. */
+        uint16_t columns; /*!< Number of tiles per row. */
+        uint16_t rows; /*!< Number of rows of tiles. */
+        uint16_t tileset_columns; /*!< Number of tiles per row in tileset texture. */
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,171 @@
+/*!
+ * @file SceneLoader.h
+ * @brief Class used to load sprite layers from binary scene files.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a loader mapping binary scene files in memory and building sprite layers directly from their records. <br>
+ * Loaded layers are emitted with a signal compatible with SpriteLayersWidget::updateLayersArray. <br>
+ * Inherits from QObject
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef SCENE_LOADER_H
+#define SCENE_LOADER_H
+
+#include <memory>
+#include <vector>
+#include <QObject>
+#include <QString>
+#include <SFML/Graphics.hpp>
+
+#include "SceneFormat.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class SceneLoader
+    * \brief Class allowing to build sprite layers from binary scene files.
+    *
+    * Definition of a class reading scene files produced by the SceneCompiler tool. <br>
+    * The file is memory-mapped and its records are converted to sprites in place, without any text parsing. Tilemaps are expanded into one sprite per non empty tile. <br>
+    * Textures used by the sprites are handed over with them in sceneLoaded, so receivers keep them alive as long as they keep the sprites. <br>
+    * The loader keeps nothing once a scene is emitted. Textures come from SharedResources, so scenes shown in several widgets upload them once.
+    *
+    */
+    class SceneLoader : public QObject
+    {
+        Q_OBJECT
+    public:
+        /*!
+        * @brief Constructor of the SceneLoader class
+        *
+        * Creates a loader with no scene loaded.
+        *
+        */
+        SceneLoader();
+
+        /*!
+        * @brief Destructor of the SceneLoader class
+        *
+        * Virtual method. Does nothing.
+        *
+        */
+        virtual ~SceneLoader() = default;
+
+    public slots:
+        /*!
+        * @brief Load a scene file
+        * @param path : Path of the binary scene file.
+        * @return True if scene has been loaded
+        *
+        * On success, emits sceneLoaded with the new sprites. On failure, nothing is emitted and receivers keep their previous scene. <br>
+        * Slot.
+        *
+        */
+        bool load(const QString& path);
+
+    signals:
+        /*!
+        * @brief Signal emitted when a scene has been loaded
+        * @param sprite_layers : Array of sprite vectors, one per layer.
+        * @param textures : Textures used by the sprites. Receivers must hold them as long as they use the sprites, whatever the connection type.
+        *
+        */
+        void sceneLoaded(std::vector< std::vector<sf::Sprite> > sprite_layers, std::vector< std::shared_ptr<const sf::Texture> > textures);
+
+    protected:
+        /*!
+        * @brief Check that all sections of a mapped scene lie within the file
+        * @param header : Header of the scene file.
+        * @param file_size : Size of the scene file in bytes.
+        * @return True if sections are within file bounds and correctly aligned
+        *
+        * Static method.
+        *
+        */
+        static bool checkSections(const SceneFileHeader& header, uint64_t file_size);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,344 @@
+/*!
+ * @file WorldStreamer.h
+ * @brief Class used to stream map regions around the camera.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Definition of a region streaming system dividing the world into a grid of cells. <br>
+ * Cells within a radius of the view are built on background threads, then attached to the layer renderer a few at a time. Distant cells are evicted when a memory budget is exceeded. <br>
+ * Inherits from QObject
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef WORLD_STREAMER_H
+#define WORLD_STREAMER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <QObject>
+#include <SFML/Graphics.hpp>
+
+#include "include/Core/JobSystem.h"
+
+/*!
+* @namespace ShadeEngine
+* @brief A namespace used to regroup all classes associated with ShadeEngine library
+*/
+namespace ShadeEngine
+{
+    /*! \class WorldStreamer
+    * \brief Class allowing to load and evict world cells around the view in the background.
+    *
+    * Definition of a class scheduling cell builds on its own worker threads or on a JobSystem and handing built cells to the renderer. <br>
+    * Built cells are emitted with chunkReady and evicted cells with chunkEvicted, which match SpriteLayersWidget::attachChunk and SpriteLayersWidget::detachChunk. <br>
+    * update must be called from the thread owning the streamer, typically once per frame.
+    *
+    */
+    class WorldStreamer : public QObject
+    {
+        Q_OBJECT
+    public:
+        /*!
+        * @brief Function building the sprite layers of a cell
+        *
+        * Receives cell coordinates and fills one sprite vector per layer. Returns false if cell could not be built. The cell is then requested again after a delay doubling on each failure, up to 256 updates. <br>
+        * Called on worker threads, so it must only reference textures that are already loaded and must not touch the renderer.
+        *
+        */
+        typedef std::function<bool(int cell_x, int cell_y, std::vector< std::vector<sf::Sprite> >& layers)> CellBuilder;
+
+        /*!
+        * @brief Constructor of the WorldStreamer class
+        * @param cell_size : Size of a cell in world units.
+        * @param builder : Function building cells.
+        * @param worker_count : Number of background threads building cells. Default is 2.
+        *
+        */
+        WorldStreamer(const sf::Vector2f& cell_size, CellBuilder builder, unsigned int worker_count = 2);
+
+        /*!
+        * @brief Constructor of the WorldStreamer class
+        * @param cell_size : Size of a cell in world units.
+        * @param builder : Function building cells.
+        * @param jobs : Job system building cells, one job per requested cell. Must outlive the streamer.
+        *
+        */
+        WorldStreamer(const sf::Vector2f& cell_size, CellBuilder builder, JobSystem& jobs);
+
+        /*!
+        * @brief Destructor of the WorldStreamer class
+        *
+        * Virtual method. Stops and joins worker threads, or waits for build jobs already started.
+        *
+        */
+        virtual ~WorldStreamer();
+
+        /*!
+        * @brief Set distance around the view within which cells are loaded
+        * @param radius : Radius in world units. Default is 2 cells.
+        *
+        */
+        void setLoadRadius(float radius);
+
+        /*!
+        * @brief Set memory budget of loaded cells
+        * @param bytes : Estimated size of loaded cells above which cells out of load radius are evicted, farthest first. Default is 64 MB.
+        *
+        */
+        void setMemoryBudget(std::size_t bytes);
+
+        /*!
+        * @brief Set maximal number of cells attached per update
+        * @param count : Number of cells. Default is 2.
+        *
+        * Spreads attachment of cells built at the same time over several frames.
+        *
+        */
+        void setMaxAttachmentsPerUpdate(unsigned int count);
+
+        /*!
+        * @brief Get estimated memory used by loaded cells
+        * @return Estimated size in bytes
+        *
+        * Constant method.
+        *
+        */
+        std::size_t getLoadedMemory() const;
+
+        /*!
+        * @brief Compute key of a cell
+        * @param cell_x : Horizontal cell coordinate.
+        * @param cell_y : Vertical cell coordinate.
+        * @return Key identifying the cell in chunkReady and chunkEvicted
+        *
+        * Static method.
+        *
+        */
+        static quint64 getCellKey(int cell_x, int cell_y);
+
+    public slots:
+        /*!
+        * @brief Update streaming around the view
+        * @param view_center : Center of the view in world units.
+        *
+        * Requests missing cells within load radius (nearest first), attaches built cells and evicts distant ones if over budget. <br>
+        * Slot.
+        *
+        */
+        void update(const sf::Vector2f& view_center);
+
+    signals:
+        /*!
+        * @brief Signal emitted when a built cell must be attached to the renderer
+        * @param key : Key of the cell.
+        * @param chunk_layers : Sprite layers of the cell.
+        *
+        */
+        void chunkReady(quint64 key, std::vector< std::vector<sf::Sprite> > chunk_layers);
+
+        /*!
+        * @brief Signal emitted when a cell must be detached from the renderer
+        * @param key : Key of the cell.
+        *
+        */
+        void chunkEvicted(quint64 key);
+
+    protected:
+        /*!
+        * @brief Streaming states of a cell
+        */
+        enum CellStatus
+        {
+            CELL_REQUESTED, /*!< Cell is queued or being built. */
+            CELL_LOADED /*!< Cell is attached to the renderer. */
+        };
+
+        /*!
+        * @brief Streaming information of a cell
+        */
+        struct CellState
+        {
+            CellStatus status; /*!< Streaming state. */
+            std::size_t memory; /*!< Estimated memory used by the cell once loaded. */
+        };
+
+        /*!
+        * @brief Retry information of a cell whose build failed
+        */
+        struct FailedCell
+        {
+            unsigned int attempts; /*!< Number of failed builds in a row. */
+            quint64 retry_update; /*!< Update from which the cell may be requested again. */
+        };
+
+        /*!
+        * @brief Cell built by a worker thread
+        */
+        struct BuiltCell
+        {
+            quint64 key; /*!< Key of the cell. */
+            bool valid; /*!< False if builder failed. */
+            std::vector< std::vector<sf::Sprite> > layers; /*!< Sprite layers of the cell. */
+        };
+
+        sf::Vector2f m_cell_size; /*!< Size of a cell in world units. */
+        CellBuilder m_builder; /*!< Function building cells. */
+        float m_load_radius; /*!< Radius around the view within which cells are loaded. */
+        std::size_t m_memory_budget; /*!< Estimated memory above which distant cells are evicted. */
+        unsigned int m_max_attachments; /*!< Maximal number of cells attached per update. */
+        std::size_t m_loaded_memory; /*!< Estimated memory used by loaded cells. */
+        sf::Vector2f m_view_center; /*!< View center of last update. */
+        quint64 m_update_count; /*!< Number of updates since creation. */
+        std::unordered_map<quint64, CellState> m_cells; /*!< Cells requested or loaded. Only accessed by owning thread. */
+        std::unordered_map<quint64, FailedCell> m_failed_cells; /*!< Cells within load radius whose last build failed. Only accessed by owning thread. */
+
+        std::mutex m_queue_mutex; /*!< Mutex protecting requests and built cells. */
+        std::condition_variable m_queue_condition; /*!< Condition notified when requests are added or workers must stop. */
+        std::deque<quint64> m_requests; /*!< Keys of cells to build, nearest first. */
+        std::deque<BuiltCell> m_built_cells; /*!< Cells built and waiting for attachment. */
+        bool m_stopping; /*!< Flag indicating workers must stop. */
+        std::vector<std::thread> m_workers; /*!< Worker threads building cells. Empty when using a job system. */
+        JobSystem* m_jobs; /*!< Job system building cells or NULL. */
+        JobCounter m_build_jobs; /*!< Build jobs not finished. */
+
+        /*!
+        * @brief Constructor of the WorldStreamer class shared by public constructors
+        * @param cell_size : Size of a cell in world units.
+        * @param builder : Function building cells.
+        * @param jobs : Job system building cells or NULL to use worker threads.
+        * @param worker_count : Number of background threads building cells. Ignored if jobs is not NULL.
+        *
+        */
+        WorldStreamer(const sf::Vector2f& cell_size, CellBuilder builder, JobSystem* jobs, unsigned int worker_count);
+
+        /*!
+        * @brief Main loop of worker threads
+        *
+        */
+        void workerLoop();
+
+        /*!
+        * @brief Build a cell and queue it for attachment
+        * @param key : Key of the cell.
+        *
+        * Called without holding the queue mutex.
+        *
+        */
+        void buildCell(quint64 key);
+
+        /*!
+        * @brief Check if a cell is within load radius of the view
+        * @param key : Key of the cell.
+        * @return True if cell should be loaded
+        *
+        * Constant method.
+        *
+        */
+        bool isWanted(quint64 key) const;
+
+        /*!
+        * @brief Compute squared distance between a cell center and the view center
+        * @param key : Key of the cell.
+        * @return Squared distance in world units
+        *
+        * Constant method.
+        *
+        */
+        float getSquaredDistance(quint64 key) const;
+
+        /*!
+        * @brief Estimate memory used by sprite layers
+        * @param layers : Sprite layers.
+        * @return Estimated size in bytes
+        *
+        * Static method.
+        *
+        */
+        static std::size_t estimateMemory(const std::vector< std::vector<sf::Sprite> >& layers);
+    };
+}
+
+#endif
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -2,6 +2,7 @@
 #define CREATE_SPRITE_LIST_H
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <vector>
 #include <QObject>
 #include <QTimer>
@@ -23,7 +24,7 @@ namespace ShadeEngine
 
     protected:
         unsigned int m_mode;
-        std::vector<sf::Texture> m_textures_list;
+        std::vector< std::shared_ptr<const sf::Texture> > m_textures_list;
         QTimer m_update_timer;
         std::vector< std::vector<sf::Sprite> > m_sprite_layers;
 
@@ -3,6 +3,7 @@
 #include "include/Test/TestShadeWidget.h"
 #include "include/Graphics/SpriteLayersWidget.h"
 #include "include/Test/CreateSpriteList.h"
+#include "include/Graphics/SharedResources.h"
 
 int main(int argc, char *argv[])
 {
@@ -17,5 +18,7 @@ int main(int argc, char *argv[])
     ShadeEngine::CreateSpriteList list;
     QObject::connect(&list, SIGNAL(spriteListUpdated(std::vector<std::vector<sf::Sprite> >)), &w2, SLOT(updateLayersArray(std::vector<std::vector<sf::Sprite> >)));
 
-    return a.exec();
+    int result = a.exec();
+    ShadeEngine::SharedResources::getInstance().releaseAll(); // Cached textures must not outlive SFML
+    return result;
 }
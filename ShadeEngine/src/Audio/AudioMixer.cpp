@@ -0,0 +1,328 @@
+/*!
+ * @file AudioMixer.cpp
+ * @brief Class used to play sound effects and music.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of an audio manager playing sounds on a fixed pool of voices. <br>
+ * Sounds triggered during a frame are merged and started together on update. When all voices are busy, the least important sound is stopped to make room.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Audio/AudioMixer.h"
+#include "include/Core/Tracer.h"
+
+#include <algorithm>
+
+namespace
+{
+    const std::size_t TRIGGERS_RESERVED = 64; // Triggers expected per frame, more only cost one allocation
+
+    float clampVolume(float volume)
+    {
+        return std::max(0.f, std::min(100.f, volume));
+    }
+}
+
+namespace ShadeEngine
+{
+    AudioMixer::AudioMixer(std::unique_ptr<AbstractAudioDevice> device) : m_device(std::move(device)), m_sound_volume(100.f), m_music_volume(100.f),
+        m_active_voice_count(0), m_start_count(0), m_stolen_count(0), m_dropped_count(0), m_merged_count(0)
+    {
+        Voice free_voice;
+        free_voice.priority = 0;
+        free_voice.volume = 0.f;
+        free_voice.start_order = 0;
+        m_voices.resize(m_device->getVoiceCount(), free_voice);
+        m_triggers.reserve(TRIGGERS_RESERVED);
+    }
+
+    AudioMixer::~AudioMixer()
+    {
+        stopAllSounds();
+        m_device->stopMusic();
+    }
+
+    std::shared_ptr<const sf::SoundBuffer> AudioMixer::getSoundBuffer(const std::string &path)
+    {
+        std::map< std::string, std::shared_ptr<const sf::SoundBuffer> >::iterator it = m_buffers.find(path);
+        if(it != m_buffers.end())
+        {
+            return it->second;
+        }
+
+        SHADE_ENGINE_TRACE_SCOPE("AudioMixer::loadSoundBuffer");
+        std::shared_ptr<sf::SoundBuffer> buffer = std::make_shared<sf::SoundBuffer>();
+        if(!buffer->loadFromFile(path))
+        {
+            return std::shared_ptr<const sf::SoundBuffer>();
+        }
+        m_buffers[path] = buffer;
+        return buffer;
+    }
+
+    void AudioMixer::releaseUnused()
+    {
+        std::map< std::string, std::shared_ptr<const sf::SoundBuffer> >::iterator it = m_buffers.begin();
+        while(it != m_buffers.end())
+        {
+            if(it->second.use_count() == 1) // Held by the cache only, voices and triggers hold their own reference
+            {
+                it = m_buffers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void AudioMixer::trigger(const std::shared_ptr<const sf::SoundBuffer> &buffer, int priority, float volume, float pitch)
+    {
+        if(!buffer)
+        {
+            return;
+        }
+
+        for(std::vector<Trigger>::iterator it = m_triggers.begin(); it != m_triggers.end(); ++it)
+        {
+            if(it->buffer == buffer) // Same sound twice in a frame only sounds louder, play it once
+            {
+                it->priority = std::max(it->priority, priority);
+                it->volume = std::max(it->volume, clampVolume(volume));
+                ++m_merged_count;
+                return;
+            }
+        }
+
+        Trigger new_trigger;
+        new_trigger.buffer = buffer;
+        new_trigger.priority = priority;
+        new_trigger.volume = clampVolume(volume);
+        new_trigger.pitch = pitch;
+        m_triggers.push_back(new_trigger);
+    }
+
+    void AudioMixer::update()
+    {
+        for(unsigned int voice = 0; voice < m_voices.size(); ++voice)
+        {
+            if(m_voices[voice].buffer && !m_device->isVoicePlaying(voice))
+            {
+                releaseVoice(voice);
+            }
+        }
+
+        // Most important sounds pick voices first. Stable insertion sort, as std::stable_sort may allocate and triggers are few
+        for(std::size_t i = 1; i < m_triggers.size(); ++i)
+        {
+            Trigger sorted_trigger = std::move(m_triggers[i]);
+            std::size_t j = i;
+            for(; j > 0 && m_triggers[j - 1].priority < sorted_trigger.priority; --j)
+            {
+                m_triggers[j] = std::move(m_triggers[j - 1]);
+            }
+            m_triggers[j] = std::move(sorted_trigger);
+        }
+        uint64_t first_new_start = m_start_count;
+        for(std::vector<Trigger>::iterator it = m_triggers.begin(); it != m_triggers.end(); ++it)
+        {
+            unsigned int voice = findVoice(it->priority, first_new_start);
+            if(voice == m_voices.size())
+            {
+                ++m_dropped_count;
+                continue;
+            }
+            if(m_voices[voice].buffer)
+            {
+                releaseVoice(voice);
+                ++m_stolen_count;
+            }
+
+            m_voices[voice].buffer = it->buffer;
+            m_voices[voice].priority = it->priority;
+            m_voices[voice].volume = it->volume;
+            m_voices[voice].start_order = m_start_count++;
+            m_device->playVoice(voice, *it->buffer, it->volume * m_sound_volume / 100.f, it->pitch);
+            ++m_active_voice_count;
+        }
+        m_triggers.clear(); // Keeps capacity so that steady state triggering does not allocate
+    }
+
+    void AudioMixer::stopAllSounds()
+    {
+        for(unsigned int voice = 0; voice < m_voices.size(); ++voice)
+        {
+            if(m_voices[voice].buffer)
+            {
+                releaseVoice(voice);
+            }
+        }
+        m_triggers.clear();
+    }
+
+    bool AudioMixer::playMusic(const std::string &path, bool loop)
+    {
+        return m_device->playMusic(path, m_music_volume, loop);
+    }
+
+    void AudioMixer::stopMusic()
+    {
+        m_device->stopMusic();
+    }
+
+    void AudioMixer::setSoundVolume(float volume)
+    {
+        m_sound_volume = clampVolume(volume);
+        for(unsigned int voice = 0; voice < m_voices.size(); ++voice)
+        {
+            if(m_voices[voice].buffer)
+            {
+                m_device->setVoiceVolume(voice, m_voices[voice].volume * m_sound_volume / 100.f);
+            }
+        }
+    }
+
+    float AudioMixer::getSoundVolume() const
+    {
+        return m_sound_volume;
+    }
+
+    void AudioMixer::setMusicVolume(float volume)
+    {
+        m_music_volume = clampVolume(volume);
+        m_device->setMusicVolume(m_music_volume);
+    }
+
+    float AudioMixer::getMusicVolume() const
+    {
+        return m_music_volume;
+    }
+
+    AbstractAudioDevice& AudioMixer::getDevice()
+    {
+        return *m_device;
+    }
+
+    unsigned int AudioMixer::getActiveVoiceCount() const
+    {
+        return m_active_voice_count;
+    }
+
+    uint64_t AudioMixer::getStolenCount() const
+    {
+        return m_stolen_count;
+    }
+
+    uint64_t AudioMixer::getDroppedCount() const
+    {
+        return m_dropped_count;
+    }
+
+    uint64_t AudioMixer::getMergedCount() const
+    {
+        return m_merged_count;
+    }
+
+    unsigned int AudioMixer::findVoice(int priority, uint64_t first_new_start) const
+    {
+        unsigned int victim = static_cast<unsigned int>(m_voices.size());
+        for(unsigned int voice = 0; voice < m_voices.size(); ++voice)
+        {
+            const Voice& current = m_voices[voice];
+            if(!current.buffer)
+            {
+                return voice;
+            }
+            if(current.priority <= priority && current.start_order < first_new_start && (victim == m_voices.size() || current.priority < m_voices[victim].priority ||
+               (current.priority == m_voices[victim].priority && current.start_order < m_voices[victim].start_order)))
+            {
+                victim = voice;
+            }
+        }
+        return victim;
+    }
+
+    void AudioMixer::releaseVoice(unsigned int voice)
+    {
+        m_device->stopVoice(voice);
+        m_voices[voice].buffer.reset();
+        --m_active_voice_count;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
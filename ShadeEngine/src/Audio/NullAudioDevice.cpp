@@ -0,0 +1,184 @@
+/*!
+ * @file NullAudioDevice.cpp
+ * @brief Audio output producing no sound.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of an audio device simulating voices. <br>
+ * Allows to run the mixer on machines without sound card, such as build servers, and to check which sounds would have been played.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Audio/NullAudioDevice.h"
+
+namespace ShadeEngine
+{
+    NullAudioDevice::NullAudioDevice(unsigned int voice_count) : m_music_playing(false), m_play_count(0)
+    {
+        Voice stopped_voice;
+        stopped_voice.buffer = NULL;
+        stopped_voice.volume = 0.f;
+        stopped_voice.remaining = 0.f;
+        m_voices.resize(voice_count, stopped_voice);
+    }
+
+    unsigned int NullAudioDevice::getVoiceCount() const
+    {
+        return static_cast<unsigned int>(m_voices.size());
+    }
+
+    void NullAudioDevice::playVoice(unsigned int voice, const sf::SoundBuffer &buffer, float volume, float pitch)
+    {
+        m_voices[voice].buffer = &buffer;
+        m_voices[voice].volume = volume;
+        m_voices[voice].remaining = pitch > 0.f ? buffer.getDuration().asSeconds() / pitch : 0.f;
+        ++m_play_count;
+    }
+
+    void NullAudioDevice::stopVoice(unsigned int voice)
+    {
+        m_voices[voice].buffer = NULL;
+        m_voices[voice].remaining = 0.f;
+    }
+
+    void NullAudioDevice::setVoiceVolume(unsigned int voice, float volume)
+    {
+        m_voices[voice].volume = volume;
+    }
+
+    bool NullAudioDevice::isVoicePlaying(unsigned int voice) const
+    {
+        return m_voices[voice].buffer != NULL;
+    }
+
+    bool NullAudioDevice::playMusic(const std::string &path, float volume, bool loop)
+    {
+        (void)path;
+        (void)volume;
+        (void)loop;
+        m_music_playing = true;
+        return true;
+    }
+
+    void NullAudioDevice::stopMusic()
+    {
+        m_music_playing = false;
+    }
+
+    void NullAudioDevice::setMusicVolume(float volume)
+    {
+        (void)volume;
+    }
+
+    bool NullAudioDevice::isMusicPlaying() const
+    {
+        return m_music_playing;
+    }
+
+    void NullAudioDevice::advance(sf::Time elapsed)
+    {
+        float elapsed_seconds = elapsed.asSeconds();
+        for(std::vector<Voice>::iterator it = m_voices.begin(); it != m_voices.end(); ++it)
+        {
+            if(it->buffer != NULL)
+            {
+                it->remaining -= elapsed_seconds;
+                if(it->remaining <= 0.f)
+                {
+                    it->buffer = NULL; // Sound reached its end
+                }
+            }
+        }
+    }
+
+    const sf::SoundBuffer* NullAudioDevice::getVoiceBuffer(unsigned int voice) const
+    {
+        return m_voices[voice].buffer;
+    }
+
+    float NullAudioDevice::getVoiceVolume(unsigned int voice) const
+    {
+        return m_voices[voice].volume;
+    }
+
+    uint64_t NullAudioDevice::getPlayCount() const
+    {
+        return m_play_count;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,164 @@
+/*!
+ * @file SFMLAudioDevice.cpp
+ * @brief Audio output playing sounds through SFML.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of the audio device used in production. <br>
+ * Voices are sf::Sound objects created once. Music is an sf::Music, streamed by SFML on its own thread.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Audio/SFMLAudioDevice.h"
+
+namespace ShadeEngine
+{
+    SFMLAudioDevice::SFMLAudioDevice(unsigned int voice_count) : m_voices(voice_count)
+    {
+    }
+
+    SFMLAudioDevice::~SFMLAudioDevice()
+    {
+        m_music.stop();
+        for(std::vector<sf::Sound>::iterator it = m_voices.begin(); it != m_voices.end(); ++it)
+        {
+            it->stop();
+            it->resetBuffer();
+        }
+    }
+
+    unsigned int SFMLAudioDevice::getVoiceCount() const
+    {
+        return static_cast<unsigned int>(m_voices.size());
+    }
+
+    void SFMLAudioDevice::playVoice(unsigned int voice, const sf::SoundBuffer &buffer, float volume, float pitch)
+    {
+        sf::Sound& sound = m_voices[voice];
+        sound.stop();
+        sound.setBuffer(buffer);
+        sound.setVolume(volume);
+        sound.setPitch(pitch);
+        sound.play();
+    }
+
+    void SFMLAudioDevice::stopVoice(unsigned int voice)
+    {
+        m_voices[voice].stop();
+        m_voices[voice].resetBuffer(); // Buffer may be released by the mixer right after
+    }
+
+    void SFMLAudioDevice::setVoiceVolume(unsigned int voice, float volume)
+    {
+        m_voices[voice].setVolume(volume);
+    }
+
+    bool SFMLAudioDevice::isVoicePlaying(unsigned int voice) const
+    {
+        return m_voices[voice].getStatus() == sf::SoundSource::Playing;
+    }
+
+    bool SFMLAudioDevice::playMusic(const std::string &path, float volume, bool loop)
+    {
+        m_music.stop();
+        if(!m_music.openFromFile(path))
+        {
+            return false;
+        }
+        m_music.setVolume(volume);
+        m_music.setLoop(loop);
+        m_music.play();
+        return true;
+    }
+
+    void SFMLAudioDevice::stopMusic()
+    {
+        m_music.stop();
+    }
+
+    void SFMLAudioDevice::setMusicVolume(float volume)
+    {
+        m_music.setVolume(volume);
+    }
+
+    bool SFMLAudioDevice::isMusicPlaying() const
+    {
+        return m_music.getStatus() == sf::SoundSource::Playing;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
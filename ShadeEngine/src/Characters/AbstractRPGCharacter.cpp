@@ -67,38 +67,122 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "include/Characters/AbstractRPGCharacter.h"
 
+#include <algorithm>
+
 namespace ShadeEngine
 {
     AbstractRPGCharacter::AbstractRPGCharacter(uint8_t level_max, bool can_level_down) : QObject(), m_level(1), m_level_max(level_max),
-        m_can_level_down(can_level_down), m_xp(0)
+        m_can_level_down(can_level_down), m_xp(0), m_level_event_channel(NULL)
+    {
+    }
+
+    uint8_t AbstractRPGCharacter::getLevel() const
+    {
+        return m_level;
+    }
+
+    uint8_t AbstractRPGCharacter::getLevelMax() const
+    {
+        return m_level_max;
+    }
+
+    uint64_t AbstractRPGCharacter::getXP() const
+    {
+        return m_xp;
+    }
+
+    bool AbstractRPGCharacter::canLevelDown() const
+    {
+        return m_can_level_down;
+    }
+
+    bool AbstractRPGCharacter::restoreState(uint8_t level, uint64_t xp)
+    {
+        level = std::max<uint8_t>(1, std::min(level, m_level_max)); // Clamp level between 1 and level max
+        uint64_t min_xp = (m_can_level_down && level > 1) ? getLevelXp(level - 1) : getLevelXp(level); // loseXP only levels down below XP of previous level
+        if(xp > getLevelXp(m_level_max) || (level < m_level_max && xp >= getLevelXp(level + 1)) || (level > 1 && xp < min_xp))
+        {
+            return false;
+        }
+        m_level = level;
+        m_xp = xp;
+        return true;
+    }
+
+    void AbstractRPGCharacter::setLevelEventChannel(LevelEventChannel *channel)
     {
+        m_level_event_channel = channel;
+    }
+
+    void AbstractRPGCharacter::applyXP(uint64_t xp, bool is_loss, bool notify)
+    {
+        is_loss ? applyXPLoss(xp, notify) : applyXPGain(xp, notify);
     }
 
     void AbstractRPGCharacter::gainXP(uint64_t m_xp_gained)
+    {
+        applyXPGain(m_xp_gained, true);
+    }
+
+    void AbstractRPGCharacter::loseXP(uint64_t m_xp_lost)
+    {
+        applyXPLoss(m_xp_lost, true);
+    }
+
+    void AbstractRPGCharacter::applyXPGain(uint64_t xp_gained, bool notify)
     {
         if(m_level < m_level_max) // Ignore XP gain if level is equal to level max
         {
-            (m_xp_gained + m_xp > getLevelXp(m_level_max)) && (m_xp = getLevelXp(m_level_max)) || (m_xp += m_xp_gained); // Clamp to XP of level max
-            while(m_level <= m_level_max && m_xp >= getLevelXp(m_level+1)) // Use a while because XP gain can span accross multiple levels
+            uint8_t from_level = m_level;
+            (xp_gained + m_xp > getLevelXp(m_level_max)) && (m_xp = getLevelXp(m_level_max)) || (m_xp += xp_gained); // Clamp to XP of level max
+            while(m_level < m_level_max && m_xp >= getLevelXp(m_level+1)) // Use a while because XP gain can span accross multiple levels
             {
                 ++m_level;
-                onLevelUp();
+                if(notify)
+                {
+                    onLevelUp();
+                }
+            }
+            if(notify)
+            {
+                publishLevelChange(from_level); // Levels crossed are coalesced in a single event
             }
         }
     }
 
-    void AbstractRPGCharacter::loseXP(uint64_t m_xp_lost)
+    void AbstractRPGCharacter::applyXPLoss(uint64_t xp_lost, bool notify)
     {
         if(m_can_level_down && m_xp > 0) // Ignore XP loss if XP is equal to 0 or if character cannot level down
         {
-            (m_xp_lost >= m_xp) && (m_xp = 0) || (m_xp -= m_xp_lost); // Clamp to 0
+            uint8_t from_level = m_level;
+            (xp_lost >= m_xp) && (m_xp = 0) || (m_xp -= xp_lost); // Clamp to 0
             while(m_level > 1 && m_xp < getLevelXp(m_level-1)) // Use a while because XP loss can span accross multiple levels
             {
                 --m_level;
-                onLevelDown();
+                if(notify)
+                {
+                    onLevelDown();
+                }
+            }
+            if(notify)
+            {
+                publishLevelChange(from_level); // Levels crossed are coalesced in a single event
             }
         }
     }
+
+    void AbstractRPGCharacter::publishLevelChange(uint8_t from_level)
+    {
+        if(m_level_event_channel != NULL && m_level != from_level)
+        {
+            LevelEvent event;
+            event.character = this;
+            event.from_level = from_level;
+            event.to_level = m_level;
+            event.xp = m_xp;
+            m_level_event_channel->publish(event);
+        }
+    }
 }
 
 //  ______________________________
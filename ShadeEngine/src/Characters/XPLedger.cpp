@@ -0,0 +1,336 @@
+/*!
+ * @file XPLedger.cpp
+ * @brief Class used to persist and replay RPG characters progression.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of an event-sourced experience ledger. <br>
+ * Every XP gain or loss is appended to a log file as a pair of varints. Periodically, the state of all registered characters is written as a compact binary snapshot. <br>
+ * Loading maps the latest snapshot in memory, restores characters directly from it and only replays the part of the log written after the snapshot.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Characters/XPLedger.h"
+
+#include <cstring>
+#include <QSaveFile>
+
+namespace
+{
+    const uint32_t SNAPSHOT_MAGIC = 0x53505853; // "SXPS" in little endian
+    const uint16_t SNAPSHOT_VERSION = 1;
+}
+
+namespace ShadeEngine
+{
+    XPLedger::XPLedger(const QString &log_path, const QString &snapshot_path) : m_log_path(log_path), m_snapshot_path(snapshot_path),
+        m_log_file(log_path)
+    {
+    }
+
+    XPLedger::~XPLedger()
+    {
+        flush();
+    }
+
+    void XPLedger::registerCharacter(uint32_t id, AbstractRPGCharacter *character)
+    {
+        if(id >= m_characters.size())
+        {
+            m_characters.resize(id + 1, NULL);
+        }
+        m_characters[id] = character;
+    }
+
+    void XPLedger::unregisterCharacter(uint32_t id)
+    {
+        if(id < m_characters.size())
+        {
+            m_characters[id] = NULL;
+        }
+    }
+
+    void XPLedger::recordXPGain(uint32_t id, uint64_t xp)
+    {
+        record(id, xp, false);
+    }
+
+    void XPLedger::recordXPLoss(uint32_t id, uint64_t xp)
+    {
+        record(id, xp, true);
+    }
+
+    bool XPLedger::flush()
+    {
+        if(m_pending_events.empty())
+        {
+            return true;
+        }
+
+        if(!m_log_file.isOpen() && !m_log_file.open(QIODevice::WriteOnly | QIODevice::Append))
+        {
+            return false;
+        }
+
+        qint64 written = m_log_file.write(reinterpret_cast<const char*>(m_pending_events.data()), m_pending_events.size());
+        if(written != static_cast<qint64>(m_pending_events.size()) || !m_log_file.flush())
+        {
+            return false;
+        }
+
+        m_pending_events.clear(); // Keeps capacity so that steady state logging does not allocate
+        return true;
+    }
+
+    bool XPLedger::writeSnapshot()
+    {
+        if(!flush())
+        {
+            return false;
+        }
+
+        std::vector<SnapshotRecord> records;
+        records.reserve(m_characters.size());
+        for(uint32_t id = 0; id < m_characters.size(); ++id)
+        {
+            if(m_characters[id] != NULL)
+            {
+                SnapshotRecord snapshot_record;
+                std::memset(&snapshot_record, 0, sizeof(snapshot_record));
+                snapshot_record.id = id;
+                snapshot_record.level = m_characters[id]->getLevel();
+                snapshot_record.xp = m_characters[id]->getXP();
+                records.push_back(snapshot_record);
+            }
+        }
+
+        SnapshotHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = SNAPSHOT_MAGIC;
+        header.version = SNAPSHOT_VERSION;
+        header.record_size = sizeof(SnapshotRecord);
+        header.record_count = records.size();
+        header.log_offset = m_log_file.isOpen() ? m_log_file.size() : QFile(m_log_path).size();
+
+        QSaveFile snapshot_file(m_snapshot_path); // Written in a temporary file then renamed on commit
+        if(!snapshot_file.open(QIODevice::WriteOnly))
+        {
+            return false;
+        }
+        qint64 records_size = records.size() * sizeof(SnapshotRecord);
+        if(snapshot_file.write(reinterpret_cast<const char*>(&header), sizeof(header)) != sizeof(header) ||
+           snapshot_file.write(reinterpret_cast<const char*>(records.data()), records_size) != records_size)
+        {
+            return false;
+        }
+        return snapshot_file.commit();
+    }
+
+    bool XPLedger::load()
+    {
+        if(!flush())
+        {
+            return false;
+        }
+
+        // Restore states from snapshot
+        uint64_t log_offset = 0;
+        QFile snapshot_file(m_snapshot_path);
+        if(snapshot_file.exists())
+        {
+            if(!snapshot_file.open(QIODevice::ReadOnly) || snapshot_file.size() < static_cast<qint64>(sizeof(SnapshotHeader)))
+            {
+                return false;
+            }
+
+            uchar* snapshot_data = snapshot_file.map(0, snapshot_file.size());
+            if(snapshot_data == NULL)
+            {
+                return false;
+            }
+
+            SnapshotHeader header;
+            std::memcpy(&header, snapshot_data, sizeof(header));
+            uint64_t expected_size = sizeof(SnapshotHeader) + header.record_count * sizeof(SnapshotRecord);
+            if(header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || header.record_size != sizeof(SnapshotRecord) ||
+               expected_size > static_cast<uint64_t>(snapshot_file.size()))
+            {
+                snapshot_file.unmap(snapshot_data);
+                return false;
+            }
+
+            const SnapshotRecord* records = reinterpret_cast<const SnapshotRecord*>(snapshot_data + sizeof(SnapshotHeader)); // Header size keeps records aligned
+            for(uint64_t i = 0; i < header.record_count; ++i)
+            {
+                AbstractRPGCharacter* character = getCharacter(records[i].id);
+                if(character != NULL && !character->restoreState(records[i].level, records[i].xp))
+                {
+                    snapshot_file.unmap(snapshot_data);
+                    return false; // Corrupted record
+                }
+            }
+            log_offset = header.log_offset;
+
+            snapshot_file.unmap(snapshot_data);
+        }
+
+        // Replay log tail
+        QFile log_file(m_log_path);
+        if(!log_file.exists())
+        {
+            return log_offset == 0;
+        }
+        if(!log_file.open(QIODevice::ReadOnly) || static_cast<uint64_t>(log_file.size()) < log_offset)
+        {
+            return false; // Log is older than snapshot
+        }
+
+        uint64_t tail_size = log_file.size() - log_offset;
+        if(tail_size > 0)
+        {
+            uchar* tail = log_file.map(log_offset, tail_size);
+            if(tail == NULL)
+            {
+                return false;
+            }
+            replay(tail, tail_size);
+            log_file.unmap(tail);
+        }
+        return true;
+    }
+
+    void XPLedger::record(uint32_t id, uint64_t xp, bool is_loss)
+    {
+        AbstractRPGCharacter* character = getCharacter(id);
+        if(character == NULL)
+        {
+            return;
+        }
+
+        writeVarint(m_pending_events, (static_cast<uint64_t>(id) << 1) | (is_loss ? 1 : 0)); // Lowest bit stores event type
+        writeVarint(m_pending_events, xp);
+        character->applyXP(xp, is_loss, true); // Same rules as replay, so loading gives back the recorded levels
+    }
+
+    void XPLedger::replay(const uint8_t *data, uint64_t size)
+    {
+        const uint8_t* end = data + size;
+        uint64_t key = 0;
+        uint64_t xp = 0;
+        while(readVarint(data, end, key) && readVarint(data, end, xp)) // Stops on a truncated trailing event
+        {
+            AbstractRPGCharacter* character = getCharacter(static_cast<uint32_t>(key >> 1));
+            if(character != NULL)
+            {
+                character->applyXP(xp, (key & 1) != 0, false); // Level hooks already ran when the event was recorded
+            }
+        }
+    }
+
+    AbstractRPGCharacter* XPLedger::getCharacter(uint32_t id) const
+    {
+        return id < m_characters.size() ? m_characters[id] : NULL;
+    }
+
+    void XPLedger::writeVarint(std::vector<uint8_t> &buffer, uint64_t value)
+    {
+        while(value >= 0x80)
+        {
+            buffer.push_back(static_cast<uint8_t>(value) | 0x80); // 7 bits of payload and a continuation bit
+            value >>= 7;
+        }
+        buffer.push_back(static_cast<uint8_t>(value));
+    }
+
+    bool XPLedger::readVarint(const uint8_t *&data, const uint8_t *end, uint64_t &value)
+    {
+        value = 0;
+        for(unsigned int shift = 0; data != end && shift < 64; shift += 7)
+        {
+            uint8_t byte = *data++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
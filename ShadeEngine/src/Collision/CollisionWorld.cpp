@@ -0,0 +1,454 @@
+/*!
+ * @file CollisionWorld.cpp
+ * @brief Class used to detect collisions between sprites and characters.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a collision world made of box and circle colliders. <br>
+ * A uniform grid broad phase finds colliders sharing cells, then a narrow phase tests their exact shapes. <br>
+ * Collider data is stored as contiguous arrays and only colliders that move are reinserted in the grid.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Collision/CollisionWorld.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ShadeEngine
+{
+    const ColliderId CollisionWorld::INVALID_COLLIDER = 0xFFFFFFFF;
+    const uint32_t CollisionWorld::ALL_MASKS = 0xFFFFFFFF;
+
+    CollisionWorld::CollisionWorld(float cell_size) : m_cell_size(cell_size), m_inverse_cell_size(1.f / cell_size), m_collider_count(0)
+    {
+    }
+
+    ColliderId CollisionWorld::createBox(const sf::FloatRect &box, uint32_t mask)
+    {
+        ColliderId collider = createCollider(COLLIDER_BOX, mask);
+        m_min_x[collider] = box.left;
+        m_min_y[collider] = box.top;
+        m_max_x[collider] = box.left + box.width;
+        m_max_y[collider] = box.top + box.height;
+        m_cell_ranges[collider] = computeCellRange(m_min_x[collider], m_min_y[collider], m_max_x[collider], m_max_y[collider]);
+        insertInCells(collider, m_cell_ranges[collider]);
+        return collider;
+    }
+
+    ColliderId CollisionWorld::createCircle(const sf::Vector2f &center, float radius, uint32_t mask)
+    {
+        ColliderId collider = createCollider(COLLIDER_CIRCLE, mask);
+        m_radiuses[collider] = radius;
+        m_min_x[collider] = center.x - radius;
+        m_min_y[collider] = center.y - radius;
+        m_max_x[collider] = center.x + radius;
+        m_max_y[collider] = center.y + radius;
+        m_cell_ranges[collider] = computeCellRange(m_min_x[collider], m_min_y[collider], m_max_x[collider], m_max_y[collider]);
+        insertInCells(collider, m_cell_ranges[collider]);
+        return collider;
+    }
+
+    void CollisionWorld::destroyCollider(ColliderId collider)
+    {
+        if(!isValid(collider))
+        {
+            return;
+        }
+        removeFromCells(collider, m_cell_ranges[collider]);
+        m_alive[collider] = 0;
+        m_free_ids.push_back(collider);
+        --m_collider_count;
+    }
+
+    bool CollisionWorld::isValid(ColliderId collider) const
+    {
+        return collider < m_alive.size() && m_alive[collider];
+    }
+
+    void CollisionWorld::setBox(ColliderId collider, const sf::FloatRect &box)
+    {
+        if(!isValid(collider))
+        {
+            return;
+        }
+        m_shapes[collider] = COLLIDER_BOX;
+        m_min_x[collider] = box.left;
+        m_min_y[collider] = box.top;
+        m_max_x[collider] = box.left + box.width;
+        m_max_y[collider] = box.top + box.height;
+        updateCells(collider);
+    }
+
+    void CollisionWorld::setCircle(ColliderId collider, const sf::Vector2f &center, float radius)
+    {
+        if(!isValid(collider))
+        {
+            return;
+        }
+        m_shapes[collider] = COLLIDER_CIRCLE;
+        m_radiuses[collider] = radius;
+        m_min_x[collider] = center.x - radius;
+        m_min_y[collider] = center.y - radius;
+        m_max_x[collider] = center.x + radius;
+        m_max_y[collider] = center.y + radius;
+        updateCells(collider);
+    }
+
+    void CollisionWorld::move(ColliderId collider, const sf::Vector2f &offset)
+    {
+        if(!isValid(collider))
+        {
+            return;
+        }
+        m_min_x[collider] += offset.x;
+        m_min_y[collider] += offset.y;
+        m_max_x[collider] += offset.x;
+        m_max_y[collider] += offset.y;
+        updateCells(collider);
+    }
+
+    void CollisionWorld::setMask(ColliderId collider, uint32_t mask)
+    {
+        if(isValid(collider))
+        {
+            m_masks[collider] = mask;
+        }
+    }
+
+    uint32_t CollisionWorld::getMask(ColliderId collider) const
+    {
+        return isValid(collider) ? m_masks[collider] : 0;
+    }
+
+    ColliderShape CollisionWorld::getShape(ColliderId collider) const
+    {
+        return isValid(collider) ? static_cast<ColliderShape>(m_shapes[collider]) : COLLIDER_BOX;
+    }
+
+    sf::FloatRect CollisionWorld::getBounds(ColliderId collider) const
+    {
+        if(!isValid(collider))
+        {
+            return sf::FloatRect();
+        }
+        return sf::FloatRect(m_min_x[collider], m_min_y[collider], m_max_x[collider] - m_min_x[collider], m_max_y[collider] - m_min_y[collider]);
+    }
+
+    std::size_t CollisionWorld::getColliderCount() const
+    {
+        return m_collider_count;
+    }
+
+    void CollisionWorld::findPairs(std::vector<CollisionPair> &pairs) const
+    {
+        pairs.clear();
+        for(std::unordered_map< uint64_t, std::vector<ColliderId> >::const_iterator cell_it = m_cells.begin(); cell_it != m_cells.end(); ++cell_it)
+        {
+            const std::vector<ColliderId>& colliders = cell_it->second;
+            std::size_t collider_count = colliders.size();
+            for(std::size_t i = 0; i < collider_count; ++i)
+            {
+                ColliderId a = colliders[i];
+                for(std::size_t j = i + 1; j < collider_count; ++j)
+                {
+                    ColliderId b = colliders[j];
+                    if((m_masks[a] & m_masks[b]) == 0 ||
+                       m_min_x[a] >= m_max_x[b] || m_min_x[b] >= m_max_x[a] || m_min_y[a] >= m_max_y[b] || m_min_y[b] >= m_max_y[a])
+                    {
+                        continue;
+                    }
+
+                    // Colliders sharing several cells are only reported by the cell holding the top left corner of their overlap
+                    if(getCellKey(getCellCoordinate(std::max(m_min_x[a], m_min_x[b])), getCellCoordinate(std::max(m_min_y[a], m_min_y[b]))) != cell_it->first)
+                    {
+                        continue;
+                    }
+
+                    if(testShapes(a, b))
+                    {
+                        CollisionPair pair;
+                        pair.first = std::min(a, b);
+                        pair.second = std::max(a, b);
+                        pairs.push_back(pair);
+                    }
+                }
+            }
+        }
+    }
+
+    void CollisionWorld::queryArea(const sf::FloatRect &area, std::vector<ColliderId> &colliders, uint32_t mask) const
+    {
+        colliders.clear();
+        float min_x = area.left;
+        float min_y = area.top;
+        float max_x = area.left + area.width;
+        float max_y = area.top + area.height;
+        CellRange range = computeCellRange(min_x, min_y, max_x, max_y);
+        for(int32_t y = range.min_y; y <= range.max_y; ++y)
+        {
+            for(int32_t x = range.min_x; x <= range.max_x; ++x)
+            {
+                std::unordered_map< uint64_t, std::vector<ColliderId> >::const_iterator cell_it = m_cells.find(getCellKey(x, y));
+                if(cell_it == m_cells.end())
+                {
+                    continue;
+                }
+                for(std::vector<ColliderId>::const_iterator collider_it = cell_it->second.begin(); collider_it != cell_it->second.end(); ++collider_it)
+                {
+                    ColliderId c = *collider_it;
+                    if((m_masks[c] & mask) == 0 || m_min_x[c] >= max_x || min_x >= m_max_x[c] || m_min_y[c] >= max_y || min_y >= m_max_y[c])
+                    {
+                        continue;
+                    }
+                    if(getCellCoordinate(std::max(m_min_x[c], min_x)) != x || getCellCoordinate(std::max(m_min_y[c], min_y)) != y) // Reported by another cell
+                    {
+                        continue;
+                    }
+                    if(m_shapes[c] == COLLIDER_CIRCLE)
+                    {
+                        float radius = m_radiuses[c];
+                        float center_x = m_min_x[c] + radius;
+                        float center_y = m_min_y[c] + radius;
+                        float dx = center_x - std::max(min_x, std::min(center_x, max_x));
+                        float dy = center_y - std::max(min_y, std::min(center_y, max_y));
+                        if(dx * dx + dy * dy >= radius * radius)
+                        {
+                            continue;
+                        }
+                    }
+                    colliders.push_back(c);
+                }
+            }
+        }
+    }
+
+    void CollisionWorld::queryPoint(const sf::Vector2f &point, std::vector<ColliderId> &colliders, uint32_t mask) const
+    {
+        colliders.clear();
+        std::unordered_map< uint64_t, std::vector<ColliderId> >::const_iterator cell_it = m_cells.find(getCellKey(getCellCoordinate(point.x), getCellCoordinate(point.y)));
+        if(cell_it == m_cells.end())
+        {
+            return;
+        }
+        for(std::vector<ColliderId>::const_iterator collider_it = cell_it->second.begin(); collider_it != cell_it->second.end(); ++collider_it)
+        {
+            ColliderId c = *collider_it;
+            if((m_masks[c] & mask) == 0 || point.x < m_min_x[c] || point.x >= m_max_x[c] || point.y < m_min_y[c] || point.y >= m_max_y[c])
+            {
+                continue;
+            }
+            if(m_shapes[c] == COLLIDER_CIRCLE)
+            {
+                float radius = m_radiuses[c];
+                float dx = point.x - (m_min_x[c] + radius);
+                float dy = point.y - (m_min_y[c] + radius);
+                if(dx * dx + dy * dy >= radius * radius)
+                {
+                    continue;
+                }
+            }
+            colliders.push_back(c);
+        }
+    }
+
+    void CollisionWorld::releaseEmptyCells()
+    {
+        for(std::unordered_map< uint64_t, std::vector<ColliderId> >::iterator cell_it = m_cells.begin(); cell_it != m_cells.end();)
+        {
+            cell_it->second.empty() ? cell_it = m_cells.erase(cell_it) : ++cell_it;
+        }
+    }
+
+    ColliderId CollisionWorld::createCollider(ColliderShape shape, uint32_t mask)
+    {
+        ColliderId collider;
+        if(!m_free_ids.empty())
+        {
+            collider = m_free_ids.back();
+            m_free_ids.pop_back();
+        }
+        else
+        {
+            collider = static_cast<ColliderId>(m_alive.size());
+            m_min_x.push_back(0.f);
+            m_min_y.push_back(0.f);
+            m_max_x.push_back(0.f);
+            m_max_y.push_back(0.f);
+            m_radiuses.push_back(0.f);
+            m_shapes.push_back(COLLIDER_BOX);
+            m_alive.push_back(0);
+            m_masks.push_back(0);
+            m_cell_ranges.push_back(CellRange());
+        }
+        m_shapes[collider] = shape;
+        m_alive[collider] = 1;
+        m_masks[collider] = mask;
+        ++m_collider_count;
+        return collider;
+    }
+
+    void CollisionWorld::updateCells(ColliderId collider)
+    {
+        CellRange range = computeCellRange(m_min_x[collider], m_min_y[collider], m_max_x[collider], m_max_y[collider]);
+        const CellRange& previous_range = m_cell_ranges[collider];
+        if(range.min_x == previous_range.min_x && range.min_y == previous_range.min_y && range.max_x == previous_range.max_x && range.max_y == previous_range.max_y)
+        {
+            return; // Most moves stay in the same cells
+        }
+        removeFromCells(collider, previous_range);
+        insertInCells(collider, range);
+        m_cell_ranges[collider] = range;
+    }
+
+    void CollisionWorld::insertInCells(ColliderId collider, const CellRange &range)
+    {
+        for(int32_t y = range.min_y; y <= range.max_y; ++y)
+        {
+            for(int32_t x = range.min_x; x <= range.max_x; ++x)
+            {
+                m_cells[getCellKey(x, y)].push_back(collider);
+            }
+        }
+    }
+
+    void CollisionWorld::removeFromCells(ColliderId collider, const CellRange &range)
+    {
+        for(int32_t y = range.min_y; y <= range.max_y; ++y)
+        {
+            for(int32_t x = range.min_x; x <= range.max_x; ++x)
+            {
+                std::vector<ColliderId>& colliders = m_cells[getCellKey(x, y)];
+                std::vector<ColliderId>::iterator collider_it = std::find(colliders.begin(), colliders.end(), collider);
+                if(collider_it != colliders.end())
+                {
+                    *collider_it = colliders.back(); // Order within a cell does not matter
+                    colliders.pop_back();
+                }
+            }
+        }
+    }
+
+    CollisionWorld::CellRange CollisionWorld::computeCellRange(float min_x, float min_y, float max_x, float max_y) const
+    {
+        CellRange range;
+        range.min_x = getCellCoordinate(min_x);
+        range.min_y = getCellCoordinate(min_y);
+        range.max_x = std::max(range.min_x, getCellCoordinate(max_x));
+        range.max_y = std::max(range.min_y, getCellCoordinate(max_y));
+        return range;
+    }
+
+    int32_t CollisionWorld::getCellCoordinate(float coordinate) const
+    {
+        return static_cast<int32_t>(std::floor(coordinate * m_inverse_cell_size));
+    }
+
+    bool CollisionWorld::testShapes(ColliderId first, ColliderId second) const
+    {
+        bool first_circle = m_shapes[first] == COLLIDER_CIRCLE;
+        bool second_circle = m_shapes[second] == COLLIDER_CIRCLE;
+        if(!first_circle && !second_circle)
+        {
+            return true; // Bounding boxes overlap
+        }
+        if(first_circle && second_circle)
+        {
+            float dx = (m_min_x[first] + m_radiuses[first]) - (m_min_x[second] + m_radiuses[second]);
+            float dy = (m_min_y[first] + m_radiuses[first]) - (m_min_y[second] + m_radiuses[second]);
+            float radius_sum = m_radiuses[first] + m_radiuses[second];
+            return dx * dx + dy * dy < radius_sum * radius_sum;
+        }
+
+        // Distance from circle center to closest point of the box
+        ColliderId circle = first_circle ? first : second;
+        ColliderId box = first_circle ? second : first;
+        float radius = m_radiuses[circle];
+        float center_x = m_min_x[circle] + radius;
+        float center_y = m_min_y[circle] + radius;
+        float dx = center_x - std::max(m_min_x[box], std::min(center_x, m_max_x[box]));
+        float dy = center_y - std::max(m_min_y[box], std::min(center_y, m_max_y[box]));
+        return dx * dx + dy * dy < radius * radius;
+    }
+
+    uint64_t CollisionWorld::getCellKey(int32_t x, int32_t y)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,171 @@
+/*!
+ * @file FrameArena.cpp
+ * @brief Class used to allocate transient data of a frame.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a linear memory arena reset once per frame. <br>
+ * Allocating is a pointer bump inside a preallocated block and freeing is done for all allocations at once, so frame preparation does not need the heap.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Core/FrameArena.h"
+
+#include <algorithm>
+
+namespace ShadeEngine
+{
+    FrameArena::FrameArena(std::size_t capacity) : m_block(new char[std::max<std::size_t>(capacity, 1)]), m_capacity(std::max<std::size_t>(capacity, 1)),
+        m_offset(0), m_overflow_size(0), m_peak_usage(0), m_heap_allocation_count(1)
+    {
+        m_overflow_blocks.reserve(16);
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for(std::vector<char*>::iterator block_it = m_overflow_blocks.begin(); block_it != m_overflow_blocks.end(); ++block_it)
+        {
+            delete[] *block_it;
+        }
+        delete[] m_block;
+    }
+
+    void* FrameArena::allocate(std::size_t size, std::size_t alignment)
+    {
+        uintptr_t base = reinterpret_cast<uintptr_t>(m_block);
+        uintptr_t aligned = (base + m_offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        std::size_t end = static_cast<std::size_t>(aligned - base) + size;
+        if(end <= m_capacity)
+        {
+            m_offset = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // Block is full, fall back on the heap until next reset
+        char* overflow_block = new char[size + alignment];
+        m_overflow_blocks.push_back(overflow_block);
+        m_overflow_size += size + alignment;
+        ++m_heap_allocation_count;
+        uintptr_t overflow_base = reinterpret_cast<uintptr_t>(overflow_block);
+        return reinterpret_cast<void*>((overflow_base + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+    }
+
+    void FrameArena::reset()
+    {
+        m_peak_usage = std::max(m_peak_usage, getUsed());
+        if(!m_overflow_blocks.empty())
+        {
+            for(std::vector<char*>::iterator block_it = m_overflow_blocks.begin(); block_it != m_overflow_blocks.end(); ++block_it)
+            {
+                delete[] *block_it;
+            }
+            m_overflow_blocks.clear();
+
+            // Grow block so that a frame like the last one fits in it
+            std::size_t capacity = std::max(m_capacity * 2, m_capacity + m_overflow_size);
+            delete[] m_block;
+            m_block = new char[capacity];
+            m_capacity = capacity;
+            ++m_heap_allocation_count;
+        }
+        m_overflow_size = 0;
+        m_offset = 0;
+    }
+
+    std::size_t FrameArena::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    std::size_t FrameArena::getUsed() const
+    {
+        return m_offset + m_overflow_size;
+    }
+
+    std::size_t FrameArena::getPeakUsage() const
+    {
+        return std::max(m_peak_usage, getUsed());
+    }
+
+    uint64_t FrameArena::getHeapAllocationCount() const
+    {
+        return m_heap_allocation_count;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
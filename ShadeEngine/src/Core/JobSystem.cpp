@@ -0,0 +1,307 @@
+/*!
+ * @file JobSystem.cpp
+ * @brief Class used to run engine tasks on all cores.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a work stealing job system. <br>
+ * Each worker thread owns a deque of jobs: it runs its own jobs newest first and steals the oldest jobs of other workers when it runs out. <br>
+ * Jobs are tracked with counters, which can be waited for and used as dependencies of other jobs.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Core/JobSystem.h"
+#include "include/Core/Tracer.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    thread_local const ShadeEngine::JobSystem* g_worker_system = NULL; // Job system owning the calling thread, if any
+    thread_local unsigned int g_worker_index = 0; // Index of the deque of the calling worker
+}
+
+namespace ShadeEngine
+{
+    JobCounter::JobCounter() : m_count(0)
+    {
+    }
+
+    bool JobCounter::isDone() const
+    {
+        return m_count.load(std::memory_order_acquire) == 0;
+    }
+
+    JobSystem::JobSystem(unsigned int worker_count) : m_queued_count(0), m_next_queue(0), m_stopping(false)
+    {
+        if(worker_count == 0)
+        {
+            unsigned int core_count = std::thread::hardware_concurrency(); // 0 if unknown
+            worker_count = core_count > 1 ? core_count - 1 : 1;
+        }
+
+        for(unsigned int i = 0; i < worker_count; ++i)
+        {
+            m_queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+        }
+        for(unsigned int i = 0; i < worker_count; ++i) // Deques all exist before any worker tries to steal
+        {
+            m_workers.push_back(std::thread(&JobSystem::workerLoop, this, i));
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_sleep_mutex);
+            m_stopping = true;
+        }
+        m_sleep_condition.notify_all();
+        for(std::vector<std::thread>::iterator worker_it = m_workers.begin(); worker_it != m_workers.end(); ++worker_it)
+        {
+            worker_it->join();
+        }
+    }
+
+    unsigned int JobSystem::getWorkerCount() const
+    {
+        return static_cast<unsigned int>(m_workers.size());
+    }
+
+    void JobSystem::submit(Job job, JobCounter *counter, JobCounter *dependency)
+    {
+        if(counter != NULL)
+        {
+            counter->m_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        QueuedJob queued_job;
+        queued_job.job = std::move(job);
+        queued_job.counter = counter;
+        if(dependency != NULL)
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_held_mutex);
+            if(!dependency->isDone()) // Counters only reach 0 while holding the mutex, so the dependency cannot be missed
+            {
+                HeldJob held_job;
+                held_job.dependency = dependency;
+                held_job.queued_job = std::move(queued_job);
+                m_held_jobs.push_back(std::move(held_job));
+                return;
+            }
+        }
+        enqueue(std::move(queued_job));
+    }
+
+    void JobSystem::wait(const JobCounter &counter)
+    {
+        while(!counter.isDone())
+        {
+            if(!runOneJob())
+            {
+                // Remaining jobs run on other threads or are held by dependencies
+                std::unique_lock<std::mutex> mutex_lock(m_sleep_mutex);
+                m_sleep_condition.wait(mutex_lock, [this, &counter]() { return counter.isDone() || m_queued_count.load(std::memory_order_acquire) > 0; });
+            }
+        }
+    }
+
+    bool JobSystem::isWorkerThread() const
+    {
+        return g_worker_system == this;
+    }
+
+    void JobSystem::workerLoop(unsigned int index)
+    {
+        g_worker_system = this;
+        g_worker_index = index;
+        Tracer::setThreadName("JobSystem worker");
+        while(true)
+        {
+            if(runOneJob())
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> mutex_lock(m_sleep_mutex);
+            m_sleep_condition.wait(mutex_lock, [this]() { return m_stopping || m_queued_count.load(std::memory_order_acquire) > 0; });
+            if(m_stopping && m_queued_count.load(std::memory_order_acquire) <= 0) // Queued jobs are run before stopping
+            {
+                return;
+            }
+        }
+    }
+
+    void JobSystem::enqueue(QueuedJob job)
+    {
+        unsigned int index = isWorkerThread() ? g_worker_index : m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queues[index]->mutex);
+            m_queues[index]->jobs.push_back(std::move(job));
+        }
+        m_queued_count.fetch_add(1, std::memory_order_release);
+
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_sleep_mutex); // Sleepers either see the job or get notified
+        }
+        m_sleep_condition.notify_one();
+    }
+
+    bool JobSystem::runOneJob()
+    {
+        QueuedJob job;
+        bool found = false;
+        unsigned int first_victim = m_next_queue.load(std::memory_order_relaxed);
+        if(isWorkerThread())
+        {
+            WorkerQueue& own_queue = *m_queues[g_worker_index];
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(own_queue.mutex);
+            if(!own_queue.jobs.empty())
+            {
+                job = std::move(own_queue.jobs.back()); // Newest job, its data is likely still in cache
+                own_queue.jobs.pop_back();
+                found = true;
+            }
+            first_victim = g_worker_index + 1;
+        }
+
+        for(unsigned int i = 0; i < m_queues.size() && !found; ++i)
+        {
+            WorkerQueue& victim_queue = *m_queues[(first_victim + i) % m_queues.size()];
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(victim_queue.mutex);
+            if(!victim_queue.jobs.empty())
+            {
+                job = std::move(victim_queue.jobs.front()); // Oldest job, likely to spawn more work
+                victim_queue.jobs.pop_front();
+                found = true;
+            }
+        }
+
+        if(!found)
+        {
+            return false;
+        }
+        m_queued_count.fetch_sub(1, std::memory_order_relaxed);
+        job.job();
+        finishJob(job.counter);
+        return true;
+    }
+
+    void JobSystem::finishJob(JobCounter *counter)
+    {
+        if(counter == NULL)
+        {
+            return;
+        }
+
+        std::vector<QueuedJob> released_jobs;
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_held_mutex);
+            if(counter->m_count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+
+            // Counter may be destroyed from now on, it is only compared with dependencies
+            std::vector<HeldJob>::iterator held_it = m_held_jobs.begin();
+            while(held_it != m_held_jobs.end())
+            {
+                if(held_it->dependency == counter)
+                {
+                    released_jobs.push_back(std::move(held_it->queued_job));
+                    held_it = m_held_jobs.erase(held_it);
+                }
+                else
+                {
+                    ++held_it;
+                }
+            }
+        }
+
+        for(std::vector<QueuedJob>::iterator job_it = released_jobs.begin(); job_it != released_jobs.end(); ++job_it)
+        {
+            enqueue(std::move(*job_it));
+        }
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_sleep_mutex); // Waiters either see the counter done or get notified
+        }
+        m_sleep_condition.notify_all();
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
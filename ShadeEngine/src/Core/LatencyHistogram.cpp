@@ -0,0 +1,186 @@
+/*!
+ * @file LatencyHistogram.cpp
+ * @brief Class used to accumulate a distribution of durations.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a fixed size log-linear histogram of durations. <br>
+ * Durations below 16 microseconds have their own bucket, then each power of two is split into 8 buckets, giving a relative precision of 12.5% up to more than an hour.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Core/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ShadeEngine
+{
+    const unsigned int LatencyHistogram::BUCKET_COUNT;
+
+    LatencyHistogram::LatencyHistogram()
+    {
+        reset();
+    }
+
+    void LatencyHistogram::record(uint64_t duration_ns)
+    {
+        uint64_t duration_us = duration_ns / 1000;
+        ++m_buckets[getBucket(duration_us)];
+        ++m_count;
+        m_max_us = std::max(m_max_us, duration_us);
+    }
+
+    void LatencyHistogram::reset()
+    {
+        std::memset(m_buckets, 0, sizeof(m_buckets));
+        m_count = 0;
+        m_max_us = 0;
+    }
+
+    uint64_t LatencyHistogram::getCount() const
+    {
+        return m_count;
+    }
+
+    uint64_t LatencyHistogram::getPercentile(double percentile) const
+    {
+        if(m_count == 0)
+        {
+            return 0;
+        }
+
+        uint64_t rank = static_cast<uint64_t>(std::ceil(percentile * m_count / 100.0)); // Nearest rank, multiplied first to stay exact
+        rank = std::max<uint64_t>(1, std::min(rank, m_count)); // Rank of the duration searched, starting at 1
+        uint64_t cumulated = 0;
+        for(unsigned int bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+        {
+            cumulated += m_buckets[bucket];
+            if(cumulated >= rank)
+            {
+                return std::min(m_max_us, getBucketLowerBound(bucket + 1) - 1);
+            }
+        }
+        return m_max_us;
+    }
+
+    uint64_t LatencyHistogram::getMax() const
+    {
+        return m_max_us;
+    }
+
+    void LatencyHistogram::dump(std::ostream &stream) const
+    {
+        stream << "count: " << m_count << " p50: " << getPercentile(50) << "us p90: " << getPercentile(90) << "us p99: " << getPercentile(99)
+               << "us max: " << m_max_us << "us" << std::endl;
+        for(unsigned int bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+        {
+            if(m_buckets[bucket] != 0)
+            {
+                stream << "[" << getBucketLowerBound(bucket) << "us, " << getBucketLowerBound(bucket + 1) << "us[ : " << m_buckets[bucket] << std::endl;
+            }
+        }
+    }
+
+    unsigned int LatencyHistogram::getBucket(uint64_t duration_us)
+    {
+        if(duration_us < 16) // One bucket per microsecond
+        {
+            return static_cast<unsigned int>(duration_us);
+        }
+
+        unsigned int exponent = 63 - __builtin_clzll(duration_us); // Position of highest bit set, at least 4
+        unsigned int sub_bucket = static_cast<unsigned int>(duration_us >> (exponent - 3)) & 0x7; // 3 bits following highest bit
+        return std::min(BUCKET_COUNT - 1, 16 + (exponent - 4) * 8 + sub_bucket);
+    }
+
+    uint64_t LatencyHistogram::getBucketLowerBound(unsigned int bucket)
+    {
+        if(bucket < 16)
+        {
+            return bucket;
+        }
+
+        unsigned int exponent = 4 + (bucket - 16) / 8;
+        uint64_t sub_bucket = (bucket - 16) % 8;
+        return (static_cast<uint64_t>(8 + sub_bucket)) << (exponent - 3);
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
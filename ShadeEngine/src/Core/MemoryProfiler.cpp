@@ -0,0 +1,386 @@
+/*!
+ * @file MemoryProfiler.cpp
+ * @brief Class used to measure heap usage of the engine subsystems.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of an opt-in heap instrumentation layer. <br>
+ * When SHADE_ENGINE_MEMORY_PROFILING is defined, global operator new and delete are replaced to count allocations, bytes and live memory. <br>
+ * Allocations are attributed to the memory tag of the scope they are made in, so that render, scene update and resource loading can be told apart.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Core/MemoryProfiler.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    const uint32_t UNTRACKED_TAG = 0xFFFFFFFF; // Tag of allocations made while profiling is paused
+    const std::size_t TOTAL_INDEX = ShadeEngine::MEMORY_TAG_COUNT; // Index of counters of all tags
+
+    /*!
+    * @brief Counters of a memory tag
+    *
+    * Atomics with static storage are zero initialized before any allocation can happen.
+    */
+    struct TagCounters
+    {
+        std::atomic<uint64_t> allocation_count; /*!< Number of allocations since start. */
+        std::atomic<uint64_t> deallocation_count; /*!< Number of deallocations since start. */
+        std::atomic<uint64_t> allocated_bytes; /*!< Number of bytes allocated since start. */
+        std::atomic<int64_t> live_bytes; /*!< Number of bytes currently allocated. */
+        std::atomic<int64_t> peak_live_bytes; /*!< Highest live bytes since start. */
+        std::atomic<uint64_t> frame_allocation_count; /*!< Number of allocations since beginning of frame. */
+        std::atomic<uint64_t> frame_deallocation_count; /*!< Number of deallocations since beginning of frame. */
+        std::atomic<uint64_t> frame_allocated_bytes; /*!< Number of bytes allocated since beginning of frame. */
+        std::atomic<int64_t> frame_peak_live_bytes; /*!< Highest live bytes since beginning of frame. */
+    };
+
+    TagCounters g_counters[ShadeEngine::MEMORY_TAG_COUNT + 1]; // One per tag plus totals
+    std::atomic<bool> g_enabled(true);
+    thread_local ShadeEngine::MemoryTag g_current_tag = ShadeEngine::MEMORY_TAG_UNTAGGED;
+
+    /*!
+    * @brief Copy counters into statistics
+    */
+    ShadeEngine::MemoryStatistics getStatistics(const TagCounters& counters, bool frame)
+    {
+        ShadeEngine::MemoryStatistics statistics;
+        statistics.allocation_count = (frame ? counters.frame_allocation_count : counters.allocation_count).load(std::memory_order_relaxed);
+        statistics.deallocation_count = (frame ? counters.frame_deallocation_count : counters.deallocation_count).load(std::memory_order_relaxed);
+        statistics.allocated_bytes = (frame ? counters.frame_allocated_bytes : counters.allocated_bytes).load(std::memory_order_relaxed);
+        statistics.live_bytes = counters.live_bytes.load(std::memory_order_relaxed);
+        statistics.peak_live_bytes = (frame ? counters.frame_peak_live_bytes : counters.peak_live_bytes).load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+#ifdef SHADE_ENGINE_MEMORY_PROFILING
+    /*!
+    * @brief Raise a maximum atomically
+    */
+    void raiseMaximum(std::atomic<int64_t>& maximum, int64_t value)
+    {
+        int64_t current = maximum.load(std::memory_order_relaxed);
+        while(value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /*!
+    * @brief Account an allocation in counters
+    */
+    void countAllocation(TagCounters& counters, uint64_t size)
+    {
+        counters.allocation_count.fetch_add(1, std::memory_order_relaxed);
+        counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+        counters.frame_allocation_count.fetch_add(1, std::memory_order_relaxed);
+        counters.frame_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+        int64_t live_bytes = counters.live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+        raiseMaximum(counters.peak_live_bytes, live_bytes);
+        raiseMaximum(counters.frame_peak_live_bytes, live_bytes);
+    }
+
+    /*!
+    * @brief Account a deallocation in counters
+    */
+    void countDeallocation(TagCounters& counters, uint64_t size)
+    {
+        counters.deallocation_count.fetch_add(1, std::memory_order_relaxed);
+        counters.frame_deallocation_count.fetch_add(1, std::memory_order_relaxed);
+        counters.live_bytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+    }
+
+    /*!
+    * @brief Header stored in front of every profiled allocation
+    *
+    * Its size keeps returned pointers aligned for any fundamental type.
+    */
+    struct AllocationHeader
+    {
+        uint64_t size; /*!< Size requested by the caller. */
+        uint32_t tag; /*!< Tag the allocation is attributed to. */
+        uint32_t padding; /*!< Unused. */
+    };
+
+    /*!
+    * @brief Allocate memory and account it to current tag
+    */
+    void* profiledAllocate(std::size_t size)
+    {
+        char* block = static_cast<char*>(std::malloc(sizeof(AllocationHeader) + size));
+        if(block == NULL)
+        {
+            return NULL;
+        }
+
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(block);
+        header->size = size;
+        header->tag = g_enabled.load(std::memory_order_relaxed) ? static_cast<uint32_t>(g_current_tag) : UNTRACKED_TAG;
+        if(header->tag != UNTRACKED_TAG)
+        {
+            countAllocation(g_counters[header->tag], size);
+            countAllocation(g_counters[TOTAL_INDEX], size);
+        }
+        return block + sizeof(AllocationHeader);
+    }
+
+    /*!
+    * @brief Allocate memory calling new handler until it succeeds
+    */
+    void* profiledAllocateOrThrow(std::size_t size)
+    {
+        void* pointer = NULL;
+        while((pointer = profiledAllocate(size)) == NULL)
+        {
+            std::new_handler handler = std::get_new_handler();
+            if(handler == NULL)
+            {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+        return pointer;
+    }
+
+    /*!
+    * @brief Free memory and account it to the tag it was allocated with
+    */
+    void profiledFree(void* pointer)
+    {
+        if(pointer == NULL)
+        {
+            return;
+        }
+
+        char* block = static_cast<char*>(pointer) - sizeof(AllocationHeader);
+        const AllocationHeader* header = reinterpret_cast<const AllocationHeader*>(block);
+        if(header->tag != UNTRACKED_TAG)
+        {
+            countDeallocation(g_counters[header->tag], header->size);
+            countDeallocation(g_counters[TOTAL_INDEX], header->size);
+        }
+        std::free(block);
+    }
+#endif
+}
+
+#ifdef SHADE_ENGINE_MEMORY_PROFILING
+void* operator new(std::size_t size)
+{
+    return profiledAllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return profiledAllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return profiledAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return profiledAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    profiledFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    profiledFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept // Sized variants are used from C++14 on
+{
+    profiledFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    profiledFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    profiledFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    profiledFree(pointer);
+}
+#endif
+
+namespace ShadeEngine
+{
+    bool MemoryProfiler::isAvailable()
+    {
+#ifdef SHADE_ENGINE_MEMORY_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void MemoryProfiler::setEnabled(bool enabled)
+    {
+        g_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void MemoryProfiler::beginFrame()
+    {
+        for(std::size_t i = 0; i <= TOTAL_INDEX; ++i)
+        {
+            g_counters[i].frame_allocation_count.store(0, std::memory_order_relaxed);
+            g_counters[i].frame_deallocation_count.store(0, std::memory_order_relaxed);
+            g_counters[i].frame_allocated_bytes.store(0, std::memory_order_relaxed);
+            g_counters[i].frame_peak_live_bytes.store(g_counters[i].live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    MemoryStatistics MemoryProfiler::getTotalStatistics(MemoryTag tag)
+    {
+        return getStatistics(g_counters[tag < MEMORY_TAG_COUNT ? static_cast<std::size_t>(tag) : TOTAL_INDEX], false);
+    }
+
+    MemoryStatistics MemoryProfiler::getFrameStatistics(MemoryTag tag)
+    {
+        return getStatistics(g_counters[tag < MEMORY_TAG_COUNT ? static_cast<std::size_t>(tag) : TOTAL_INDEX], true);
+    }
+
+    MemoryStatistics MemoryProfiler::getTotalStatistics()
+    {
+        return getStatistics(g_counters[TOTAL_INDEX], false);
+    }
+
+    MemoryStatistics MemoryProfiler::getFrameStatistics()
+    {
+        return getStatistics(g_counters[TOTAL_INDEX], true);
+    }
+
+    const char* MemoryProfiler::getTagName(MemoryTag tag)
+    {
+        switch(tag)
+        {
+        case MEMORY_TAG_UNTAGGED:
+            return "untagged";
+        case MEMORY_TAG_RENDER:
+            return "render";
+        case MEMORY_TAG_SCENE_UPDATE:
+            return "scene update";
+        case MEMORY_TAG_RESOURCES:
+            return "resources";
+        default:
+            return "total";
+        }
+    }
+
+    void MemoryProfiler::dump(std::ostream &stream)
+    {
+        for(std::size_t i = 0; i <= TOTAL_INDEX; ++i)
+        {
+            MemoryStatistics total = getStatistics(g_counters[i], false);
+            MemoryStatistics frame = getStatistics(g_counters[i], true);
+            stream << getTagName(static_cast<MemoryTag>(i)) << ": allocs: " << total.allocation_count << " frees: " << total.deallocation_count
+                   << " bytes: " << total.allocated_bytes << " live: " << total.live_bytes << " peak: " << total.peak_live_bytes
+                   << " | frame allocs: " << frame.allocation_count << " frame bytes: " << frame.allocated_bytes << " frame peak: " << frame.peak_live_bytes << std::endl;
+        }
+    }
+
+    MemoryTag MemoryProfiler::getCurrentTag()
+    {
+        return g_current_tag;
+    }
+
+    MemoryTag MemoryProfiler::setCurrentTag(MemoryTag tag)
+    {
+        MemoryTag previous_tag = g_current_tag;
+        g_current_tag = tag;
+        return previous_tag;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
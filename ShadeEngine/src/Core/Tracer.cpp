@@ -0,0 +1,323 @@
+/*!
+ * @file Tracer.cpp
+ * @brief Class used to record a timeline of engine scopes.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of an opt-in timeline instrumentation layer. <br>
+ * When SHADE_ENGINE_TRACING is defined, SHADE_ENGINE_TRACE_SCOPE records the start and duration of the enclosing scope in a ring buffer owned by the calling thread. <br>
+ * The latest events of all threads can be exported as Chrome trace JSON, to be opened in chrome://tracing or Perfetto to inspect single slow frames.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Core/Tracer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    /*!
+    * @brief Recorded scope
+    */
+    struct TraceEvent
+    {
+        const char* name; /*!< Name of the scope. */
+        uint64_t start_ns; /*!< Start of the scope. */
+        uint64_t duration_ns; /*!< Duration of the scope. */
+    };
+
+    /*!
+    * @brief Ring buffer of the events of a thread
+    *
+    * Only written by its thread. Kept after the thread ends so that its events can still be exported, until another thread reuses it.
+    */
+    struct ThreadBuffer
+    {
+        TraceEvent events[ShadeEngine::Tracer::EVENTS_PER_THREAD]; /*!< Latest events, indexed by event number modulo capacity. */
+        std::atomic<uint64_t> write_count; /*!< Number of events recorded since creation. */
+        std::atomic<uint64_t> first_kept; /*!< Number of the first event not cleared. */
+        std::atomic<const char*> name; /*!< Name of the thread or NULL. */
+        uint32_t index; /*!< Index of the thread, used as trace thread identifier. */
+    };
+
+    std::mutex g_buffers_mutex;
+    std::vector< std::unique_ptr<ThreadBuffer> > g_buffers; // Never shrinks so that thread local pointers stay valid
+    std::vector<ThreadBuffer*> g_free_buffers; // Buffers of finished threads, so that memory is bounded by the number of threads alive at once
+    std::atomic<bool> g_enabled(true);
+    const std::chrono::steady_clock::time_point g_origin = std::chrono::steady_clock::now();
+
+#ifdef SHADE_ENGINE_TRACING
+    /*!
+    * @brief Buffer of a thread, handed back to the free buffers when the thread ends
+    */
+    struct ThreadBufferOwner
+    {
+        ThreadBuffer* buffer; /*!< Buffer of the thread or NULL. */
+
+        ~ThreadBufferOwner()
+        {
+            if(buffer != NULL)
+            {
+                std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(g_buffers_mutex);
+                g_free_buffers.push_back(buffer);
+            }
+        }
+    };
+
+    thread_local ThreadBufferOwner g_thread_buffer = {NULL};
+
+    /*!
+    * @brief Get buffer of calling thread, creating it if needed
+    */
+    ThreadBuffer& getThreadBuffer()
+    {
+        if(g_thread_buffer.buffer == NULL)
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(g_buffers_mutex);
+            if(!g_free_buffers.empty())
+            {
+                // Events of the finished thread are dropped. Counters keep growing so that exporters never see them go back
+                ThreadBuffer* buffer = g_free_buffers.back();
+                g_free_buffers.pop_back();
+                buffer->first_kept.store(buffer->write_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                buffer->name.store(NULL, std::memory_order_relaxed);
+                g_thread_buffer.buffer = buffer;
+            }
+            else
+            {
+                std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+                buffer->write_count.store(0, std::memory_order_relaxed);
+                buffer->first_kept.store(0, std::memory_order_relaxed);
+                buffer->name.store(NULL, std::memory_order_relaxed);
+                buffer->index = static_cast<uint32_t>(g_buffers.size());
+                g_thread_buffer.buffer = buffer.get();
+                g_buffers.push_back(std::move(buffer));
+            }
+        }
+        return *g_thread_buffer.buffer;
+    }
+#endif
+
+    /*!
+    * @brief Write a string as a JSON string literal
+    */
+    void writeJsonString(std::ostream& stream, const char* text)
+    {
+        stream << '"';
+        for(const char* character = text; *character != '\0'; ++character)
+        {
+            if(*character == '"' || *character == '\\')
+            {
+                stream << '\\' << *character;
+            }
+            else if(static_cast<unsigned char>(*character) >= 0x20)
+            {
+                stream << *character;
+            }
+        }
+        stream << '"';
+    }
+
+    /*!
+    * @brief Write nanoseconds as fractional microseconds, the unit of Chrome traces
+    */
+    void writeMicroseconds(std::ostream& stream, uint64_t ns)
+    {
+        uint64_t fraction = ns % 1000;
+        stream << ns / 1000 << '.' << (fraction < 100 ? "0" : "") << (fraction < 10 ? "0" : "") << fraction;
+    }
+}
+
+namespace ShadeEngine
+{
+    const uint32_t Tracer::EVENTS_PER_THREAD;
+
+    bool Tracer::isAvailable()
+    {
+#ifdef SHADE_ENGINE_TRACING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void Tracer::setEnabled(bool enabled)
+    {
+        g_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void Tracer::setThreadName(const char *name)
+    {
+#ifdef SHADE_ENGINE_TRACING
+        getThreadBuffer().name.store(name, std::memory_order_relaxed);
+#else
+        (void)name;
+#endif
+    }
+
+    uint64_t Tracer::getTimestamp()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_origin).count();
+    }
+
+    void Tracer::record(const char *name, uint64_t start_ns, uint64_t end_ns)
+    {
+#ifdef SHADE_ENGINE_TRACING
+        if(!g_enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        ThreadBuffer& buffer = getThreadBuffer();
+        uint64_t event_number = buffer.write_count.load(std::memory_order_relaxed);
+        TraceEvent& event = buffer.events[event_number & (EVENTS_PER_THREAD - 1)];
+        event.name = name;
+        event.start_ns = start_ns;
+        event.duration_ns = end_ns - start_ns;
+        buffer.write_count.store(event_number + 1, std::memory_order_release); // Publishes event to exporters
+#else
+        (void)name;
+        (void)start_ns;
+        (void)end_ns;
+#endif
+    }
+
+    void Tracer::clear()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(g_buffers_mutex);
+        for(std::vector< std::unique_ptr<ThreadBuffer> >::iterator it = g_buffers.begin(); it != g_buffers.end(); ++it)
+        {
+            (*it)->first_kept.store((*it)->write_count.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+    }
+
+    void Tracer::exportChromeTrace(std::ostream &stream)
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(g_buffers_mutex);
+        std::vector<TraceEvent> events;
+        bool first = true;
+
+        stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        for(std::vector< std::unique_ptr<ThreadBuffer> >::const_iterator it = g_buffers.begin(); it != g_buffers.end(); ++it)
+        {
+            const ThreadBuffer& buffer = **it;
+
+            // Copy events, then drop those the thread may have overwritten during the copy, including the one it may be writing
+            uint64_t end = buffer.write_count.load(std::memory_order_acquire);
+            uint64_t begin = std::max(buffer.first_kept.load(std::memory_order_relaxed), end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0);
+            events.clear();
+            for(uint64_t event_number = begin; event_number < end; ++event_number)
+            {
+                events.push_back(buffer.events[event_number & (EVENTS_PER_THREAD - 1)]);
+            }
+            uint64_t overwritten = buffer.write_count.load(std::memory_order_acquire);
+            std::size_t skipped = overwritten + 1 > begin + EVENTS_PER_THREAD ? static_cast<std::size_t>(std::min(overwritten + 1 - begin - EVENTS_PER_THREAD, end - begin)) : 0;
+
+            const char* thread_name = buffer.name.load(std::memory_order_relaxed);
+            stream << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buffer.index << ",\"args\":{\"name\":";
+            if(thread_name != NULL)
+            {
+                writeJsonString(stream, thread_name);
+            }
+            else
+            {
+                stream << "\"Thread " << buffer.index << '"';
+            }
+            stream << "}}";
+            first = false;
+
+            for(std::vector<TraceEvent>::const_iterator event = events.begin() + skipped; event != events.end(); ++event)
+            {
+                stream << ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer.index << ",\"name\":";
+                writeJsonString(stream, event->name);
+                stream << ",\"ts\":";
+                writeMicroseconds(stream, event->start_ns);
+                stream << ",\"dur\":";
+                writeMicroseconds(stream, event->duration_ns);
+                stream << '}';
+            }
+        }
+        stream << "\n]}\n";
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -66,11 +66,42 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 */
 
 #include "include/Graphics/AbstractShadeWidget.h"
+#include "include/Core/MemoryProfiler.h"
+#include "include/Core/Tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <QFocusEvent>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QWheelEvent>
+
+namespace
+{
+    const std::size_t RELEASE_RESERVED_SLOTS = 32; // Queue slots only usable by releases and focus loss, so held keys are never stuck down
+
+    /*!
+    * @brief Get current steady clock time in nanoseconds
+    */
+    uint64_t getSteadyTimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /*!
+    * @brief Clamp a widget coordinate to the range of input records
+    */
+    int16_t toInputCoordinate(int coordinate)
+    {
+        return static_cast<int16_t>(std::max(-32768, std::min(32767, coordinate)));
+    }
+}
 
 namespace ShadeEngine
 {
     AbstractShadeWidget::AbstractShadeWidget(const QPoint &position, const QSize &size, unsigned int refresh_rate_ms, QWidget *parent) : QWidget(parent), sf::RenderWindow(),
-        m_initialized(false), m_background_color(sf::Color::Black)
+        m_initialized(false), m_background_color(sf::Color::Black), m_latency_measurement_enabled(false)
     {
         // Setup some states to allow direct rendering into the widget
         setAttribute(Qt::WA_PaintOnScreen);
@@ -80,6 +111,10 @@ namespace ShadeEngine
         // Set strong focus to enable keyboard events to be received
         setFocusPolicy(Qt::StrongFocus);
 
+        // Receive mouse moves even when no button is pressed
+        setMouseTracking(true);
+        m_frame_input_events.reserve(256); // Queue capacity, so draining never allocates
+
         // Setup the widget geometry
         move(position);
         resize(size);
@@ -99,6 +134,31 @@ namespace ShadeEngine
         return m_background_color;
     }
 
+    void AbstractShadeWidget::setLatencyMeasurementEnabled(bool enabled)
+    {
+        m_latency_measurement_enabled = enabled;
+    }
+
+    const LatencyHistogram& AbstractShadeWidget::getLatencyHistogram() const
+    {
+        return m_latency_histogram;
+    }
+
+    void AbstractShadeWidget::dumpLatencyHistogram(std::ostream &stream) const
+    {
+        m_latency_histogram.dump(stream);
+    }
+
+    uint64_t AbstractShadeWidget::getFrameArenaHeapAllocationCount() const
+    {
+        return m_frame_arena.getHeapAllocationCount();
+    }
+
+    std::size_t AbstractShadeWidget::getFrameArenaPeakUsage() const
+    {
+        return m_frame_arena.getPeakUsage();
+    }
+
     QPaintEngine* AbstractShadeWidget::paintEngine() const
     {
         return nullptr; // To stay consistent with WA_PaintOnScreen option, we set the built-in paintEngine to null pointer
@@ -124,11 +184,41 @@ namespace ShadeEngine
 
     void AbstractShadeWidget::paintEvent(QPaintEvent*)
     {
+        MemoryProfiler::beginFrame();
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_RENDER);
+        SHADE_ENGINE_TRACE_SCOPE("AbstractShadeWidget::paintEvent");
+
+        // Gather inputs received since previous frame
+        pollInput();
+
         // Let the derived class do its specific stuff
-        onUpdate();
+        {
+            SHADE_ENGINE_TRACE_SCOPE("AbstractShadeWidget::onUpdate");
+            onUpdate();
+        }
 
         // Display on screen
-        display();
+        {
+            SHADE_ENGINE_TRACE_SCOPE("AbstractShadeWidget::display"); // Includes waiting for vertical sync when enabled
+            display();
+        }
+
+        // Measure delay between input reception and display of the frame reacting to it
+        if(m_latency_measurement_enabled && !m_frame_input_events.empty())
+        {
+            uint64_t displayed_ns = getSteadyTimeNs();
+            for(std::vector<InputEvent>::const_iterator input_it = m_frame_input_events.begin(); input_it != m_frame_input_events.end(); ++input_it)
+            {
+                bool discrete = (input_it->type == KEY_PRESSED && !input_it->auto_repeat) || input_it->type == MOUSE_PRESSED; // Move and wheel floods would hide press latency
+                if(discrete)
+                {
+                    m_latency_histogram.record(displayed_ns - input_it->timestamp_ns);
+                }
+            }
+        }
+
+        // Release transient data of the frame
+        m_frame_arena.reset();
     }
 
     void AbstractShadeWidget::resizeEvent(QResizeEvent*)
@@ -140,6 +230,121 @@ namespace ShadeEngine
     {
         clear(m_background_color);
     }
+
+    void AbstractShadeWidget::keyPressEvent(QKeyEvent *event)
+    {
+        InputEvent input;
+        std::memset(&input, 0, sizeof(input));
+        input.type = KEY_PRESSED;
+        input.key = InputState::getKeyIndex(event->key());
+        input.auto_repeat = event->isAutoRepeat() ? 1 : 0;
+        queueInputEvent(input);
+    }
+
+    void AbstractShadeWidget::keyReleaseEvent(QKeyEvent *event)
+    {
+        if(event->isAutoRepeat()) // Auto-repeat generates release/press pairs while key stays down
+        {
+            return;
+        }
+        InputEvent input;
+        std::memset(&input, 0, sizeof(input));
+        input.type = KEY_RELEASED;
+        input.key = InputState::getKeyIndex(event->key());
+        queueInputEvent(input);
+    }
+
+    void AbstractShadeWidget::mousePressEvent(QMouseEvent *event)
+    {
+        InputEvent input;
+        std::memset(&input, 0, sizeof(input));
+        input.type = MOUSE_PRESSED;
+        input.button = static_cast<uint8_t>(event->button() & (MOUSE_LEFT | MOUSE_RIGHT | MOUSE_MIDDLE)); // Qt button flags match MouseButton values
+        input.x = toInputCoordinate(event->pos().x());
+        input.y = toInputCoordinate(event->pos().y());
+        queueInputEvent(input);
+    }
+
+    void AbstractShadeWidget::mouseReleaseEvent(QMouseEvent *event)
+    {
+        InputEvent input;
+        std::memset(&input, 0, sizeof(input));
+        input.type = MOUSE_RELEASED;
+        input.button = static_cast<uint8_t>(event->button() & (MOUSE_LEFT | MOUSE_RIGHT | MOUSE_MIDDLE)); // Qt button flags match MouseButton values
+        input.x = toInputCoordinate(event->pos().x());
+        input.y = toInputCoordinate(event->pos().y());
+        queueInputEvent(input);
+    }
+
+    void AbstractShadeWidget::mouseMoveEvent(QMouseEvent *event)
+    {
+        InputEvent input;
+        std::memset(&input, 0, sizeof(input));
+        input.type = MOUSE_MOVED;
+        input.x = toInputCoordinate(event->pos().x());
+        input.y = toInputCoordinate(event->pos().y());
+        queueInputEvent(input);
+    }
+
+    void AbstractShadeWidget::wheelEvent(QWheelEvent *event)
+    {
+        InputEvent input;
+        std::memset(&input, 0, sizeof(input));
+        input.type = MOUSE_WHEEL;
+        input.wheel_delta = toInputCoordinate(event->angleDelta().y());
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+        QPoint position = event->position().toPoint(); // QWheelEvent::pos is deprecated
+#else
+        QPoint position = event->pos();
+#endif
+        input.x = toInputCoordinate(position.x());
+        input.y = toInputCoordinate(position.y());
+        queueInputEvent(input);
+    }
+
+    void AbstractShadeWidget::focusOutEvent(QFocusEvent *event)
+    {
+        QWidget::focusOutEvent(event);
+        InputEvent input;
+        std::memset(&input, 0, sizeof(input));
+        input.type = FOCUS_LOST;
+        queueInputEvent(input);
+    }
+
+    const InputState& AbstractShadeWidget::getInputState() const
+    {
+        return m_input_state;
+    }
+
+    const std::vector<InputEvent>& AbstractShadeWidget::getFrameInputEvents() const
+    {
+        return m_frame_input_events;
+    }
+
+    FrameArena& AbstractShadeWidget::getFrameArena()
+    {
+        return m_frame_arena;
+    }
+
+    void AbstractShadeWidget::pollInput()
+    {
+        m_frame_input_events.clear();
+        m_input_state.beginFrame();
+
+        InputEvent input;
+        while(m_input_queue.pop(input))
+        {
+            m_input_state.apply(input);
+            m_frame_input_events.push_back(input);
+        }
+    }
+
+    void AbstractShadeWidget::queueInputEvent(InputEvent event)
+    {
+        event.timestamp_ns = getSteadyTimeNs();
+        bool is_release = event.type == KEY_RELEASED || event.type == MOUSE_RELEASED || event.type == FOCUS_LOST;
+        m_input_queue.push(event, is_release ? 0 : RELEASE_RESERVED_SLOTS); // Never blocks, event is dropped if frame loop is too late
+    }
 }
 
 //  ______________________________
@@ -0,0 +1,134 @@
+/*!
+ * @file AlphaMask.cpp
+ * @brief Class used to know which pixels of a texture are transparent.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a bitset storing one bit per texture pixel. <br>
+ * Masks are computed once per texture and allow pixel accurate hit testing without reading texture memory back.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Graphics/AlphaMask.h"
+
+#include <cmath>
+
+namespace ShadeEngine
+{
+    AlphaMask::AlphaMask(const sf::Image &image, uint8_t alpha_threshold) : m_size(image.getSize()), m_words_per_row((m_size.x + 63) / 64),
+        m_bits(m_words_per_row * m_size.y, 0)
+    {
+        const uint8_t* pixels = image.getPixelsPtr(); // RGBA, row after row
+        for(unsigned int y = 0; y < m_size.y; ++y)
+        {
+            for(unsigned int x = 0; x < m_size.x; ++x)
+            {
+                if(pixels[4 * (static_cast<std::size_t>(y) * m_size.x + x) + 3] >= alpha_threshold)
+                {
+                    m_bits[y * m_words_per_row + x / 64] |= static_cast<uint64_t>(1) << (x % 64);
+                }
+            }
+        }
+    }
+
+    sf::Vector2u AlphaMask::getSize() const
+    {
+        return m_size;
+    }
+
+    bool AlphaMask::isOpaque(unsigned int x, unsigned int y) const
+    {
+        if(x >= m_size.x || y >= m_size.y)
+        {
+            return false;
+        }
+        return (m_bits[y * m_words_per_row + x / 64] >> (x % 64)) & 1;
+    }
+
+    bool AlphaMask::isOpaque(const sf::Sprite &sprite, const sf::Vector2f &local_point) const
+    {
+        // Same mapping as sprite texture coordinates : negative rect sizes walk the texture backwards
+        const sf::IntRect& rect = sprite.getTextureRect();
+        int offset_x = static_cast<int>(std::floor(local_point.x));
+        int offset_y = static_cast<int>(std::floor(local_point.y));
+        int x = rect.width >= 0 ? rect.left + offset_x : rect.left - 1 - offset_x;
+        int y = rect.height >= 0 ? rect.top + offset_y : rect.top - 1 - offset_y;
+        return x >= 0 && y >= 0 && isOpaque(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
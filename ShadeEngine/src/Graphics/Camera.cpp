@@ -0,0 +1,222 @@
+/*!
+ * @file Camera.cpp
+ * @brief Class used to scroll and zoom over the rendered world.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a 2D camera computing SFML views. <br>
+ * Camera can be panned, zoomed and can smoothly follow a target. Each layer can scroll at its own speed to create parallax effects.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Graphics/Camera.h"
+
+#include <cmath>
+
+namespace ShadeEngine
+{
+    Camera::Camera() : m_center(0.f, 0.f), m_center_set(false), m_zoom(1.f), m_following(false), m_target(0.f, 0.f), m_smoothing(0.f),
+        m_pixel_snapping(true)
+    {
+    }
+
+    void Camera::setCenter(const sf::Vector2f &center)
+    {
+        m_center = center;
+        m_center_set = true;
+        m_following = false;
+    }
+
+    sf::Vector2f Camera::getCenter() const
+    {
+        return m_center;
+    }
+
+    bool Camera::isPositioned() const
+    {
+        return m_center_set;
+    }
+
+    void Camera::move(const sf::Vector2f &offset)
+    {
+        setCenter(m_center + offset);
+    }
+
+    void Camera::setZoom(float zoom)
+    {
+        if(zoom > 0.f)
+        {
+            m_zoom = zoom;
+        }
+    }
+
+    float Camera::getZoom() const
+    {
+        return m_zoom;
+    }
+
+    void Camera::follow(const sf::Vector2f &target, float smoothing)
+    {
+        if(!m_center_set || smoothing <= 0.f) // Nothing to catch up from
+        {
+            m_center = target;
+            m_center_set = true;
+        }
+        m_following = true;
+        m_target = target;
+        m_smoothing = smoothing;
+    }
+
+    void Camera::stopFollowing()
+    {
+        m_following = false;
+    }
+
+    void Camera::setLayerParallax(std::size_t layer, float factor)
+    {
+        if(layer >= m_layer_parallax.size())
+        {
+            m_layer_parallax.resize(layer + 1, 1.f);
+        }
+        m_layer_parallax[layer] = factor;
+    }
+
+    float Camera::getLayerParallax(std::size_t layer) const
+    {
+        return layer < m_layer_parallax.size() ? m_layer_parallax[layer] : 1.f;
+    }
+
+    void Camera::setPixelSnapping(bool enabled)
+    {
+        m_pixel_snapping = enabled;
+    }
+
+    bool Camera::isPixelSnapping() const
+    {
+        return m_pixel_snapping;
+    }
+
+    void Camera::update(float elapsed_seconds)
+    {
+        if(!m_following)
+        {
+            return;
+        }
+
+        if(m_smoothing <= 0.f)
+        {
+            m_center = m_target;
+        }
+        else
+        {
+            float blend = 1.f - std::exp(-m_smoothing * elapsed_seconds); // Exponential decay gives the same trajectory whatever the frame rate
+            m_center += (m_target - m_center) * blend;
+        }
+    }
+
+    sf::View Camera::getLayerView(std::size_t layer, const sf::Vector2u &target_size) const
+    {
+        sf::Vector2f size(target_size.x / m_zoom, target_size.y / m_zoom);
+        return sf::View(getLayerCenter(layer, target_size), size);
+    }
+
+    sf::FloatRect Camera::getLayerVisibleArea(std::size_t layer, const sf::Vector2u &target_size) const
+    {
+        sf::Vector2f size(target_size.x / m_zoom, target_size.y / m_zoom);
+        sf::Vector2f center = getLayerCenter(layer, target_size);
+        return sf::FloatRect(center.x - size.x / 2.f, center.y - size.y / 2.f, size.x, size.y);
+    }
+
+    sf::Vector2f Camera::getLayerCenter(std::size_t layer, const sf::Vector2u &target_size) const
+    {
+        sf::Vector2f screen_center(target_size.x / 2.f, target_size.y / 2.f);
+        sf::Vector2f camera_center = m_center_set ? m_center : screen_center;
+        sf::Vector2f center = screen_center + (camera_center - screen_center) * getLayerParallax(layer); // Parallax 0 keeps the default view
+
+        if(m_pixel_snapping)
+        {
+            // Snap the top left corner of the view on the screen pixel grid so that texels map to whole pixels
+            sf::Vector2f half_size(target_size.x / (2.f * m_zoom), target_size.y / (2.f * m_zoom));
+            center.x = std::floor((center.x - half_size.x) * m_zoom + 0.5f) / m_zoom + half_size.x;
+            center.y = std::floor((center.y - half_size.y) * m_zoom + 0.5f) / m_zoom + half_size.y;
+        }
+        return center;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
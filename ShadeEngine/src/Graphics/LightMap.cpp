@@ -0,0 +1,370 @@
+/*!
+ * @file LightMap.cpp
+ * @brief Class used to light a scene with point lights.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a light map accumulating lights into a reduced resolution render texture multiplied over the scene. <br>
+ * Static lights are baked once in world space. The light map is only re-rendered when a light, the ambient color or the view changes.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Graphics/LightMap.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ShadeEngine
+{
+    const LightId LightMap::INVALID_LIGHT = 0xFFFFFFFF;
+
+    LightMap::LightMap() : m_ambient_color(sf::Color::Black), m_resolution_scale(0.25f), m_gradient_size(128), m_static_area(0.f, 0.f, 0.f, 0.f),
+        m_static_density(0.25f), m_gradient_outdated(true), m_static_outdated(false), m_light_map_outdated(true), m_static_map_valid(false),
+        m_view_center(0.f, 0.f), m_view_size(0.f, 0.f), m_view_rotation(0.f), m_render_count(0)
+    {
+    }
+
+    LightId LightMap::createLight(const sf::Vector2f &position, float radius, const sf::Color &color, bool is_static)
+    {
+        Light new_light = {position, radius, color, is_static, true};
+        LightId light;
+        if(!m_free_ids.empty())
+        {
+            light = m_free_ids.back();
+            m_free_ids.pop_back();
+            m_lights[light] = new_light;
+        }
+        else
+        {
+            light = static_cast<LightId>(m_lights.size());
+            m_lights.push_back(new_light);
+        }
+        invalidate(new_light);
+        return light;
+    }
+
+    void LightMap::destroyLight(LightId light)
+    {
+        if(!isValid(light))
+        {
+            return;
+        }
+        invalidate(m_lights[light]);
+        m_lights[light].alive = false;
+        m_free_ids.push_back(light);
+    }
+
+    bool LightMap::isValid(LightId light) const
+    {
+        return light < m_lights.size() && m_lights[light].alive;
+    }
+
+    void LightMap::setLightPosition(LightId light, const sf::Vector2f &position)
+    {
+        if(isValid(light))
+        {
+            invalidate(m_lights[light]); // Light may leave or enter the static area
+            m_lights[light].position = position;
+            invalidate(m_lights[light]);
+        }
+    }
+
+    void LightMap::setLightRadius(LightId light, float radius)
+    {
+        if(isValid(light))
+        {
+            invalidate(m_lights[light]);
+            m_lights[light].radius = radius;
+            invalidate(m_lights[light]);
+        }
+    }
+
+    void LightMap::setLightColor(LightId light, const sf::Color &color)
+    {
+        if(isValid(light))
+        {
+            m_lights[light].color = color;
+            invalidate(m_lights[light]);
+        }
+    }
+
+    void LightMap::setAmbientColor(const sf::Color &color)
+    {
+        m_ambient_color = color;
+        m_light_map_outdated = true;
+    }
+
+    sf::Color LightMap::getAmbientColor() const
+    {
+        return m_ambient_color;
+    }
+
+    void LightMap::setResolutionScale(float scale)
+    {
+        m_resolution_scale = std::max(1.f / 16.f, std::min(1.f, scale));
+    }
+
+    void LightMap::setGradientSize(unsigned int size)
+    {
+        m_gradient_size = std::max(8u, std::min(1024u, size));
+        m_gradient_outdated = true;
+    }
+
+    void LightMap::setStaticArea(const sf::FloatRect &area, float texels_per_unit)
+    {
+        m_static_area = area;
+        m_static_density = texels_per_unit;
+        m_static_outdated = true;
+    }
+
+    void LightMap::render(sf::RenderTarget &target, const sf::View &view)
+    {
+        sf::Vector2u target_size = target.getSize();
+        if(target_size.x == 0 || target_size.y == 0)
+        {
+            return;
+        }
+
+        if(m_gradient_outdated)
+        {
+            updateGradient();
+        }
+        if(m_static_outdated)
+        {
+            bakeStaticLights();
+        }
+
+        sf::Vector2u map_size(std::max(1u, static_cast<unsigned int>(target_size.x * m_resolution_scale)), std::max(1u, static_cast<unsigned int>(target_size.y * m_resolution_scale)));
+        sf::Vector2u current_size = m_light_map.getSize();
+        if(current_size.x != map_size.x || current_size.y != map_size.y)
+        {
+            if(!m_light_map.create(map_size.x, map_size.y))
+            {
+                return;
+            }
+            m_light_map.setSmooth(true); // Stretching a smoothed low resolution map blurs light edges for free
+            m_light_map_outdated = true;
+        }
+
+        const sf::Vector2f& view_center = view.getCenter();
+        const sf::Vector2f& view_size = view.getSize();
+        if(view_center.x != m_view_center.x || view_center.y != m_view_center.y || view_size.x != m_view_size.x || view_size.y != m_view_size.y || view.getRotation() != m_view_rotation)
+        {
+            m_view_center = view_center;
+            m_view_size = view_size;
+            m_view_rotation = view.getRotation();
+            m_light_map_outdated = true;
+        }
+
+        if(m_light_map_outdated)
+        {
+            m_light_map.clear(m_ambient_color);
+            m_light_map.setView(view); // Views are normalized, so the scene view covers the same area on the smaller map
+            if(m_static_map_valid)
+            {
+                sf::Vector2u baked_size = m_static_map.getSize();
+                sf::Sprite baked_lights(m_static_map.getTexture());
+                baked_lights.setPosition(m_static_area.left, m_static_area.top);
+                baked_lights.setScale(m_static_area.width / baked_size.x, m_static_area.height / baked_size.y);
+                m_light_map.draw(baked_lights, sf::BlendAdd);
+            }
+
+            m_vertices.clear();
+            for(std::vector<Light>::const_iterator light_it = m_lights.begin(); light_it != m_lights.end(); ++light_it)
+            {
+                if(light_it->alive && !isBaked(*light_it))
+                {
+                    appendLight(*light_it);
+                }
+            }
+            if(!m_vertices.empty())
+            {
+                sf::RenderStates states(sf::BlendAdd);
+                states.texture = &m_gradient;
+                m_light_map.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+            }
+            m_light_map.display();
+            m_light_map_outdated = false;
+            ++m_render_count;
+        }
+
+        // Multiply scene by the light map stretched over the whole target
+        sf::Sprite light_sprite(m_light_map.getTexture());
+        light_sprite.setScale(static_cast<float>(target_size.x) / map_size.x, static_cast<float>(target_size.y) / map_size.y);
+        target.setView(sf::View(sf::FloatRect(0.f, 0.f, static_cast<float>(target_size.x), static_cast<float>(target_size.y))));
+        target.draw(light_sprite, sf::BlendMultiply);
+    }
+
+    std::size_t LightMap::getRenderCount() const
+    {
+        return m_render_count;
+    }
+
+    bool LightMap::isBaked(const Light &light) const
+    {
+        return light.is_static && m_static_area.width > 0.f && m_static_area.height > 0.f &&
+               light.position.x - light.radius >= m_static_area.left && light.position.y - light.radius >= m_static_area.top &&
+               light.position.x + light.radius <= m_static_area.left + m_static_area.width && light.position.y + light.radius <= m_static_area.top + m_static_area.height;
+    }
+
+    void LightMap::invalidate(const Light &light)
+    {
+        if(isBaked(light))
+        {
+            m_static_outdated = true;
+        }
+        m_light_map_outdated = true;
+    }
+
+    void LightMap::updateGradient()
+    {
+        // White gradient whose alpha falls smoothly to zero at the radius, colored by vertex colors
+        sf::Image gradient;
+        gradient.create(m_gradient_size, m_gradient_size, sf::Color::Transparent);
+        float half_size = m_gradient_size / 2.f;
+        for(unsigned int y = 0; y < m_gradient_size; ++y)
+        {
+            for(unsigned int x = 0; x < m_gradient_size; ++x)
+            {
+                float dx = (x + 0.5f - half_size) / half_size;
+                float dy = (y + 0.5f - half_size) / half_size;
+                float falloff = std::max(0.f, 1.f - (dx * dx + dy * dy));
+                gradient.setPixel(x, y, sf::Color(255, 255, 255, static_cast<sf::Uint8>(255.f * falloff * falloff)));
+            }
+        }
+        m_gradient.loadFromImage(gradient);
+        m_gradient.setSmooth(true);
+        m_gradient_outdated = false;
+        m_static_outdated = true;
+        m_light_map_outdated = true;
+    }
+
+    void LightMap::bakeStaticLights()
+    {
+        m_static_outdated = false;
+        m_static_map_valid = false;
+        m_light_map_outdated = true;
+        if(m_static_area.width <= 0.f || m_static_area.height <= 0.f)
+        {
+            return;
+        }
+
+        unsigned int maximum_size = sf::Texture::getMaximumSize();
+        sf::Vector2u baked_size(std::min(maximum_size, std::max(1u, static_cast<unsigned int>(std::ceil(m_static_area.width * m_static_density)))),
+                                std::min(maximum_size, std::max(1u, static_cast<unsigned int>(std::ceil(m_static_area.height * m_static_density)))));
+        sf::Vector2u current_size = m_static_map.getSize();
+        if((current_size.x != baked_size.x || current_size.y != baked_size.y) && !m_static_map.create(baked_size.x, baked_size.y))
+        {
+            return; // Static lights are drawn like dynamic ones
+        }
+        m_static_map.setSmooth(true);
+
+        m_static_map.clear(sf::Color::Black); // Baked lights are added to the light map, black adds nothing
+        m_static_map.setView(sf::View(m_static_area));
+        m_vertices.clear();
+        for(std::vector<Light>::const_iterator light_it = m_lights.begin(); light_it != m_lights.end(); ++light_it)
+        {
+            if(light_it->alive && isBaked(*light_it))
+            {
+                appendLight(*light_it);
+            }
+        }
+        if(!m_vertices.empty())
+        {
+            sf::RenderStates states(sf::BlendAdd);
+            states.texture = &m_gradient;
+            m_static_map.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+        }
+        m_static_map.display();
+        m_static_map_valid = true;
+    }
+
+    void LightMap::appendLight(const Light &light)
+    {
+        float size = static_cast<float>(m_gradient_size);
+        float left = light.position.x - light.radius;
+        float right = light.position.x + light.radius;
+        float top = light.position.y - light.radius;
+        float bottom = light.position.y + light.radius;
+        m_vertices.push_back(sf::Vertex(sf::Vector2f(left, top), light.color, sf::Vector2f(0.f, 0.f)));
+        m_vertices.push_back(sf::Vertex(sf::Vector2f(right, top), light.color, sf::Vector2f(size, 0.f)));
+        m_vertices.push_back(sf::Vertex(sf::Vector2f(right, bottom), light.color, sf::Vector2f(size, size)));
+        m_vertices.push_back(sf::Vertex(sf::Vector2f(left, bottom), light.color, sf::Vector2f(0.f, size)));
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
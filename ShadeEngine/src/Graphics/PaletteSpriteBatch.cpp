@@ -0,0 +1,232 @@
+/*!
+ * @file PaletteSpriteBatch.cpp
+ * @brief Class used to draw palette-swapped sprites in a single draw call.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a sprite batch drawing indexed textures through a palette lookup shader. <br>
+ * Indexed textures store a palette entry in their red channel. Palettes are the rows of a lookup texture and each sprite selects its row, so that one indexed texture serves every palette.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Graphics/PaletteSpriteBatch.h"
+
+#include <map>
+
+namespace
+{
+    // Entry is read from the red channel of the indexed texture, row from the red channel of the vertex color
+    const char* const PALETTE_FRAGMENT_SHADER =
+        "uniform sampler2D texture;\n"
+        "uniform sampler2D palettes;\n"
+        "uniform float palette_size;\n"
+        "uniform float palette_count;\n"
+        "void main()\n"
+        "{\n"
+        "    vec4 indexed = texture2D(texture, gl_TexCoord[0].xy);\n"
+        "    vec2 lookup = vec2((indexed.r * 255.0 + 0.5) / palette_size, (gl_Color.r * 255.0 + 0.5) / palette_count);\n"
+        "    vec4 color = texture2D(palettes, lookup);\n"
+        "    gl_FragColor = vec4(color.rgb, color.a * indexed.a * gl_Color.a);\n"
+        "}\n";
+}
+
+namespace ShadeEngine
+{
+    const unsigned int PaletteSpriteBatch::PALETTE_SIZE = 256;
+
+    PaletteSpriteBatch::PaletteSpriteBatch() : m_shader_loaded(false)
+    {
+        if(isAvailable() && m_shader.loadFromMemory(PALETTE_FRAGMENT_SHADER, sf::Shader::Fragment))
+        {
+            m_shader.setUniform("texture", sf::Shader::CurrentTexture);
+            m_shader.setUniform("palette_size", static_cast<float>(PALETTE_SIZE));
+            m_shader.setUniform("palette_count", 1.f);
+            m_shader_loaded = true;
+        }
+    }
+
+    bool PaletteSpriteBatch::isValid() const
+    {
+        return m_shader_loaded;
+    }
+
+    void PaletteSpriteBatch::setPalettes(const std::shared_ptr<const sf::Texture> &palettes)
+    {
+        m_palettes = palettes;
+        if(m_shader_loaded && m_palettes)
+        {
+            m_shader.setUniform("palettes", *m_palettes); // Shader only keeps a pointer, m_palettes keeps the texture alive
+            m_shader.setUniform("palette_count", static_cast<float>(getPaletteCount()));
+        }
+    }
+
+    const std::shared_ptr<const sf::Texture>& PaletteSpriteBatch::getPalettes() const
+    {
+        return m_palettes;
+    }
+
+    unsigned int PaletteSpriteBatch::getPaletteCount() const
+    {
+        return m_palettes ? m_palettes->getSize().y : 0;
+    }
+
+    bool PaletteSpriteBatch::draw(sf::RenderTarget &target, const sf::Sprite &sprite, uint8_t palette, const sf::RenderStates &states)
+    {
+        return draw(target, sprite, palette, sf::Transform::Identity, states);
+    }
+
+    bool PaletteSpriteBatch::draw(sf::RenderTarget &target, const sf::Sprite &sprite, uint8_t palette, const sf::Transform &transform, const sf::RenderStates &states)
+    {
+        if(!m_shader_loaded || palette >= getPaletteCount()) // Indexed colors are meaningless without the lookup
+        {
+            return false;
+        }
+
+        sf::Sprite indexed_sprite(sprite); // Copy only holds a texture pointer, no allocation
+        indexed_sprite.setColor(sf::Color(palette, 0, 0, sprite.getColor().a));
+        m_batch.draw(target, indexed_sprite, transform, getPaletteStates(states));
+        return true;
+    }
+
+    void PaletteSpriteBatch::flush(sf::RenderTarget &target, const sf::RenderStates &states)
+    {
+        m_batch.flush(target, getPaletteStates(states));
+    }
+
+    std::size_t PaletteSpriteBatch::getDrawCallCount() const
+    {
+        return m_batch.getDrawCallCount();
+    }
+
+    bool PaletteSpriteBatch::isAvailable()
+    {
+        return sf::Shader::isAvailable();
+    }
+
+    sf::Image PaletteSpriteBatch::createPaletteImage(const std::vector< std::vector<sf::Color> > &palettes)
+    {
+        sf::Image image;
+        image.create(PALETTE_SIZE, static_cast<unsigned int>(palettes.size()), sf::Color::Transparent);
+        for(std::size_t row = 0; row < palettes.size(); ++row)
+        {
+            for(std::size_t entry = 0; entry < palettes[row].size() && entry < PALETTE_SIZE; ++entry)
+            {
+                image.setPixel(static_cast<unsigned int>(entry), static_cast<unsigned int>(row), palettes[row][entry]);
+            }
+        }
+        return image;
+    }
+
+    bool PaletteSpriteBatch::createIndexedImage(const sf::Image &source, const std::vector<sf::Color> &palette, sf::Image &indexed)
+    {
+        std::map<uint32_t, uint8_t> entries;
+        for(std::size_t entry = 0; entry < palette.size() && entry < PALETTE_SIZE; ++entry)
+        {
+            entries.insert(std::make_pair(palette[entry].toInteger(), static_cast<uint8_t>(entry))); // First entry wins for duplicated colors
+        }
+
+        sf::Vector2u size = source.getSize();
+        indexed.create(size.x, size.y, sf::Color::Transparent);
+        for(unsigned int y = 0; y < size.y; ++y)
+        {
+            for(unsigned int x = 0; x < size.x; ++x)
+            {
+                sf::Color color = source.getPixel(x, y);
+                if(color.a == 0)
+                {
+                    continue;
+                }
+                std::map<uint32_t, uint8_t>::const_iterator it = entries.find(color.toInteger());
+                if(it == entries.end())
+                {
+                    return false;
+                }
+                indexed.setPixel(x, y, sf::Color(it->second, 0, 0, 255)); // Opacity comes from the palette entry
+            }
+        }
+        return true;
+    }
+
+    sf::RenderStates PaletteSpriteBatch::getPaletteStates(const sf::RenderStates &states) const
+    {
+        sf::RenderStates palette_states(states);
+        palette_states.shader = &m_shader;
+        return palette_states;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,415 @@
+/*!
+ * @file RenderRecorder.cpp
+ * @brief Class used to capture the workload of a sprite layers renderer.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a recorder writing scene updates and frames submitted to a SpriteLayersRenderer into a capture file. <br>
+ * Captures can be replayed headlessly by the RenderReplay tool to compare renderer changes on identical workloads.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Graphics/RenderRecorder.h"
+#include "include/Graphics/SharedResources.h"
+#include "include/Core/Tracer.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace ShadeEngine
+{
+    const std::size_t RenderRecorder::FLUSH_THRESHOLD;
+
+    RenderRecorder::RenderRecorder(const QString &path) : m_file(path), m_next_texture_id(0), m_frame_count(0), m_stopping(false), m_write_failed(false)
+    {
+        m_buffer.reserve(FLUSH_THRESHOLD + 64 * 1024);
+        if(m_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            RenderCaptureHeader header;
+            std::memset(&header, 0, sizeof(header));
+            header.magic = RENDER_CAPTURE_MAGIC;
+            header.version = RENDER_CAPTURE_VERSION;
+            append(&header, sizeof(header));
+            m_writer = std::thread(&RenderRecorder::writerLoop, this);
+        }
+    }
+
+    RenderRecorder::~RenderRecorder()
+    {
+        flush();
+        if(m_writer.joinable())
+        {
+            {
+                std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_writer_mutex);
+                m_stopping = true;
+            }
+            m_writer_condition.notify_one();
+            m_writer.join();
+        }
+    }
+
+    bool RenderRecorder::isOpen() const
+    {
+        return m_file.isOpen();
+    }
+
+    void RenderRecorder::recordLayers(const std::vector<std::vector<sf::Sprite> > &sprite_layers)
+    {
+        declareTextures(sprite_layers);
+        std::size_t header_offset = beginRecord(CAPTURE_LAYERS);
+        appendLayers(sprite_layers);
+        endRecord(header_offset);
+    }
+
+    void RenderRecorder::recordState(const SpriteLayersRenderer &renderer)
+    {
+        recordLayers(renderer.getLayers());
+        const SpriteLayersRenderer::ChunkMap& chunks = renderer.getChunks();
+        for(SpriteLayersRenderer::ChunkMap::const_iterator chunk_it = chunks.begin(); chunk_it != chunks.end(); ++chunk_it)
+        {
+            recordChunkAttach(chunk_it->first, chunk_it->second);
+        }
+        for(std::size_t layer = 0; layer < renderer.getLayerCount(); ++layer)
+        {
+            if(renderer.getLayerSortMode(layer) != DRAW_ORDER)
+            {
+                recordSortMode(layer, renderer.getLayerSortMode(layer));
+            }
+        }
+    }
+
+    void RenderRecorder::recordChunkAttach(quint64 key, const std::vector<std::vector<sf::Sprite> > &chunk_layers)
+    {
+        declareTextures(chunk_layers);
+        std::size_t header_offset = beginRecord(CAPTURE_CHUNK_ATTACH);
+        uint64_t chunk_key = key;
+        append(&chunk_key, sizeof(chunk_key));
+        appendLayers(chunk_layers);
+        endRecord(header_offset);
+    }
+
+    void RenderRecorder::recordChunkDetach(quint64 key)
+    {
+        std::size_t header_offset = beginRecord(CAPTURE_CHUNK_DETACH);
+        uint64_t chunk_key = key;
+        append(&chunk_key, sizeof(chunk_key));
+        endRecord(header_offset);
+    }
+
+    void RenderRecorder::recordSortMode(std::size_t layer, LayerSortMode mode)
+    {
+        std::size_t header_offset = beginRecord(CAPTURE_SORT_MODE);
+        uint32_t values[2] = {static_cast<uint32_t>(layer), static_cast<uint32_t>(mode)};
+        append(values, sizeof(values));
+        endRecord(header_offset);
+    }
+
+    void RenderRecorder::recordFrame(SpriteLayersRenderer &renderer, const sf::Vector2u &target_size)
+    {
+        // Declare textures of scene graph sprites before the frame record starts
+        uint32_t overlay_sprite_count = 0;
+        renderer.getSceneGraph().forEachSprite([this, &overlay_sprite_count](std::size_t, const sf::Sprite& sprite, const sf::Transform&)
+        {
+            getTextureId(sprite.getTexture());
+            ++overlay_sprite_count;
+        });
+
+        const Camera& camera = renderer.getCamera();
+        uint32_t layer_count = static_cast<uint32_t>(renderer.getLayerCount());
+        CaptureFrameRecord frame;
+        std::memset(&frame, 0, sizeof(frame));
+        frame.width = target_size.x;
+        frame.height = target_size.y;
+        frame.center[0] = camera.getCenter().x;
+        frame.center[1] = camera.getCenter().y;
+        frame.zoom = camera.getZoom();
+        frame.positioned = camera.isPositioned() ? 1 : 0;
+        frame.pixel_snapping = camera.isPixelSnapping() ? 1 : 0;
+        frame.parallax_count = layer_count;
+        frame.overlay_sprite_count = overlay_sprite_count;
+
+        std::size_t header_offset = beginRecord(CAPTURE_FRAME);
+        append(&frame, sizeof(frame));
+        for(uint32_t layer = 0; layer < layer_count; ++layer)
+        {
+            float parallax = camera.getLayerParallax(layer);
+            append(&parallax, sizeof(parallax));
+        }
+        renderer.getSceneGraph().forEachSprite([this](std::size_t layer, const sf::Sprite& sprite, const sf::Transform& world_transform)
+        {
+            CaptureOverlaySpriteRecord record;
+            record.layer = static_cast<uint32_t>(layer);
+            record.texture = findTextureId(sprite.getTexture());
+            const sf::IntRect& rect = sprite.getTextureRect();
+            record.rect[0] = rect.left;
+            record.rect[1] = rect.top;
+            record.rect[2] = rect.width;
+            record.rect[3] = rect.height;
+            record.color = sprite.getColor().toInteger();
+            const float* matrix = (world_transform * sprite.getTransform()).getMatrix(); // 4x4 column major matrix
+            record.transform[0] = matrix[0];
+            record.transform[1] = matrix[4];
+            record.transform[2] = matrix[12];
+            record.transform[3] = matrix[1];
+            record.transform[4] = matrix[5];
+            record.transform[5] = matrix[13];
+            append(&record, sizeof(record));
+        });
+        endRecord(header_offset);
+        ++m_frame_count;
+    }
+
+    bool RenderRecorder::flush()
+    {
+        if(!m_file.isOpen())
+        {
+            m_buffer.clear();
+            return false;
+        }
+        if(m_buffer.empty())
+        {
+            return true;
+        }
+
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_writer_mutex);
+            m_pending_buffers.push_back(std::vector<uint8_t>());
+            m_pending_buffers.back().swap(m_buffer);
+            if(!m_free_buffers.empty())
+            {
+                m_buffer.swap(m_free_buffers.back()); // Keeps capacity of a written buffer
+                m_free_buffers.pop_back();
+            }
+        }
+        m_writer_condition.notify_one();
+        if(m_buffer.capacity() == 0)
+        {
+            m_buffer.reserve(FLUSH_THRESHOLD + 64 * 1024);
+        }
+        return !m_write_failed.load(std::memory_order_relaxed);
+    }
+
+    uint64_t RenderRecorder::getFrameCount() const
+    {
+        return m_frame_count;
+    }
+
+    void RenderRecorder::writerLoop()
+    {
+        Tracer::setThreadName("RenderRecorder writer");
+        std::vector<uint8_t> buffer;
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> mutex_lock(m_writer_mutex);
+                if(buffer.capacity() != 0)
+                {
+                    buffer.clear(); // Keeps capacity
+                    m_free_buffers.push_back(std::vector<uint8_t>());
+                    m_free_buffers.back().swap(buffer);
+                }
+                m_writer_condition.wait(mutex_lock, [this]() { return m_stopping || !m_pending_buffers.empty(); });
+                if(m_pending_buffers.empty()) // Stopping once everything is written
+                {
+                    return;
+                }
+                buffer.swap(m_pending_buffers.front());
+                m_pending_buffers.pop_front();
+            }
+
+            qint64 size = static_cast<qint64>(buffer.size());
+            if(m_file.write(reinterpret_cast<const char*>(buffer.data()), size) != size) // Written without holding the lock
+            {
+                m_write_failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void RenderRecorder::append(const void *data, std::size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    std::size_t RenderRecorder::beginRecord(RenderCaptureRecordType type)
+    {
+        std::size_t header_offset = m_buffer.size();
+        RenderCaptureRecordHeader header;
+        header.type = type;
+        header.size = 0; // Known once payload is written
+        append(&header, sizeof(header));
+        return header_offset;
+    }
+
+    void RenderRecorder::endRecord(std::size_t header_offset)
+    {
+        uint32_t payload_size = static_cast<uint32_t>(m_buffer.size() - header_offset - sizeof(RenderCaptureRecordHeader));
+        std::memcpy(m_buffer.data() + header_offset + offsetof(RenderCaptureRecordHeader, size), &payload_size, sizeof(payload_size));
+        if(m_buffer.size() >= FLUSH_THRESHOLD)
+        {
+            flush();
+        }
+    }
+
+    uint32_t RenderRecorder::getTextureId(const sf::Texture *texture)
+    {
+        if(texture == NULL)
+        {
+            return RENDER_CAPTURE_NO_TEXTURE;
+        }
+
+        std::unordered_map<const sf::Texture*, DeclaredTexture>::const_iterator id_it = m_texture_ids.find(texture);
+        if(id_it != m_texture_ids.end() && !(id_it->second.cached && id_it->second.cached_texture.expired()) && id_it->second.size == texture->getSize())
+        {
+            return id_it->second.id;
+        }
+
+        // New texture, possibly at the address of a destroyed one
+        DeclaredTexture& declared = m_texture_ids[texture];
+        declared.id = m_next_texture_id++;
+        declared.size = texture->getSize();
+        declared.cached_texture.reset();
+        std::string key = SharedResources::getInstance().findTextureKey(texture, &declared.cached_texture);
+        declared.cached = !key.empty();
+
+        CaptureTextureRecord record;
+        record.id = declared.id;
+        record.width = declared.size.x;
+        record.height = declared.size.y;
+        record.key_length = static_cast<uint32_t>(key.size());
+        std::size_t header_offset = beginRecord(CAPTURE_TEXTURE);
+        append(&record, sizeof(record));
+        append(key.data(), key.size());
+        endRecord(header_offset);
+        return record.id;
+    }
+
+    uint32_t RenderRecorder::findTextureId(const sf::Texture *texture) const
+    {
+        std::unordered_map<const sf::Texture*, DeclaredTexture>::const_iterator id_it = m_texture_ids.find(texture);
+        return id_it != m_texture_ids.end() ? id_it->second.id : RENDER_CAPTURE_NO_TEXTURE;
+    }
+
+    void RenderRecorder::declareTextures(const std::vector<std::vector<sf::Sprite> > &sprite_layers)
+    {
+        const sf::Texture* previous_texture = NULL;
+        for(std::vector< std::vector<sf::Sprite> >::const_iterator layer_it = sprite_layers.begin(); layer_it != sprite_layers.end(); ++layer_it)
+        {
+            for(std::vector<sf::Sprite>::const_iterator sprite_it = layer_it->begin(); sprite_it != layer_it->end(); ++sprite_it)
+            {
+                if(sprite_it->getTexture() != previous_texture) // Consecutive sprites often share their texture
+                {
+                    previous_texture = sprite_it->getTexture();
+                    getTextureId(previous_texture);
+                }
+            }
+        }
+    }
+
+    void RenderRecorder::appendLayers(const std::vector<std::vector<sf::Sprite> > &sprite_layers)
+    {
+        uint32_t layer_count = static_cast<uint32_t>(sprite_layers.size());
+        append(&layer_count, sizeof(layer_count));
+        for(std::vector< std::vector<sf::Sprite> >::const_iterator layer_it = sprite_layers.begin(); layer_it != sprite_layers.end(); ++layer_it)
+        {
+            uint32_t sprite_count = static_cast<uint32_t>(layer_it->size());
+            append(&sprite_count, sizeof(sprite_count));
+            for(std::vector<sf::Sprite>::const_iterator sprite_it = layer_it->begin(); sprite_it != layer_it->end(); ++sprite_it)
+            {
+                CaptureSpriteRecord record;
+                record.texture = findTextureId(sprite_it->getTexture());
+                const sf::IntRect& rect = sprite_it->getTextureRect();
+                record.rect[0] = rect.left;
+                record.rect[1] = rect.top;
+                record.rect[2] = rect.width;
+                record.rect[3] = rect.height;
+                record.color = sprite_it->getColor().toInteger();
+                record.position[0] = sprite_it->getPosition().x;
+                record.position[1] = sprite_it->getPosition().y;
+                record.origin[0] = sprite_it->getOrigin().x;
+                record.origin[1] = sprite_it->getOrigin().y;
+                record.scale[0] = sprite_it->getScale().x;
+                record.scale[1] = sprite_it->getScale().y;
+                record.rotation = sprite_it->getRotation();
+                append(&record, sizeof(record));
+            }
+        }
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
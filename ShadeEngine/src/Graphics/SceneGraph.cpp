@@ -0,0 +1,480 @@
+/*!
+ * @file SceneGraph.cpp
+ * @brief Class used to organize sprites as a hierarchy of nodes.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a scene graph in which each node is positioned relatively to its parent. <br>
+ * Nodes are stored in flat arrays sorted by depth so that world transforms are updated in a single linear sweep, only for dirty subtrees.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Graphics/SceneGraph.h"
+
+#include <algorithm>
+
+namespace
+{
+    /*!
+    * @brief Reorder an array following a permutation
+    * @param values : Array to reorder.
+    * @param order : Old index of each value in reordered array.
+    */
+    template<typename T>
+    void permute(std::vector<T>& values, const std::vector<uint32_t>& order)
+    {
+        std::vector<T> permuted;
+        permuted.reserve(order.size());
+        for(std::vector<uint32_t>::const_iterator it = order.begin(); it != order.end(); ++it)
+        {
+            permuted.push_back(values[*it]);
+        }
+        values.swap(permuted);
+    }
+}
+
+namespace ShadeEngine
+{
+    const SceneGraph::NodeId SceneGraph::ROOT;
+    const SceneGraph::NodeId SceneGraph::INVALID_NODE;
+    const int32_t SceneGraph::NO_LAYER;
+
+    SceneGraph::SceneGraph() : m_layer_count(0), m_nodes_destroyed(false)
+    {
+        m_node_ids.push_back(ROOT);
+        m_parent_indexes.push_back(-1);
+        m_local_transforms.push_back(sf::Transformable());
+        m_world_transforms.push_back(sf::Transform::Identity);
+        m_dirty.push_back(0);
+        m_destroyed.push_back(0);
+        m_sprite_layers.push_back(NO_LAYER);
+        m_sprites.push_back(sf::Sprite());
+        m_node_indexes.push_back(0);
+    }
+
+    SceneGraph::NodeId SceneGraph::createNode(NodeId parent)
+    {
+        if(!isValid(parent))
+        {
+            return INVALID_NODE;
+        }
+
+        NodeId node = static_cast<NodeId>(m_node_indexes.size());
+        if(!m_free_ids.empty())
+        {
+            node = m_free_ids.back();
+            m_free_ids.pop_back();
+        }
+        else
+        {
+            m_node_indexes.push_back(INVALID_NODE);
+        }
+
+        m_node_indexes[node] = static_cast<uint32_t>(m_node_ids.size()); // Appended after its parent so parents still come first
+        m_node_ids.push_back(node);
+        m_parent_indexes.push_back(static_cast<int32_t>(m_node_indexes[parent]));
+        m_local_transforms.push_back(sf::Transformable());
+        m_world_transforms.push_back(sf::Transform::Identity);
+        m_dirty.push_back(1);
+        m_destroyed.push_back(0);
+        m_sprite_layers.push_back(NO_LAYER);
+        m_sprites.push_back(sf::Sprite());
+        return node;
+    }
+
+    void SceneGraph::destroyNode(NodeId node)
+    {
+        if(node == ROOT || !isValid(node))
+        {
+            return;
+        }
+
+        // Descendants are stored after node and after their parent, so a single sweep reaches them all
+        std::size_t node_index = m_node_indexes[node];
+        m_destroyed[node_index] = 1;
+        for(std::size_t i = node_index + 1; i < m_parent_indexes.size(); ++i)
+        {
+            if(m_destroyed[m_parent_indexes[i]])
+            {
+                m_destroyed[i] = 1;
+            }
+        }
+        m_nodes_destroyed = true;
+    }
+
+    bool SceneGraph::setParent(NodeId node, NodeId parent)
+    {
+        if(node == ROOT || !isValid(node) || !isValid(parent))
+        {
+            return false;
+        }
+
+        int32_t node_index = static_cast<int32_t>(m_node_indexes[node]);
+        int32_t parent_index = static_cast<int32_t>(m_node_indexes[parent]);
+        for(int32_t ancestor = parent_index; ancestor != -1; ancestor = m_parent_indexes[ancestor])
+        {
+            if(ancestor == node_index) // Parent is a descendant of node
+            {
+                return false;
+            }
+        }
+
+        m_parent_indexes[node_index] = parent_index;
+        m_dirty[node_index] = 1;
+        if(parent_index < node_index)
+        {
+            return true;
+        }
+
+        // Move subtree of node right after its new parent. Other nodes keep their relative order, and none of them descends from node
+        std::vector<uint8_t> in_subtree(m_node_ids.size(), 0);
+        in_subtree[node_index] = 1;
+        for(std::size_t i = node_index + 1; i < m_node_ids.size(); ++i)
+        {
+            in_subtree[i] = in_subtree[m_parent_indexes[i]];
+        }
+        std::vector<uint32_t> order;
+        order.reserve(m_node_ids.size());
+        for(std::size_t i = 0; i <= static_cast<std::size_t>(parent_index); ++i)
+        {
+            if(!in_subtree[i])
+            {
+                order.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        for(std::size_t i = node_index; i < m_node_ids.size(); ++i)
+        {
+            if(in_subtree[i])
+            {
+                order.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        for(std::size_t i = parent_index + 1; i < m_node_ids.size(); ++i)
+        {
+            if(!in_subtree[i])
+            {
+                order.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        applyOrder(order);
+        return true;
+    }
+
+    bool SceneGraph::isValid(NodeId node) const
+    {
+        return node < m_node_indexes.size() && m_node_indexes[node] != INVALID_NODE && !m_destroyed[m_node_indexes[node]];
+    }
+
+    void SceneGraph::setPosition(NodeId node, const sf::Vector2f &position)
+    {
+        if(node != ROOT && isValid(node)) // Root keeps identity transform
+        {
+            m_local_transforms[m_node_indexes[node]].setPosition(position);
+            m_dirty[m_node_indexes[node]] = 1;
+        }
+    }
+
+    void SceneGraph::setRotation(NodeId node, float angle)
+    {
+        if(node != ROOT && isValid(node))
+        {
+            m_local_transforms[m_node_indexes[node]].setRotation(angle);
+            m_dirty[m_node_indexes[node]] = 1;
+        }
+    }
+
+    void SceneGraph::setScale(NodeId node, const sf::Vector2f &factors)
+    {
+        if(node != ROOT && isValid(node))
+        {
+            m_local_transforms[m_node_indexes[node]].setScale(factors);
+            m_dirty[m_node_indexes[node]] = 1;
+        }
+    }
+
+    void SceneGraph::setOrigin(NodeId node, const sf::Vector2f &origin)
+    {
+        if(node != ROOT && isValid(node))
+        {
+            m_local_transforms[m_node_indexes[node]].setOrigin(origin);
+            m_dirty[m_node_indexes[node]] = 1;
+        }
+    }
+
+    const sf::Transformable& SceneGraph::getLocalTransformable(NodeId node) const
+    {
+        return m_local_transforms[m_node_indexes[node]];
+    }
+
+    const sf::Transform& SceneGraph::getWorldTransform(NodeId node) const
+    {
+        return m_world_transforms[m_node_indexes[node]];
+    }
+
+    void SceneGraph::setSprite(NodeId node, const sf::Sprite &sprite, std::size_t layer)
+    {
+        if(isValid(node))
+        {
+            uint32_t index = m_node_indexes[node];
+            m_sprites[index] = sprite;
+            if(m_sprite_layers[index] != static_cast<int32_t>(layer))
+            {
+                removeFromLayer(index);
+                m_sprite_layers[index] = static_cast<int32_t>(layer);
+                addToLayer(index);
+            }
+        }
+    }
+
+    void SceneGraph::clearSprite(NodeId node)
+    {
+        if(isValid(node))
+        {
+            removeFromLayer(m_node_indexes[node]);
+            m_sprite_layers[m_node_indexes[node]] = NO_LAYER;
+        }
+    }
+
+    std::size_t SceneGraph::getLayerCount() const
+    {
+        return m_layer_count;
+    }
+
+    void SceneGraph::update()
+    {
+        if(m_nodes_destroyed)
+        {
+            std::vector<uint32_t> order;
+            order.reserve(m_node_ids.size());
+            for(std::size_t i = 0; i < m_node_ids.size(); ++i)
+            {
+                if(!m_destroyed[i])
+                {
+                    order.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            applyOrder(order);
+            m_nodes_destroyed = false;
+        }
+
+        // Parents are stored before children so a single sweep propagates dirtiness down to every descendant
+        std::size_t node_count = m_node_ids.size();
+        for(std::size_t i = 1; i < node_count; ++i)
+        {
+            int32_t parent = m_parent_indexes[i];
+            if(m_dirty[i] || m_dirty[parent])
+            {
+                m_world_transforms[i] = m_world_transforms[parent] * m_local_transforms[i].getTransform();
+                m_dirty[i] = 1;
+            }
+        }
+        std::fill(m_dirty.begin(), m_dirty.end(), 0);
+    }
+
+    void SceneGraph::draw(sf::RenderTarget &target, std::size_t layer, sf::RenderStates states) const
+    {
+        if(layer >= m_layer_nodes.size())
+        {
+            return;
+        }
+
+        sf::Transform base_transform = states.transform;
+        const std::vector<uint32_t>& layer_nodes = m_layer_nodes[layer];
+        for(std::vector<uint32_t>::const_iterator it = layer_nodes.begin(); it != layer_nodes.end(); ++it)
+        {
+            states.transform = base_transform * m_world_transforms[*it];
+            target.draw(m_sprites[*it], states);
+        }
+    }
+
+    void SceneGraph::forEachSprite(const std::function<void (std::size_t, const sf::Sprite &, const sf::Transform &)> &visitor) const
+    {
+        std::size_t node_count = m_node_ids.size();
+        for(std::size_t i = 1; i < node_count; ++i)
+        {
+            if(m_sprite_layers[i] != NO_LAYER)
+            {
+                visitor(static_cast<std::size_t>(m_sprite_layers[i]), m_sprites[i], m_world_transforms[i]);
+            }
+        }
+    }
+
+    SceneGraph::NodeId SceneGraph::findTopmostNode(std::size_t layer, const std::function<bool (const sf::Sprite &, const sf::Transform &)> &hit_test) const
+    {
+        if(layer >= m_layer_nodes.size())
+        {
+            return INVALID_NODE;
+        }
+
+        const std::vector<uint32_t>& layer_nodes = m_layer_nodes[layer];
+        for(std::vector<uint32_t>::const_reverse_iterator it = layer_nodes.rbegin(); it != layer_nodes.rend(); ++it) // Reverse drawing order
+        {
+            if(hit_test(m_sprites[*it], m_world_transforms[*it]))
+            {
+                return m_node_ids[*it];
+            }
+        }
+        return INVALID_NODE;
+    }
+
+    void SceneGraph::applyOrder(const std::vector<uint32_t>& order)
+    {
+        std::size_t node_count = m_node_ids.size();
+        std::vector<int32_t> new_indexes(node_count, -1);
+        for(std::size_t k = 0; k < order.size(); ++k)
+        {
+            new_indexes[order[k]] = static_cast<int32_t>(k);
+        }
+
+        // Release identifiers of nodes left out
+        for(std::size_t i = 0; i < node_count; ++i)
+        {
+            if(new_indexes[i] == -1)
+            {
+                m_node_indexes[m_node_ids[i]] = INVALID_NODE;
+                m_free_ids.push_back(m_node_ids[i]);
+            }
+        }
+
+        std::vector<int32_t> parent_indexes;
+        parent_indexes.reserve(order.size());
+        parent_indexes.push_back(-1);
+        for(std::size_t k = 1; k < order.size(); ++k)
+        {
+            parent_indexes.push_back(new_indexes[m_parent_indexes[order[k]]]);
+        }
+        m_parent_indexes.swap(parent_indexes);
+
+        permute(m_node_ids, order);
+        permute(m_local_transforms, order);
+        permute(m_world_transforms, order);
+        permute(m_sprite_layers, order);
+        permute(m_sprites, order);
+        permute(m_dirty, order);
+        permute(m_destroyed, order);
+
+        for(std::size_t k = 0; k < order.size(); ++k)
+        {
+            m_node_indexes[m_node_ids[k]] = static_cast<uint32_t>(k);
+        }
+
+        // Rebuilding in index order keeps each layer list sorted
+        for(std::vector< std::vector<uint32_t> >::iterator it = m_layer_nodes.begin(); it != m_layer_nodes.end(); ++it)
+        {
+            it->clear();
+        }
+        m_layer_count = 0;
+        for(std::size_t k = 1; k < order.size(); ++k)
+        {
+            if(m_sprite_layers[k] != NO_LAYER)
+            {
+                addToLayer(static_cast<uint32_t>(k));
+            }
+        }
+    }
+
+    void SceneGraph::addToLayer(uint32_t index)
+    {
+        std::size_t layer = static_cast<std::size_t>(m_sprite_layers[index]);
+        if(layer >= m_layer_nodes.size())
+        {
+            m_layer_nodes.resize(layer + 1);
+        }
+        m_layer_count = std::max(m_layer_count, layer + 1);
+
+        std::vector<uint32_t>& layer_nodes = m_layer_nodes[layer];
+        layer_nodes.insert(std::lower_bound(layer_nodes.begin(), layer_nodes.end(), index), index);
+    }
+
+    void SceneGraph::removeFromLayer(uint32_t index)
+    {
+        if(m_sprite_layers[index] == NO_LAYER)
+        {
+            return;
+        }
+
+        std::vector<uint32_t>& layer_nodes = m_layer_nodes[m_sprite_layers[index]];
+        std::vector<uint32_t>::iterator it = std::lower_bound(layer_nodes.begin(), layer_nodes.end(), index);
+        if(it != layer_nodes.end() && *it == index)
+        {
+            layer_nodes.erase(it);
+        }
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
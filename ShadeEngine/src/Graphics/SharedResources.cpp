@@ -0,0 +1,247 @@
+/*!
+ * @file SharedResources.cpp
+ * @brief Class used to share GPU resources between rendering widgets.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a process wide cache of textures and static geometry. <br>
+ * SFML makes every window context share its objects with all others, so a texture uploaded once can be drawn in every widget. This cache makes sure each resource is only uploaded once.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Graphics/SharedResources.h"
+#include "include/Core/MemoryProfiler.h"
+#include "include/Core/Tracer.h"
+
+#include <utility>
+
+namespace ShadeEngine
+{
+    SharedResources& SharedResources::getInstance()
+    {
+        static SharedResources instance; // Thread safe initialization
+        return instance;
+    }
+
+    SharedResources::SharedResources() : m_upload_count(0)
+    {
+    }
+
+    std::shared_ptr<const sf::Texture> SharedResources::getTexture(const std::string &path)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_RESOURCES);
+        SHADE_ENGINE_TRACE_SCOPE("SharedResources::getTexture");
+        std::unique_lock<std::mutex> mutex_lock(m_mutex);
+        std::map< std::string, std::shared_ptr<const sf::Texture> >::iterator texture_it = m_textures.find(path);
+        if(texture_it != m_textures.end())
+        {
+            return texture_it->second;
+        }
+        mutex_lock.unlock(); // Other widgets keep using the cache while the file is read and uploaded
+
+        std::shared_ptr<sf::Texture> texture(new sf::Texture());
+        if(!texture->loadFromFile(path))
+        {
+            return std::shared_ptr<const sf::Texture>();
+        }
+
+        mutex_lock.lock();
+        ++m_upload_count;
+        m_unknown_textures.clear(); // A texture unknown until now may live at this address
+        std::pair< std::map< std::string, std::shared_ptr<const sf::Texture> >::iterator, bool > insertion = m_textures.insert(std::make_pair(path, std::shared_ptr<const sf::Texture>(texture)));
+        return insertion.first->second; // Texture loaded concurrently by another thread if one was inserted first
+    }
+
+    std::shared_ptr<const sf::Texture> SharedResources::addTexture(const std::string &key, const sf::Image &image)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_RESOURCES);
+        SHADE_ENGINE_TRACE_SCOPE("SharedResources::addTexture");
+        std::shared_ptr<sf::Texture> texture(new sf::Texture());
+        if(!texture->loadFromImage(image)) // Uploaded without holding the lock
+        {
+            return std::shared_ptr<const sf::Texture>();
+        }
+
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        ++m_upload_count;
+        m_unknown_textures.clear(); // A texture unknown until now may live at this address
+        m_textures[key] = texture;
+        return texture;
+    }
+
+    std::string SharedResources::findTextureKey(const sf::Texture *texture, std::weak_ptr<const sf::Texture> *cached_texture)
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        for(std::map< std::string, std::shared_ptr<const sf::Texture> >::const_iterator texture_it = m_textures.begin(); texture_it != m_textures.end(); ++texture_it)
+        {
+            if(texture_it->second.get() == texture)
+            {
+                if(cached_texture != NULL)
+                {
+                    *cached_texture = texture_it->second;
+                }
+                return texture_it->first;
+            }
+        }
+        return std::string();
+    }
+
+    std::shared_ptr<const AlphaMask> SharedResources::getAlphaMask(const sf::Texture *texture)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_RESOURCES);
+        SHADE_ENGINE_TRACE_SCOPE("SharedResources::getAlphaMask");
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        std::map< const sf::Texture*, std::pair< std::weak_ptr<const sf::Texture>, std::shared_ptr<const AlphaMask> > >::iterator mask_it = m_alpha_masks.find(texture);
+        if(mask_it != m_alpha_masks.end() && !mask_it->second.first.expired()) // An expired entry belongs to a destroyed texture at the same address
+        {
+            return mask_it->second.second;
+        }
+        if(m_unknown_textures.count(texture) > 0)
+        {
+            return std::shared_ptr<const AlphaMask>();
+        }
+
+        for(std::map< std::string, std::shared_ptr<const sf::Texture> >::const_iterator texture_it = m_textures.begin(); texture_it != m_textures.end(); ++texture_it)
+        {
+            if(texture_it->second.get() == texture)
+            {
+                std::shared_ptr<const AlphaMask> mask(new AlphaMask(texture->copyToImage())); // Read back once per texture
+                m_alpha_masks[texture] = std::make_pair(std::weak_ptr<const sf::Texture>(texture_it->second), mask);
+                return mask;
+            }
+        }
+        m_unknown_textures.insert(texture);
+        return std::shared_ptr<const AlphaMask>();
+    }
+
+    std::shared_ptr<const sf::VertexArray> SharedResources::addVertexArray(const std::string &key, sf::VertexArray vertices)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_RESOURCES);
+        std::shared_ptr<const sf::VertexArray> vertex_array(new sf::VertexArray(std::move(vertices)));
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        m_vertex_arrays[key] = vertex_array;
+        return vertex_array;
+    }
+
+    std::shared_ptr<const sf::VertexArray> SharedResources::findVertexArray(const std::string &key)
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        std::map< std::string, std::shared_ptr<const sf::VertexArray> >::iterator vertex_array_it = m_vertex_arrays.find(key);
+        return vertex_array_it != m_vertex_arrays.end() ? vertex_array_it->second : std::shared_ptr<const sf::VertexArray>();
+    }
+
+    void SharedResources::releaseUnused()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        for(std::map< std::string, std::shared_ptr<const sf::Texture> >::iterator texture_it = m_textures.begin(); texture_it != m_textures.end();)
+        {
+            (texture_it->second.use_count() == 1) ? texture_it = m_textures.erase(texture_it) : ++texture_it; // Only referenced by the cache
+        }
+        for(std::map< std::string, std::shared_ptr<const sf::VertexArray> >::iterator vertex_array_it = m_vertex_arrays.begin(); vertex_array_it != m_vertex_arrays.end();)
+        {
+            (vertex_array_it->second.use_count() == 1) ? vertex_array_it = m_vertex_arrays.erase(vertex_array_it) : ++vertex_array_it;
+        }
+        for(std::map< const sf::Texture*, std::pair< std::weak_ptr<const sf::Texture>, std::shared_ptr<const AlphaMask> > >::iterator mask_it = m_alpha_masks.begin(); mask_it != m_alpha_masks.end();)
+        {
+            mask_it->second.first.expired() ? mask_it = m_alpha_masks.erase(mask_it) : ++mask_it;
+        }
+    }
+
+    void SharedResources::releaseAll()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        m_textures.clear();
+        m_vertex_arrays.clear();
+        m_alpha_masks.clear();
+        m_unknown_textures.clear();
+    }
+
+    std::size_t SharedResources::getTextureCount()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        return m_textures.size();
+    }
+
+    std::size_t SharedResources::getUploadCount()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_mutex);
+        return m_upload_count;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
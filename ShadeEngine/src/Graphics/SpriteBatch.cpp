@@ -0,0 +1,144 @@
+/*!
+ * @file SpriteBatch.cpp
+ * @brief Class used to merge consecutive sprites sharing a texture into a single draw call.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a sprite batch accumulating sprites as textured quads. <br>
+ * As long as consecutive sprites use the same texture they are appended to the same vertex array. The batch is drawn when the texture changes or when it is flushed.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Graphics/SpriteBatch.h"
+
+#include <cstdlib>
+
+namespace ShadeEngine
+{
+    SpriteBatch::SpriteBatch() : m_texture(NULL), m_draw_call_count(0)
+    {
+    }
+
+    void SpriteBatch::draw(sf::RenderTarget &target, const sf::Sprite &sprite, const sf::RenderStates &states)
+    {
+        draw(target, sprite, sf::Transform::Identity, states);
+    }
+
+    void SpriteBatch::draw(sf::RenderTarget &target, const sf::Sprite &sprite, const sf::Transform &transform, const sf::RenderStates &states)
+    {
+        if(sprite.getTexture() != m_texture)
+        {
+            flush(target, states); // Texture changes so current run ends here
+            m_texture = sprite.getTexture();
+        }
+
+        // Same geometry as sf::Sprite : size is the absolute size of texture rect, negative sizes flip texture coordinates
+        const sf::IntRect& rect = sprite.getTextureRect();
+        float width = static_cast<float>(std::abs(rect.width));
+        float height = static_cast<float>(std::abs(rect.height));
+        float left = static_cast<float>(rect.left);
+        float right = left + rect.width;
+        float top = static_cast<float>(rect.top);
+        float bottom = top + rect.height;
+
+        sf::Transform sprite_transform = transform * sprite.getTransform();
+        const sf::Color& color = sprite.getColor();
+        m_vertices.push_back(sf::Vertex(sprite_transform.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top)));
+        m_vertices.push_back(sf::Vertex(sprite_transform.transformPoint(width, 0.f), color, sf::Vector2f(right, top)));
+        m_vertices.push_back(sf::Vertex(sprite_transform.transformPoint(width, height), color, sf::Vector2f(right, bottom)));
+        m_vertices.push_back(sf::Vertex(sprite_transform.transformPoint(0.f, height), color, sf::Vector2f(left, bottom)));
+    }
+
+    void SpriteBatch::flush(sf::RenderTarget &target, sf::RenderStates states)
+    {
+        if(!m_vertices.empty())
+        {
+            states.texture = m_texture;
+            target.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+            ++m_draw_call_count;
+            m_vertices.clear(); // Keeps capacity for next frames
+        }
+    }
+
+    std::size_t SpriteBatch::getDrawCallCount() const
+    {
+        return m_draw_call_count;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
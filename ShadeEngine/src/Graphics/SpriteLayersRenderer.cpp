@@ -0,0 +1,319 @@
+/*!
+ * @file SpriteLayersRenderer.cpp
+ * @brief Class used to render overlapping layers of sprites.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a renderer drawing layers of sprites, world chunks and scene graph sprites through a camera. <br>
+ * It draws into any SFML render target, so that the same rendering code runs in widgets and in headless tools.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Graphics/SpriteLayersRenderer.h"
+#include "include/Core/ArenaAllocator.h"
+#include "include/Core/MemoryProfiler.h"
+
+#include <algorithm>
+
+namespace ShadeEngine
+{
+    SpriteLayersRenderer::SpriteLayersRenderer() : m_lighting_enabled(false), m_lighting_layer(0)
+    {
+    }
+
+    SceneGraph& SpriteLayersRenderer::getSceneGraph()
+    {
+        return m_scene_graph;
+    }
+
+    const SceneGraph& SpriteLayersRenderer::getSceneGraph() const
+    {
+        return m_scene_graph;
+    }
+
+    Camera& SpriteLayersRenderer::getCamera()
+    {
+        return m_camera;
+    }
+
+    const Camera& SpriteLayersRenderer::getCamera() const
+    {
+        return m_camera;
+    }
+
+    LightMap& SpriteLayersRenderer::getLightMap()
+    {
+        return m_light_map;
+    }
+
+    void SpriteLayersRenderer::setLighting(bool enabled, std::size_t layer)
+    {
+        m_lighting_enabled = enabled;
+        m_lighting_layer = layer;
+    }
+
+    bool SpriteLayersRenderer::isLightingEnabled() const
+    {
+        return m_lighting_enabled;
+    }
+
+    void SpriteLayersRenderer::swapLayers(std::vector<std::vector<sf::Sprite> > &sprite_layers)
+    {
+        m_sprite_layers.swap(sprite_layers);
+    }
+
+    const std::vector<std::vector<sf::Sprite> >& SpriteLayersRenderer::getLayers() const
+    {
+        return m_sprite_layers;
+    }
+
+    void SpriteLayersRenderer::attachChunk(quint64 key, std::vector<std::vector<sf::Sprite> > &chunk_layers)
+    {
+        m_chunks[key].swap(chunk_layers);
+    }
+
+    bool SpriteLayersRenderer::detachChunk(quint64 key, std::vector<std::vector<sf::Sprite> > &chunk_layers)
+    {
+        ChunkMap::iterator chunk_it = m_chunks.find(key);
+        if(chunk_it == m_chunks.end())
+        {
+            return false;
+        }
+        chunk_layers.swap(chunk_it->second);
+        m_chunks.erase(chunk_it);
+        return true;
+    }
+
+    const SpriteLayersRenderer::ChunkMap& SpriteLayersRenderer::getChunks() const
+    {
+        return m_chunks;
+    }
+
+    void SpriteLayersRenderer::setLayerSortMode(std::size_t layer, LayerSortMode mode)
+    {
+        if(layer >= m_layer_sort_modes.size())
+        {
+            m_layer_sort_modes.resize(layer + 1, DRAW_ORDER);
+        }
+        m_layer_sort_modes[layer] = mode;
+    }
+
+    LayerSortMode SpriteLayersRenderer::getLayerSortMode(std::size_t layer) const
+    {
+        return layer < m_layer_sort_modes.size() ? m_layer_sort_modes[layer] : DRAW_ORDER;
+    }
+
+    const std::vector<uint32_t>& SpriteLayersRenderer::getLayerDrawOrder(std::size_t layer) const
+    {
+        static const std::vector<uint32_t> empty_draw_order;
+        return layer < m_layer_draw_orders.size() ? m_layer_draw_orders[layer] : empty_draw_order;
+    }
+
+    std::size_t SpriteLayersRenderer::getLayerCount() const
+    {
+        std::size_t layer_count = std::max(m_sprite_layers.size(), m_scene_graph.getLayerCount());
+        for(ChunkMap::const_iterator chunk_it = m_chunks.begin(); chunk_it != m_chunks.end(); ++chunk_it)
+        {
+            layer_count = std::max(layer_count, chunk_it->second.size());
+        }
+        return layer_count;
+    }
+
+    void SpriteLayersRenderer::render(sf::RenderTarget &target, FrameArena &arena, float elapsed_seconds)
+    {
+        {
+            SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_SCENE_UPDATE);
+            m_scene_graph.update(); // Recompute world transforms of moved nodes only
+        }
+        m_camera.update(elapsed_seconds);
+        sf::Vector2u target_size = target.getSize();
+
+        // Draw
+        std::size_t layer_count = getLayerCount();
+        for(std::size_t layer = 0; layer < layer_count; ++layer) // Iterate over layers
+        {
+            target.setView(m_camera.getLayerView(layer, target_size)); // Scrolling is done by the view transform, sprites are left untouched
+            sf::FloatRect visible_area = m_camera.getLayerVisibleArea(layer, target_size);
+
+            for(ChunkMap::const_iterator chunk_it = m_chunks.begin(); chunk_it != m_chunks.end(); ++chunk_it) // Chunks are drawn below layer sprites
+            {
+                if(layer < chunk_it->second.size())
+                {
+                    for(std::vector<sf::Sprite>::const_iterator sprite_it = chunk_it->second[layer].begin(); sprite_it != chunk_it->second[layer].end(); ++sprite_it)
+                    {
+                        if(visible_area.intersects(sprite_it->getGlobalBounds()))
+                        {
+                            m_sprite_batch.draw(target, *sprite_it);
+                        }
+                    }
+                }
+            }
+            if(layer < m_sprite_layers.size())
+            {
+                std::vector<sf::Sprite>& sprites = m_sprite_layers[layer];
+                if(getLayerSortMode(layer) == Y_SORT)
+                {
+                    sortLayer(layer, arena);
+                    const std::vector<uint32_t>& draw_order = m_layer_draw_orders[layer];
+                    for(std::vector<uint32_t>::const_iterator index_it = draw_order.begin(); index_it != draw_order.end(); ++index_it) // Iterate on sprites in sorted order
+                    {
+                        const sf::Sprite& sprite = sprites[*index_it];
+                        if(visible_area.intersects(sprite.getGlobalBounds())) // Batch current sprite if visible
+                        {
+                            m_sprite_batch.draw(target, sprite);
+                        }
+                    }
+                }
+                else
+                {
+                    for(std::vector<sf::Sprite>::iterator sprite_it = sprites.begin(); sprite_it != sprites.end(); ++sprite_it) // Iterate on sprites in each layer
+                    {
+                        if(visible_area.intersects(sprite_it->getGlobalBounds())) // Batch current sprite if visible
+                        {
+                            m_sprite_batch.draw(target, *sprite_it);
+                        }
+                    }
+                }
+            }
+            m_sprite_batch.flush(target);
+            drawLayerOverlay(target, layer);
+
+            if(m_lighting_enabled && layer == std::min(m_lighting_layer, layer_count - 1)) // Layers above stay unlit
+            {
+                m_light_map.render(target, m_camera.getLayerView(layer, target_size));
+            }
+        }
+        target.setView(target.getDefaultView());
+    }
+
+    void SpriteLayersRenderer::drawLayerOverlay(sf::RenderTarget &target, std::size_t layer)
+    {
+        m_scene_graph.draw(target, layer); // Draw sprites of nodes belonging to current layer
+    }
+
+    void SpriteLayersRenderer::sortLayer(std::size_t layer, FrameArena &arena)
+    {
+        if(layer >= m_layer_draw_orders.size())
+        {
+            m_layer_draw_orders.resize(layer + 1);
+        }
+
+        const std::vector<sf::Sprite>& sprites = m_sprite_layers[layer];
+        std::vector<uint32_t>& draw_order = m_layer_draw_orders[layer];
+        std::size_t sprite_count = sprites.size();
+        if(draw_order.size() != sprite_count) // Layer content changed, previous order is meaningless
+        {
+            draw_order.resize(sprite_count);
+            for(std::size_t i = 0; i < sprite_count; ++i)
+            {
+                draw_order[i] = static_cast<uint32_t>(i);
+            }
+        }
+
+        FrameVector<float> sort_keys(sprite_count, 0.f, ArenaAllocator<float>(arena)); // Released with the frame
+        for(std::size_t i = 0; i < sprite_count; ++i)
+        {
+            sf::FloatRect bounds = sprites[i].getGlobalBounds();
+            sort_keys[i] = bounds.top + bounds.height; // Sort on the bottom of sprites, where characters stand
+        }
+
+        // Insertion sort is linear on nearly sorted data but quadratic in worst case, so bound the number of shifts
+        std::size_t shift_budget = 4 * sprite_count + 16;
+        std::size_t shift_count = 0;
+        for(std::size_t k = 1; k < sprite_count && shift_count <= shift_budget; ++k)
+        {
+            uint32_t index = draw_order[k];
+            float key = sort_keys[index];
+            std::size_t j = k;
+            while(j > 0 && sort_keys[draw_order[j-1]] > key && shift_count <= shift_budget) // Strict comparison keeps previous order of equal keys
+            {
+                draw_order[j] = draw_order[j-1];
+                --j;
+                ++shift_count;
+            }
+            draw_order[j] = index;
+        }
+
+        if(shift_count > shift_budget) // Too many sprites moved, a full sort is cheaper
+        {
+            std::stable_sort(draw_order.begin(), draw_order.end(), [&sort_keys](uint32_t a, uint32_t b) { return sort_keys[a] < sort_keys[b]; });
+        }
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
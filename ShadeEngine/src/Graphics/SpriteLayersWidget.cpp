@@ -65,20 +65,196 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 */
 
 #include "include/Graphics/SpriteLayersWidget.h"
+#include "include/Core/MemoryProfiler.h"
+#include "include/Core/Tracer.h"
 
+#include <algorithm>
 #include <utility>
-#include <iostream>
 
 namespace ShadeEngine
 {
-    SpriteLayersWidget::SpriteLayersWidget(const QPoint &position, const QSize &size, unsigned int refresh_rate_ms, QWidget *parent) : AbstractShadeWidget(position, size, refresh_rate_ms, parent)
+    SpriteLayersWidget::SpriteLayersWidget(const QPoint &position, const QSize &size, unsigned int refresh_rate_ms, QWidget *parent) : AbstractShadeWidget(position, size, refresh_rate_ms, parent),
+        m_picker_outdated(true)
     {
     }
 
-    void SpriteLayersWidget::updateLayersArray(std::vector<std::vector<sf::Sprite> > sprite_layers)
+    SceneGraph& SpriteLayersWidget::getSceneGraph()
+    {
+        return m_renderer.getSceneGraph();
+    }
+
+    Camera& SpriteLayersWidget::getCamera()
+    {
+        return m_renderer.getCamera();
+    }
+
+    LightMap& SpriteLayersWidget::getLightMap()
+    {
+        return m_renderer.getLightMap();
+    }
+
+    void SpriteLayersWidget::setLighting(bool enabled, std::size_t layer)
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent updating while layers are rendered
+        m_renderer.setLighting(enabled, layer);
+    }
+
+    void SpriteLayersWidget::setLayerSortMode(std::size_t layer, LayerSortMode mode)
     {
         std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent updating when layers are rendered
-        m_sprite_layers = std::move(sprite_layers);
+        m_renderer.setLayerSortMode(layer, mode);
+        m_picker_outdated = true;
+        if(m_recorder != NULL)
+        {
+            m_recorder->recordSortMode(layer, mode);
+        }
+    }
+
+    LayerSortMode SpriteLayersWidget::getLayerSortMode(std::size_t layer)
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent reading while mode is updated
+        return m_renderer.getLayerSortMode(layer);
+    }
+
+    bool SpriteLayersWidget::startRecording(const QString &path)
+    {
+        std::unique_ptr<RenderRecorder> recorder(new RenderRecorder(path));
+        if(!recorder->isOpen())
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex so that recorded state matches rendered state
+        recorder->recordState(m_renderer);
+        m_recorder.swap(recorder);
+        return true;
+    } // Previous recording is closed here
+
+    void SpriteLayersWidget::stopRecording()
+    {
+        std::unique_ptr<RenderRecorder> recorder;
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent recording while closing
+            m_recorder.swap(recorder);
+        } // Capture file is written without holding the lock
+    }
+
+    bool SpriteLayersWidget::isRecording()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent reading while recording starts or stops
+        return m_recorder != NULL;
+    }
+
+    bool SpriteLayersWidget::setVirtualResolution(const sf::Vector2u &resolution)
+    {
+        std::unique_ptr<sf::RenderTexture> virtual_target;
+        if(resolution.x > 0 && resolution.y > 0)
+        {
+            virtual_target.reset(new sf::RenderTexture());
+            if(!virtual_target->create(resolution.x, resolution.y))
+            {
+                return false;
+            }
+            virtual_target->setSmooth(false); // Upscaled pixels must stay sharp
+        }
+
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent changing target while rendering
+        m_virtual_target.swap(virtual_target);
+        return true;
+    }
+
+    sf::Vector2u SpriteLayersWidget::getVirtualResolution()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent reading while target changes
+        return m_virtual_target != NULL ? m_virtual_target->getSize() : sf::Vector2u(0, 0);
+    }
+
+    sf::IntRect SpriteLayersWidget::getPresentationArea()
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent reading while target changes
+        return computePresentationArea();
+    }
+
+    bool SpriteLayersWidget::pickSprite(const QPoint &position, PickResult &result, bool pixel_accurate)
+    {
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent picking while layers are updated
+        if(m_picker_outdated)
+        {
+            m_picker.build(m_renderer);
+            m_picker_outdated = false;
+        }
+
+        // Convert widget pixels into pixels of the target layers are rendered in
+        sf::IntRect area = computePresentationArea();
+        sf::Vector2u target_size = m_virtual_target != NULL ? m_virtual_target->getSize() : getSize();
+        if(area.width <= 0 || area.height <= 0)
+        {
+            return false;
+        }
+        sf::Vector2f target_position(static_cast<float>(position.x() - area.left) * target_size.x / area.width, static_cast<float>(position.y() - area.top) * target_size.y / area.height);
+        return m_picker.pick(m_renderer, target_size, target_position, pixel_accurate, result);
+    }
+
+    void SpriteLayersWidget::updateLayersArray(std::vector<std::vector<sf::Sprite> > sprite_layers)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_SCENE_UPDATE);
+        SHADE_ENGINE_TRACE_SCOPE("SpriteLayersWidget::updateLayersArray");
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent updating when layers are rendered
+            if(m_recorder != NULL)
+            {
+                m_recorder->recordLayers(sprite_layers);
+            }
+            m_renderer.swapLayers(sprite_layers);
+            m_picker_outdated = true;
+        } // Previous layers are released without holding the lock
+    }
+
+    void SpriteLayersWidget::updateScene(std::vector<std::vector<sf::Sprite> > sprite_layers, std::vector<std::shared_ptr<const sf::Texture> > textures)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_SCENE_UPDATE);
+        SHADE_ENGINE_TRACE_SCOPE("SpriteLayersWidget::updateScene");
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent updating when layers are rendered
+            if(m_recorder != NULL)
+            {
+                m_recorder->recordLayers(sprite_layers);
+            }
+            m_renderer.swapLayers(sprite_layers);
+            m_scene_textures.swap(textures);
+            m_picker_outdated = true;
+        } // Previous layers and textures are released without holding the lock
+    }
+
+    void SpriteLayersWidget::attachChunk(quint64 key, std::vector<std::vector<sf::Sprite> > chunk_layers)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_SCENE_UPDATE);
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent updating when layers are rendered
+            if(m_recorder != NULL)
+            {
+                m_recorder->recordChunkAttach(key, chunk_layers);
+            }
+            m_renderer.attachChunk(key, chunk_layers);
+            m_picker_outdated = true;
+        } // Previous content of the chunk is released without holding the lock
+    }
+
+    void SpriteLayersWidget::detachChunk(quint64 key)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_SCENE_UPDATE);
+        std::vector< std::vector<sf::Sprite> > detached_layers;
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent updating when layers are rendered
+            if(m_renderer.detachChunk(key, detached_layers))
+            {
+                m_picker_outdated = true;
+                if(m_recorder != NULL)
+                {
+                    m_recorder->recordChunkDetach(key);
+                }
+            }
+        } // Detached sprites are released without holding the lock
     }
 
     void SpriteLayersWidget::onInit()
@@ -91,15 +267,49 @@ namespace ShadeEngine
         std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_layers_mutex); // Lock mutex to prevent rendering when layers are updated
         fillBackground();
 
-        // Draw
-        for(std::vector< std::vector<sf::Sprite> >::iterator layer_it = m_sprite_layers.begin(); layer_it != m_sprite_layers.end(); ++layer_it ) // Iterate over layers
+        float elapsed_seconds = m_frame_clock.restart().asSeconds();
+        if(m_virtual_target == NULL)
         {
-            for(std::vector<sf::Sprite>::iterator sprite_it = layer_it->begin(); sprite_it != layer_it->end(); ++sprite_it) // Iterate on sprites in each layer
-            {
-                draw(*sprite_it); // Draw current sprite
-            }
+            m_renderer.render(*this, getFrameArena(), elapsed_seconds);
+        }
+        else
+        {
+            m_virtual_target->clear(getBackgroundColor());
+            m_renderer.render(*m_virtual_target, getFrameArena(), elapsed_seconds);
+            m_virtual_target->display();
+
+            // Present with a single quad, scaled by an integer factor and centered in widget pixels
+            sf::IntRect area = computePresentationArea();
+            sf::Vector2u widget_size = getSize();
+            sf::Vector2u virtual_size = m_virtual_target->getSize();
+            sf::Sprite presentation(m_virtual_target->getTexture());
+            presentation.setPosition(static_cast<float>(area.left), static_cast<float>(area.top));
+            presentation.setScale(static_cast<float>(area.width) / virtual_size.x, static_cast<float>(area.height) / virtual_size.y);
+            setView(sf::View(sf::FloatRect(0.f, 0.f, static_cast<float>(widget_size.x), static_cast<float>(widget_size.y))));
+            draw(presentation);
+            setView(getDefaultView());
+        }
+
+        if(m_recorder != NULL)
+        {
+            m_recorder->recordFrame(m_renderer, m_virtual_target != NULL ? m_virtual_target->getSize() : getSize());
         }
     }
+
+    sf::IntRect SpriteLayersWidget::computePresentationArea() const
+    {
+        sf::Vector2u widget_size = getSize();
+        if(m_virtual_target == NULL)
+        {
+            return sf::IntRect(0, 0, static_cast<int>(widget_size.x), static_cast<int>(widget_size.y));
+        }
+
+        sf::Vector2u virtual_size = m_virtual_target->getSize();
+        unsigned int scale = std::max(1u, std::min(widget_size.x / virtual_size.x, widget_size.y / virtual_size.y));
+        int width = static_cast<int>(virtual_size.x * scale);
+        int height = static_cast<int>(virtual_size.y * scale);
+        return sf::IntRect((static_cast<int>(widget_size.x) - width) / 2, (static_cast<int>(widget_size.y) - height) / 2, width, height); // Negative position crops when widget is too small
+    }
 }
 
 //  ______________________________
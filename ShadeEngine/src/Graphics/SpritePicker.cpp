@@ -0,0 +1,350 @@
+/*!
+ * @file SpritePicker.cpp
+ * @brief Class used to find which sprite is under a point of the screen.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a spatial index over the sprites of a SpriteLayersRenderer. <br>
+ * Each layer has a bounding volume hierarchy of sprite bounds. Picking walks layers from the topmost down and can refine hits with texture alpha masks.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Graphics/SpritePicker.h"
+#include "include/Graphics/SharedResources.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    /*!
+    * @brief Get smallest rectangle containing two rectangles
+    */
+    sf::FloatRect uniteRects(const sf::FloatRect& a, const sf::FloatRect& b)
+    {
+        float left = std::min(a.left, b.left);
+        float top = std::min(a.top, b.top);
+        float right = std::max(a.left + a.width, b.left + b.width);
+        float bottom = std::max(a.top + a.height, b.top + b.height);
+        return sf::FloatRect(left, top, right - left, bottom - top);
+    }
+}
+
+namespace ShadeEngine
+{
+    const std::size_t SpritePicker::LEAF_SIZE = 4;
+
+    SpritePicker::SpritePicker()
+    {
+    }
+
+    void SpritePicker::build(const SpriteLayersRenderer &renderer)
+    {
+        const std::vector< std::vector<sf::Sprite> >& sprite_layers = renderer.getLayers();
+        const SpriteLayersRenderer::ChunkMap& chunks = renderer.getChunks();
+        std::size_t layer_count = renderer.getLayerCount();
+        m_layers.resize(layer_count);
+
+        std::vector<uint32_t> draw_order;
+        for(std::size_t layer = 0; layer < layer_count; ++layer)
+        {
+            LayerIndex& layer_index = m_layers[layer];
+            layer_index.entries.clear(); // Keeps capacity for next builds
+            layer_index.nodes.clear();
+
+            // Rank sprites in drawing order : chunks first, then layers array
+            PickEntry entry;
+            for(SpriteLayersRenderer::ChunkMap::const_iterator chunk_it = chunks.begin(); chunk_it != chunks.end(); ++chunk_it)
+            {
+                if(layer < chunk_it->second.size())
+                {
+                    const std::vector<sf::Sprite>& sprites = chunk_it->second[layer];
+                    for(std::size_t i = 0; i < sprites.size(); ++i)
+                    {
+                        entry.bounds = sprites[i].getGlobalBounds();
+                        entry.rank = static_cast<uint32_t>(layer_index.entries.size());
+                        entry.sprite = &sprites[i];
+                        entry.source = PICK_CHUNK;
+                        entry.chunk_key = chunk_it->first;
+                        entry.index = i;
+                        layer_index.entries.push_back(entry);
+                    }
+                }
+            }
+            if(layer < sprite_layers.size())
+            {
+                const std::vector<sf::Sprite>& sprites = sprite_layers[layer];
+                const std::vector<uint32_t>& renderer_draw_order = renderer.getLayerDrawOrder(layer);
+                bool y_sorted = renderer.getLayerSortMode(layer) == Y_SORT;
+                if(y_sorted && renderer_draw_order.size() == sprites.size()) // Order of the frame on screen, ties included
+                {
+                    draw_order.assign(renderer_draw_order.begin(), renderer_draw_order.end());
+                }
+                else
+                {
+                    draw_order.resize(sprites.size());
+                    for(std::size_t i = 0; i < sprites.size(); ++i)
+                    {
+                        draw_order[i] = static_cast<uint32_t>(i);
+                    }
+                }
+                if(y_sorted && renderer_draw_order.size() != sprites.size()) // Layer changed since last render, sort it like the renderer will
+                {
+                    std::stable_sort(draw_order.begin(), draw_order.end(), [&sprites](uint32_t a, uint32_t b) {
+                        sf::FloatRect a_bounds = sprites[a].getGlobalBounds();
+                        sf::FloatRect b_bounds = sprites[b].getGlobalBounds();
+                        return a_bounds.top + a_bounds.height < b_bounds.top + b_bounds.height;
+                    });
+                }
+                for(std::vector<uint32_t>::const_iterator index_it = draw_order.begin(); index_it != draw_order.end(); ++index_it)
+                {
+                    entry.bounds = sprites[*index_it].getGlobalBounds();
+                    entry.rank = static_cast<uint32_t>(layer_index.entries.size());
+                    entry.sprite = &sprites[*index_it];
+                    entry.source = PICK_LAYERS;
+                    entry.chunk_key = 0;
+                    entry.index = *index_it;
+                    layer_index.entries.push_back(entry);
+                }
+            }
+
+            if(!layer_index.entries.empty())
+            {
+                buildNode(layer_index, 0, layer_index.entries.size());
+            }
+        }
+    }
+
+    bool SpritePicker::pick(const SpriteLayersRenderer &renderer, const sf::Vector2u &target_size, const sf::Vector2f &target_position, bool pixel_accurate, PickResult &result) const
+    {
+        if(target_size.x == 0 || target_size.y == 0)
+        {
+            return false;
+        }
+
+        const Camera& camera = renderer.getCamera();
+        const SceneGraph& scene_graph = renderer.getSceneGraph();
+        sf::Vector2f normalized_position(-1.f + 2.f * target_position.x / target_size.x, 1.f - 2.f * target_position.y / target_size.y); // View transforms map to normalized device coordinates
+        for(std::size_t layer = renderer.getLayerCount(); layer-- > 0;) // Topmost layer first
+        {
+            sf::Vector2f point = camera.getLayerView(layer, target_size).getInverseTransform().transformPoint(normalized_position);
+
+            SceneGraph::NodeId node = scene_graph.findTopmostNode(layer, [&point, pixel_accurate](const sf::Sprite& sprite, const sf::Transform& world_transform) {
+                return hitTest(sprite, world_transform, point, pixel_accurate);
+            });
+            if(node != SceneGraph::INVALID_NODE) // Scene graph sprites are drawn on top of the layer
+            {
+                result.source = PICK_SCENE_GRAPH;
+                result.layer = layer;
+                result.chunk_key = 0;
+                result.index = 0;
+                result.node = node;
+                result.world_position = point;
+                return true;
+            }
+
+            const PickEntry* entry = layer < m_layers.size() ? pickEntry(m_layers[layer], point, pixel_accurate) : NULL;
+            if(entry != NULL)
+            {
+                result.source = entry->source;
+                result.layer = layer;
+                result.chunk_key = entry->chunk_key;
+                result.index = entry->index;
+                result.node = SceneGraph::INVALID_NODE;
+                result.world_position = point;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool SpritePicker::hitTest(const sf::Sprite &sprite, const sf::Transform &transform, const sf::Vector2f &point, bool pixel_accurate)
+    {
+        sf::Vector2f local_point = (transform * sprite.getTransform()).getInverse().transformPoint(point);
+        const sf::IntRect& rect = sprite.getTextureRect();
+        if(local_point.x < 0.f || local_point.y < 0.f || local_point.x >= std::abs(rect.width) || local_point.y >= std::abs(rect.height))
+        {
+            return false;
+        }
+        if(!pixel_accurate || sprite.getTexture() == NULL)
+        {
+            return true;
+        }
+        std::shared_ptr<const AlphaMask> mask = SharedResources::getInstance().getAlphaMask(sprite.getTexture());
+        return mask == NULL || mask->isOpaque(sprite, local_point); // Textures unknown to the cache are tested on bounds only
+    }
+
+    void SpritePicker::buildNode(LayerIndex &layer_index, std::size_t begin, std::size_t end)
+    {
+        std::size_t node_index = layer_index.nodes.size();
+        layer_index.nodes.push_back(PickNode());
+
+        std::vector<PickEntry>& entries = layer_index.entries;
+        sf::FloatRect bounds = entries[begin].bounds;
+        uint32_t max_rank = entries[begin].rank;
+        float min_x = entries[begin].bounds.left + entries[begin].bounds.width / 2.f;
+        float max_x = min_x;
+        float min_y = entries[begin].bounds.top + entries[begin].bounds.height / 2.f;
+        float max_y = min_y;
+        for(std::size_t i = begin + 1; i < end; ++i)
+        {
+            bounds = uniteRects(bounds, entries[i].bounds);
+            max_rank = std::max(max_rank, entries[i].rank);
+            float center_x = entries[i].bounds.left + entries[i].bounds.width / 2.f;
+            float center_y = entries[i].bounds.top + entries[i].bounds.height / 2.f;
+            min_x = std::min(min_x, center_x);
+            max_x = std::max(max_x, center_x);
+            min_y = std::min(min_y, center_y);
+            max_y = std::max(max_y, center_y);
+        }
+        layer_index.nodes[node_index].bounds = bounds;
+        layer_index.nodes[node_index].max_rank = max_rank;
+
+        if(end - begin <= LEAF_SIZE)
+        {
+            layer_index.nodes[node_index].first = static_cast<uint32_t>(begin);
+            layer_index.nodes[node_index].count = static_cast<uint32_t>(end - begin);
+            return;
+        }
+
+        // Split at the median of sprite centers along the longest axis
+        std::size_t middle = begin + (end - begin) / 2;
+        if(max_x - min_x >= max_y - min_y)
+        {
+            std::nth_element(entries.begin() + begin, entries.begin() + middle, entries.begin() + end, [](const PickEntry& a, const PickEntry& b) {
+                return a.bounds.left + a.bounds.width / 2.f < b.bounds.left + b.bounds.width / 2.f;
+            });
+        }
+        else
+        {
+            std::nth_element(entries.begin() + begin, entries.begin() + middle, entries.begin() + end, [](const PickEntry& a, const PickEntry& b) {
+                return a.bounds.top + a.bounds.height / 2.f < b.bounds.top + b.bounds.height / 2.f;
+            });
+        }
+
+        buildNode(layer_index, begin, middle); // Left child directly follows its parent
+        layer_index.nodes[node_index].first = static_cast<uint32_t>(layer_index.nodes.size());
+        layer_index.nodes[node_index].count = 0;
+        buildNode(layer_index, middle, end);
+    }
+
+    const SpritePicker::PickEntry* SpritePicker::pickEntry(const LayerIndex &layer_index, const sf::Vector2f &point, bool pixel_accurate) const
+    {
+        if(layer_index.nodes.empty())
+        {
+            return NULL;
+        }
+
+        const PickEntry* best_entry = NULL;
+        uint32_t stack[64]; // Median splits keep depth below log2 of sprite count
+        std::size_t stack_size = 0;
+        stack[stack_size++] = 0;
+        while(stack_size > 0)
+        {
+            uint32_t node_index = stack[--stack_size];
+            const PickNode& node = layer_index.nodes[node_index];
+            if(!node.bounds.contains(point) || (best_entry != NULL && node.max_rank <= best_entry->rank)) // Nothing below can be drawn over best hit
+            {
+                continue;
+            }
+
+            if(node.count > 0)
+            {
+                for(uint32_t i = node.first; i < node.first + node.count; ++i)
+                {
+                    const PickEntry& entry = layer_index.entries[i];
+                    if((best_entry == NULL || entry.rank > best_entry->rank) && entry.bounds.contains(point) && hitTest(*entry.sprite, sf::Transform::Identity, point, pixel_accurate))
+                    {
+                        best_entry = &entry;
+                    }
+                }
+            }
+            else
+            {
+                // Visit child holding higher ranks first so that the other one is more likely to be skipped
+                uint32_t left = node_index + 1;
+                uint32_t right = node.first;
+                bool right_first = layer_index.nodes[right].max_rank > layer_index.nodes[left].max_rank;
+                stack[stack_size++] = right_first ? left : right;
+                stack[stack_size++] = right_first ? right : left;
+            }
+        }
+        return best_entry;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,330 @@
+/*!
+ * @file TextBatch.cpp
+ * @brief Class used to draw many text labels in a single draw call.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a text layer whose labels share the glyph atlas of a font. <br>
+ * Labels are laid out once when their string changes. Each frame, quads of visible labels are copied into one vertex buffer drawn with a single call.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Graphics/TextBatch.h"
+
+#include <algorithm>
+
+namespace
+{
+    const unsigned int TAB_SPACES = 4; // Width of a tabulation in spaces, as sf::Text
+}
+
+namespace ShadeEngine
+{
+    const LabelId TextBatch::INVALID_LABEL = 0xFFFFFFFF;
+
+    TextBatch::TextBatch(const sf::Font &font, unsigned int character_size) : m_font(font), m_character_size(character_size),
+        m_layout_count(0), m_draw_call_count(0)
+    {
+    }
+
+    LabelId TextBatch::createLabel(const sf::String &string, const sf::Vector2f &position, const sf::Color &color)
+    {
+        LabelId label;
+        if(m_free_ids.empty())
+        {
+            label = static_cast<LabelId>(m_labels.size());
+            m_labels.push_back(Label());
+        }
+        else
+        {
+            label = m_free_ids.back();
+            m_free_ids.pop_back();
+        }
+
+        Label& new_label = m_labels[label];
+        new_label.string = string;
+        new_label.position = position;
+        new_label.anchor = sf::Vector2f(0.f, 0.f);
+        new_label.color = color;
+        new_label.visible = true;
+        new_label.alive = true;
+        layout(new_label);
+        return label;
+    }
+
+    void TextBatch::destroyLabel(LabelId label)
+    {
+        if(isValid(label))
+        {
+            m_labels[label].alive = false;
+            m_labels[label].string.clear();
+            m_labels[label].glyph_vertices.clear(); // Keeps capacity for the next label using this identifier
+            m_free_ids.push_back(label);
+        }
+    }
+
+    bool TextBatch::isValid(LabelId label) const
+    {
+        return label < m_labels.size() && m_labels[label].alive;
+    }
+
+    void TextBatch::setString(LabelId label, const sf::String &string)
+    {
+        if(isValid(label) && m_labels[label].string != string)
+        {
+            m_labels[label].string = string;
+            layout(m_labels[label]);
+        }
+    }
+
+    void TextBatch::setPosition(LabelId label, const sf::Vector2f &position)
+    {
+        if(isValid(label))
+        {
+            m_labels[label].position = position;
+        }
+    }
+
+    void TextBatch::setColor(LabelId label, const sf::Color &color)
+    {
+        if(isValid(label))
+        {
+            m_labels[label].color = color;
+        }
+    }
+
+    void TextBatch::setAnchor(LabelId label, const sf::Vector2f &anchor)
+    {
+        if(isValid(label))
+        {
+            m_labels[label].anchor = anchor;
+        }
+    }
+
+    void TextBatch::setVisible(LabelId label, bool visible)
+    {
+        if(isValid(label))
+        {
+            m_labels[label].visible = visible;
+        }
+    }
+
+    sf::FloatRect TextBatch::getBounds(LabelId label) const
+    {
+        if(!isValid(label))
+        {
+            return sf::FloatRect();
+        }
+
+        const Label& existing_label = m_labels[label];
+        sf::Vector2f origin = getOrigin(existing_label);
+        return sf::FloatRect(origin.x + existing_label.local_bounds.left, origin.y + existing_label.local_bounds.top,
+                             existing_label.local_bounds.width, existing_label.local_bounds.height);
+    }
+
+    void TextBatch::draw(sf::RenderTarget &target, sf::RenderStates states)
+    {
+        const sf::View& view = target.getView();
+        const sf::Vector2f& view_size = view.getSize();
+        sf::FloatRect view_area(view.getCenter() - view_size / 2.f, view_size); // Ignores view rotation, good enough for culling text
+
+        m_vertices.clear(); // Keeps capacity so that steady state drawing does not allocate
+        for(std::vector<Label>::const_iterator it = m_labels.begin(); it != m_labels.end(); ++it)
+        {
+            if(!it->alive || !it->visible || it->glyph_vertices.empty())
+            {
+                continue;
+            }
+
+            sf::Vector2f origin = getOrigin(*it);
+            sf::FloatRect bounds(origin.x + it->local_bounds.left, origin.y + it->local_bounds.top, it->local_bounds.width, it->local_bounds.height);
+            if(!view_area.intersects(bounds))
+            {
+                continue;
+            }
+
+            for(std::vector<sf::Vertex>::const_iterator vertex = it->glyph_vertices.begin(); vertex != it->glyph_vertices.end(); ++vertex)
+            {
+                m_vertices.push_back(sf::Vertex(origin + vertex->position, it->color, vertex->texCoords));
+            }
+        }
+
+        if(!m_vertices.empty())
+        {
+            states.texture = &m_font.getTexture(m_character_size); // Fetched after layouts as adding glyphs may resize the atlas
+            target.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+            ++m_draw_call_count;
+        }
+    }
+
+    std::size_t TextBatch::getLayoutCount() const
+    {
+        return m_layout_count;
+    }
+
+    std::size_t TextBatch::getDrawCallCount() const
+    {
+        return m_draw_call_count;
+    }
+
+    void TextBatch::layout(Label &label)
+    {
+        ++m_layout_count;
+        label.glyph_vertices.clear();
+
+        float space_advance = m_font.getGlyph(L' ', m_character_size, false).advance;
+        float line_spacing = m_font.getLineSpacing(m_character_size);
+        float x = 0.f;
+        float y = static_cast<float>(m_character_size); // Baseline of first line, as sf::Text
+        float min_x = 0.f;
+        float min_y = 0.f;
+        float max_x = 0.f;
+        float max_y = 0.f;
+        bool has_glyph = false;
+
+        sf::Uint32 previous = 0;
+        for(std::size_t i = 0; i < label.string.getSize(); ++i)
+        {
+            sf::Uint32 current = label.string[i];
+            x += m_font.getKerning(previous, current, m_character_size);
+            previous = current;
+
+            if(current == L' ' || current == L'\t' || current == L'\n')
+            {
+                if(current == L' ')
+                {
+                    x += space_advance;
+                }
+                else if(current == L'\t')
+                {
+                    x += space_advance * TAB_SPACES;
+                }
+                else
+                {
+                    x = 0.f;
+                    y += line_spacing;
+                }
+                continue;
+            }
+
+            const sf::Glyph& glyph = m_font.getGlyph(current, m_character_size, false);
+            float left = x + glyph.bounds.left;
+            float top = y + glyph.bounds.top;
+            float right = left + glyph.bounds.width;
+            float bottom = top + glyph.bounds.height;
+
+            float u1 = static_cast<float>(glyph.textureRect.left);
+            float v1 = static_cast<float>(glyph.textureRect.top);
+            float u2 = u1 + glyph.textureRect.width;
+            float v2 = v1 + glyph.textureRect.height;
+
+            label.glyph_vertices.push_back(sf::Vertex(sf::Vector2f(left, top), sf::Color::White, sf::Vector2f(u1, v1)));
+            label.glyph_vertices.push_back(sf::Vertex(sf::Vector2f(right, top), sf::Color::White, sf::Vector2f(u2, v1)));
+            label.glyph_vertices.push_back(sf::Vertex(sf::Vector2f(right, bottom), sf::Color::White, sf::Vector2f(u2, v2)));
+            label.glyph_vertices.push_back(sf::Vertex(sf::Vector2f(left, bottom), sf::Color::White, sf::Vector2f(u1, v2)));
+
+            if(has_glyph)
+            {
+                min_x = std::min(min_x, left);
+                min_y = std::min(min_y, top);
+                max_x = std::max(max_x, right);
+                max_y = std::max(max_y, bottom);
+            }
+            else
+            {
+                min_x = left;
+                min_y = top;
+                max_x = right;
+                max_y = bottom;
+                has_glyph = true;
+            }
+
+            x += glyph.advance;
+        }
+
+        label.local_bounds = sf::FloatRect(min_x, min_y, max_x - min_x, max_y - min_y);
+    }
+
+    sf::Vector2f TextBatch::getOrigin(const Label &label) const
+    {
+        sf::Vector2f anchor_offset(label.local_bounds.left + label.anchor.x * label.local_bounds.width,
+                                   label.local_bounds.top + label.anchor.y * label.local_bounds.height);
+        return label.position - anchor_offset;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,197 @@
+/*!
+ * @file InputState.cpp
+ * @brief Class used to query keyboard and mouse state.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of the keyboard and mouse state accumulated from input events. <br>
+ * Key states are stored as bitsets indexed by a compact key index so that every query is O(1).
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Input/InputState.h"
+
+namespace ShadeEngine
+{
+    const std::size_t InputState::KEY_COUNT;
+
+    InputState::InputState() : m_buttons_down(0), m_buttons_pressed(0), m_mouse_position(0, 0), m_wheel_delta(0)
+    {
+    }
+
+    uint16_t InputState::getKeyIndex(int qt_key)
+    {
+        if(qt_key > 0 && qt_key < 0x100) // Latin-1 keys
+        {
+            return static_cast<uint16_t>(qt_key);
+        }
+        if((qt_key & 0xFFFFFF00) == 0x01000000) // Special keys start at Qt::Key_Escape
+        {
+            return static_cast<uint16_t>(0x100 | (qt_key & 0xFF));
+        }
+        return 0;
+    }
+
+    void InputState::beginFrame()
+    {
+        m_keys_pressed.reset();
+        m_keys_released.reset();
+        m_buttons_pressed = 0;
+        m_wheel_delta = 0;
+    }
+
+    void InputState::apply(const InputEvent &event)
+    {
+        switch(event.type)
+        {
+        case KEY_PRESSED:
+            if(event.key != 0 && !event.auto_repeat)
+            {
+                m_keys_down.set(event.key);
+                m_keys_pressed.set(event.key);
+            }
+            break;
+        case KEY_RELEASED:
+            if(event.key != 0)
+            {
+                m_keys_down.reset(event.key);
+                m_keys_released.set(event.key);
+            }
+            break;
+        case MOUSE_PRESSED:
+            m_buttons_down |= event.button;
+            m_buttons_pressed |= event.button;
+            m_mouse_position = sf::Vector2i(event.x, event.y);
+            break;
+        case MOUSE_RELEASED:
+            m_buttons_down &= ~event.button;
+            m_mouse_position = sf::Vector2i(event.x, event.y);
+            break;
+        case MOUSE_MOVED:
+            m_mouse_position = sf::Vector2i(event.x, event.y);
+            break;
+        case MOUSE_WHEEL:
+            m_wheel_delta += event.wheel_delta;
+            break;
+        case FOCUS_LOST: // Release everything so that no key stays stuck down
+            m_keys_released |= m_keys_down;
+            m_keys_down.reset();
+            m_buttons_down = 0;
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool InputState::isKeyDown(int qt_key) const
+    {
+        return m_keys_down.test(getKeyIndex(qt_key));
+    }
+
+    bool InputState::wasKeyPressed(int qt_key) const
+    {
+        return m_keys_pressed.test(getKeyIndex(qt_key));
+    }
+
+    bool InputState::wasKeyReleased(int qt_key) const
+    {
+        return m_keys_released.test(getKeyIndex(qt_key));
+    }
+
+    bool InputState::isMouseButtonDown(MouseButton button) const
+    {
+        return (m_buttons_down & button) != 0;
+    }
+
+    bool InputState::wasMouseButtonPressed(MouseButton button) const
+    {
+        return (m_buttons_pressed & button) != 0;
+    }
+
+    sf::Vector2i InputState::getMousePosition() const
+    {
+        return m_mouse_position;
+    }
+
+    int InputState::getWheelDelta() const
+    {
+        return m_wheel_delta;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
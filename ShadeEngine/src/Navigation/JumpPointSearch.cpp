@@ -0,0 +1,391 @@
+/*!
+ * @file JumpPointSearch.cpp
+ * @brief Class used to find shortest paths on tile grids.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a jump point search, an A* variant for uniform cost grids. <br>
+ * Straight and diagonal runs of tiles are skipped until a tile where the path may turn, so only a few nodes enter the open set. <br>
+ * Search buffers are kept between searches so that steady state queries do not allocate.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Navigation/JumpPointSearch.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    const float DIAGONAL_COST = 1.41421356f;
+
+    /*!
+    * @brief Order open nodes so that the heap top has the lowest estimate
+    */
+    struct OpenNodeCompare
+    {
+        template<typename Node> bool operator()(const Node& a, const Node& b) const
+        {
+            return a.estimate > b.estimate;
+        }
+    };
+
+    /*!
+    * @brief Get sign of a value as a direction
+    */
+    int getDirection(int value)
+    {
+        return (value > 0) - (value < 0);
+    }
+}
+
+namespace ShadeEngine
+{
+    JumpPointSearch::JumpPointSearch() : m_search_id(0), m_expanded_count(0), m_tiles(NULL), m_width(0), m_height(0), m_goal_x(0), m_goal_y(0)
+    {
+    }
+
+    bool JumpPointSearch::findPath(const NavigationGrid &grid, const sf::Vector2i &start, const sf::Vector2i &goal, std::vector<sf::Vector2i> &path)
+    {
+        path.clear();
+        m_expanded_count = 0;
+        if(!grid.isWalkable(start.x, start.y) || !grid.isWalkable(goal.x, goal.y))
+        {
+            return false;
+        }
+
+        // Prepare buffers, only allocated when grid grows
+        m_tiles = grid.getTiles();
+        m_width = grid.getWidth();
+        m_height = grid.getHeight();
+        m_goal_x = goal.x;
+        m_goal_y = goal.y;
+        std::size_t tile_count = static_cast<std::size_t>(m_width) * m_height;
+        if(m_costs.size() < tile_count)
+        {
+            m_costs.resize(tile_count);
+            m_parents.resize(tile_count);
+            m_reached_marks.resize(tile_count, 0);
+            m_closed_marks.resize(tile_count, 0);
+        }
+        if(++m_search_id == 0) // Identifier wrapped, old marks could be mistaken for current ones
+        {
+            std::fill(m_reached_marks.begin(), m_reached_marks.end(), 0);
+            std::fill(m_closed_marks.begin(), m_closed_marks.end(), 0);
+            m_search_id = 1;
+        }
+        m_open.clear();
+
+        uint32_t start_tile = static_cast<uint32_t>(start.y * m_width + start.x);
+        uint32_t goal_tile = static_cast<uint32_t>(goal.y * m_width + goal.x);
+        m_costs[start_tile] = 0.f;
+        m_parents[start_tile] = start_tile;
+        m_reached_marks[start_tile] = m_search_id;
+        OpenNode start_node = {getOctileDistance(goal.x - start.x, goal.y - start.y), start_tile};
+        m_open.push_back(start_node);
+
+        bool found = false;
+        while(!m_open.empty())
+        {
+            std::pop_heap(m_open.begin(), m_open.end(), OpenNodeCompare());
+            uint32_t tile = m_open.back().tile;
+            m_open.pop_back();
+            if(m_closed_marks[tile] == m_search_id) // Stale entry of a node reached again with a lower cost
+            {
+                continue;
+            }
+            m_closed_marks[tile] = m_search_id;
+            ++m_expanded_count;
+            if(tile == goal_tile)
+            {
+                found = true;
+                break;
+            }
+
+            int x = static_cast<int>(tile % m_width);
+            int y = static_cast<int>(tile / m_width);
+            if(tile == start_tile) // No parent, every direction is explored
+            {
+                for(int dy = -1; dy <= 1; ++dy)
+                {
+                    for(int dx = -1; dx <= 1; ++dx)
+                    {
+                        if((dx != 0 || dy != 0) && (dx == 0 || dy == 0 || (isWalkable(x + dx, y) && isWalkable(x, y + dy))))
+                        {
+                            addSuccessor(tile, dx, dy);
+                        }
+                    }
+                }
+                continue;
+            }
+
+            // Prune directions that a path through the parent would reach at a lower or equal cost
+            uint32_t parent = m_parents[tile];
+            int dx = getDirection(x - static_cast<int>(parent % m_width));
+            int dy = getDirection(y - static_cast<int>(parent / m_width));
+            if(dx != 0 && dy != 0)
+            {
+                bool vertical_walkable = isWalkable(x, y + dy);
+                bool horizontal_walkable = isWalkable(x + dx, y);
+                if(vertical_walkable)
+                {
+                    addSuccessor(tile, 0, dy);
+                }
+                if(horizontal_walkable)
+                {
+                    addSuccessor(tile, dx, 0);
+                }
+                if(vertical_walkable && horizontal_walkable)
+                {
+                    addSuccessor(tile, dx, dy);
+                }
+            }
+            else if(dx != 0)
+            {
+                bool next_walkable = isWalkable(x + dx, y);
+                bool down_walkable = isWalkable(x, y + 1);
+                bool up_walkable = isWalkable(x, y - 1);
+                if(next_walkable)
+                {
+                    addSuccessor(tile, dx, 0);
+                    if(down_walkable)
+                    {
+                        addSuccessor(tile, dx, 1);
+                    }
+                    if(up_walkable)
+                    {
+                        addSuccessor(tile, dx, -1);
+                    }
+                }
+                if(down_walkable)
+                {
+                    addSuccessor(tile, 0, 1);
+                }
+                if(up_walkable)
+                {
+                    addSuccessor(tile, 0, -1);
+                }
+            }
+            else
+            {
+                bool next_walkable = isWalkable(x, y + dy);
+                bool right_walkable = isWalkable(x + 1, y);
+                bool left_walkable = isWalkable(x - 1, y);
+                if(next_walkable)
+                {
+                    addSuccessor(tile, 0, dy);
+                    if(right_walkable)
+                    {
+                        addSuccessor(tile, 1, dy);
+                    }
+                    if(left_walkable)
+                    {
+                        addSuccessor(tile, -1, dy);
+                    }
+                }
+                if(right_walkable)
+                {
+                    addSuccessor(tile, 1, 0);
+                }
+                if(left_walkable)
+                {
+                    addSuccessor(tile, -1, 0);
+                }
+            }
+        }
+        if(!found)
+        {
+            return false;
+        }
+
+        // Walk jump points back to start, then fill straight and diagonal runs between them
+        m_jump_points.clear();
+        for(uint32_t tile = goal_tile; tile != start_tile; tile = m_parents[tile])
+        {
+            m_jump_points.push_back(tile);
+        }
+        path.push_back(start);
+        sf::Vector2i current = start;
+        for(std::vector<uint32_t>::reverse_iterator jump_it = m_jump_points.rbegin(); jump_it != m_jump_points.rend(); ++jump_it)
+        {
+            sf::Vector2i target(static_cast<int>(*jump_it % m_width), static_cast<int>(*jump_it / m_width));
+            sf::Vector2i step(getDirection(target.x - current.x), getDirection(target.y - current.y));
+            while(current != target)
+            {
+                current += step;
+                path.push_back(current);
+            }
+        }
+        return true;
+    }
+
+    std::size_t JumpPointSearch::getExpandedNodeCount() const
+    {
+        return m_expanded_count;
+    }
+
+    bool JumpPointSearch::isWalkable(int x, int y) const
+    {
+        return x >= 0 && y >= 0 && x < m_width && y < m_height && m_tiles[y * m_width + x] != 0;
+    }
+
+    bool JumpPointSearch::jump(int x, int y, int dx, int dy, int &jump_x, int &jump_y) const
+    {
+        int unused_x = 0;
+        int unused_y = 0;
+        while(true)
+        {
+            x += dx;
+            y += dy;
+            if(!isWalkable(x, y))
+            {
+                return false;
+            }
+            if(x == m_goal_x && y == m_goal_y)
+            {
+                break;
+            }
+
+            if(dx != 0 && dy != 0)
+            {
+                if(jump(x, y, dx, 0, unused_x, unused_y) || jump(x, y, 0, dy, unused_x, unused_y)) // A straight run from here reaches a jump point
+                {
+                    break;
+                }
+            }
+            else if(dx != 0)
+            {
+                if((isWalkable(x, y - 1) && !isWalkable(x - dx, y - 1)) || (isWalkable(x, y + 1) && !isWalkable(x - dx, y + 1))) // Forced neighbor behind an obstacle corner
+                {
+                    break;
+                }
+            }
+            else
+            {
+                if((isWalkable(x - 1, y) && !isWalkable(x - 1, y - dy)) || (isWalkable(x + 1, y) && !isWalkable(x + 1, y - dy)))
+                {
+                    break;
+                }
+            }
+
+            if(!isWalkable(x + dx, y) || !isWalkable(x, y + dy)) // Next diagonal step would cut a corner
+            {
+                return false;
+            }
+        }
+        jump_x = x;
+        jump_y = y;
+        return true;
+    }
+
+    void JumpPointSearch::addSuccessor(uint32_t tile, int dx, int dy)
+    {
+        int x = static_cast<int>(tile % m_width);
+        int y = static_cast<int>(tile / m_width);
+        int jump_x = 0;
+        int jump_y = 0;
+        if(!jump(x, y, dx, dy, jump_x, jump_y))
+        {
+            return;
+        }
+
+        uint32_t jump_tile = static_cast<uint32_t>(jump_y * m_width + jump_x);
+        if(m_closed_marks[jump_tile] == m_search_id)
+        {
+            return;
+        }
+        float cost = m_costs[tile] + getOctileDistance(jump_x - x, jump_y - y);
+        if(m_reached_marks[jump_tile] != m_search_id || cost < m_costs[jump_tile])
+        {
+            m_reached_marks[jump_tile] = m_search_id;
+            m_costs[jump_tile] = cost;
+            m_parents[jump_tile] = tile;
+            OpenNode node = {cost + getOctileDistance(m_goal_x - jump_x, m_goal_y - jump_y), jump_tile};
+            m_open.push_back(node);
+            std::push_heap(m_open.begin(), m_open.end(), OpenNodeCompare());
+        }
+    }
+
+    float JumpPointSearch::getOctileDistance(int dx, int dy)
+    {
+        int abs_x = std::abs(dx);
+        int abs_y = std::abs(dy);
+        return DIAGONAL_COST * std::min(abs_x, abs_y) + static_cast<float>(std::abs(abs_x - abs_y));
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
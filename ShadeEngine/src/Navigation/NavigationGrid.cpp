@@ -0,0 +1,126 @@
+/*!
+ * @file NavigationGrid.cpp
+ * @brief Class used to describe which tiles of a map can be walked on.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a grid of walkable and blocked tiles. <br>
+ * Tiles are stored as one byte each, row after row, so that path searches read them directly.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Navigation/NavigationGrid.h"
+
+#include <algorithm>
+
+namespace ShadeEngine
+{
+    NavigationGrid::NavigationGrid(int width, int height, bool walkable) : m_width(std::max(0, width)), m_height(std::max(0, height)),
+        m_tiles(static_cast<std::size_t>(m_width) * m_height, walkable ? 1 : 0)
+    {
+    }
+
+    int NavigationGrid::getWidth() const
+    {
+        return m_width;
+    }
+
+    int NavigationGrid::getHeight() const
+    {
+        return m_height;
+    }
+
+    bool NavigationGrid::isWalkable(int x, int y) const
+    {
+        return x >= 0 && y >= 0 && x < m_width && y < m_height && m_tiles[static_cast<std::size_t>(y) * m_width + x] != 0;
+    }
+
+    void NavigationGrid::setWalkable(int x, int y, bool walkable)
+    {
+        if(x >= 0 && y >= 0 && x < m_width && y < m_height)
+        {
+            m_tiles[static_cast<std::size_t>(y) * m_width + x] = walkable ? 1 : 0;
+        }
+    }
+
+    const uint8_t* NavigationGrid::getTiles() const
+    {
+        return m_tiles.data();
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,307 @@
+/*!
+ * @file PathfindingService.cpp
+ * @brief Class used to compute character paths in the background.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of an asynchronous pathfinding service for tile maps. <br>
+ * Path requests are queued and served by worker threads running jump point searches on a snapshot of the grid. <br>
+ * Found paths are cached and delivered back on the thread owning the service.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Navigation/PathfindingService.h"
+#include "include/Navigation/JumpPointSearch.h"
+#include "include/Core/Tracer.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    const uint64_t UNCACHED_KEY = 0xFFFFFFFFFFFFFFFFull; // Key of requests out of the grid, never cached
+}
+
+namespace ShadeEngine
+{
+    PathfindingService::PathfindingService(const NavigationGrid &grid, unsigned int worker_count) : QObject(), m_grid(grid), m_grid_version(0),
+        m_grid_published(true), m_next_request_id(0), m_cache_capacity(1024), m_cache_hit_count(0), m_snapshot(new NavigationGrid(grid)),
+        m_snapshot_version(0), m_stopping(false)
+    {
+        for(unsigned int i = 0; i < std::max(1u, worker_count); ++i)
+        {
+            m_workers.push_back(std::thread(&PathfindingService::workerLoop, this));
+        }
+    }
+
+    PathfindingService::~PathfindingService()
+    {
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+            m_stopping = true;
+        }
+        m_queue_condition.notify_all();
+        for(std::vector<std::thread>::iterator worker_it = m_workers.begin(); worker_it != m_workers.end(); ++worker_it)
+        {
+            worker_it->join();
+        }
+    }
+
+    const NavigationGrid& PathfindingService::getGrid() const
+    {
+        return m_grid;
+    }
+
+    void PathfindingService::setWalkable(int x, int y, bool walkable)
+    {
+        if(m_grid.isWalkable(x, y) == walkable || x < 0 || y < 0 || x >= m_grid.getWidth() || y >= m_grid.getHeight())
+        {
+            return;
+        }
+        m_grid.setWalkable(x, y, walkable);
+        ++m_grid_version;
+        m_grid_published = false; // Copied once before next search, so that a batch of changes costs a single copy
+        m_cache.clear();
+        m_cache_order.clear();
+    }
+
+    void PathfindingService::setCacheCapacity(std::size_t capacity)
+    {
+        m_cache_capacity = capacity;
+        while(m_cache_order.size() > m_cache_capacity)
+        {
+            m_cache.erase(m_cache_order.front());
+            m_cache_order.pop_front();
+        }
+    }
+
+    quint64 PathfindingService::requestPath(const sf::Vector2i &start, const sf::Vector2i &goal)
+    {
+        PathRequest request = {m_next_request_id++, start, goal, false};
+
+        std::unordered_map<uint64_t, CachedPath>::const_iterator cache_it = m_cache.find(getCacheKey(start, goal));
+        if(cache_it != m_cache.end())
+        {
+            PathResult result;
+            result.request = request;
+            result.grid_version = m_grid_version;
+            result.found = cache_it->second.found;
+            result.path = cache_it->second.path;
+            m_cached_results.push_back(std::move(result));
+            ++m_cache_hit_count;
+            return request.id;
+        }
+
+        publishGrid();
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+            m_requests.push_back(request);
+        }
+        m_queue_condition.notify_one();
+        return request.id;
+    }
+
+    std::size_t PathfindingService::getCacheHitCount() const
+    {
+        return m_cache_hit_count;
+    }
+
+    void PathfindingService::update()
+    {
+        std::vector<PathResult> results;
+        results.swap(m_cached_results);
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+            for(std::vector<PathResult>::iterator result_it = m_results.begin(); result_it != m_results.end(); ++result_it)
+            {
+                results.push_back(std::move(*result_it));
+            }
+            m_results.clear();
+        }
+
+        std::vector<PathRequest> outdated_requests;
+        for(std::vector<PathResult>::iterator result_it = results.begin(); result_it != results.end(); ++result_it)
+        {
+            bool outdated = result_it->grid_version != m_grid_version; // Tiles changed while searching, path may cross a blocked tile
+            if(outdated && !result_it->request.retried)
+            {
+                result_it->request.retried = true;
+                outdated_requests.push_back(result_it->request);
+                continue;
+            }
+            if(!outdated) // A second outdated result is delivered, but never cached
+            {
+                cachePath(getCacheKey(result_it->request.start, result_it->request.goal), result_it->found, result_it->path);
+            }
+            emit pathReady(result_it->request.id, result_it->found, std::move(result_it->path));
+        }
+
+        if(!outdated_requests.empty())
+        {
+            publishGrid();
+            {
+                std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+                m_requests.insert(m_requests.begin(), outdated_requests.begin(), outdated_requests.end()); // Oldest requests first
+            }
+            m_queue_condition.notify_all();
+        }
+    }
+
+    void PathfindingService::workerLoop()
+    {
+        Tracer::setThreadName("PathfindingService worker");
+        JumpPointSearch search;
+        while(true)
+        {
+            PathRequest request;
+            std::shared_ptr<const NavigationGrid> grid;
+            uint64_t grid_version = 0;
+            {
+                std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+                m_queue_condition.wait(mutex_lock, [this]() { return m_stopping || !m_requests.empty(); });
+                if(m_stopping)
+                {
+                    return;
+                }
+                request = m_requests.front();
+                m_requests.pop_front();
+                grid = m_snapshot; // Keeps the snapshot alive even if a newer one is published during the search
+                grid_version = m_snapshot_version;
+            }
+
+            PathResult result;
+            result.request = request;
+            result.grid_version = grid_version;
+            {
+                SHADE_ENGINE_TRACE_SCOPE("PathfindingService::findPath");
+                result.found = search.findPath(*grid, request.start, request.goal, result.path);
+            }
+
+            {
+                std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+                m_results.push_back(std::move(result));
+            }
+        }
+    }
+
+    void PathfindingService::publishGrid()
+    {
+        if(m_grid_published)
+        {
+            return;
+        }
+        std::shared_ptr<const NavigationGrid> snapshot(new NavigationGrid(m_grid)); // Copied without holding the lock
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+            m_snapshot.swap(snapshot);
+            m_snapshot_version = m_grid_version;
+        }
+        m_grid_published = true;
+    }
+
+    void PathfindingService::cachePath(uint64_t key, bool found, const std::vector<sf::Vector2i> &path)
+    {
+        if(m_cache_capacity == 0 || key == UNCACHED_KEY || m_cache.find(key) != m_cache.end())
+        {
+            return;
+        }
+        if(m_cache_order.size() >= m_cache_capacity)
+        {
+            m_cache.erase(m_cache_order.front());
+            m_cache_order.pop_front();
+        }
+        CachedPath& cached_path = m_cache[key];
+        cached_path.found = found;
+        cached_path.path = path;
+        m_cache_order.push_back(key);
+    }
+
+    uint64_t PathfindingService::getCacheKey(const sf::Vector2i &start, const sf::Vector2i &goal) const
+    {
+        if(start.x < 0 || start.y < 0 || goal.x < 0 || goal.y < 0 || start.x >= m_grid.getWidth() || start.y >= m_grid.getHeight() ||
+           goal.x >= m_grid.getWidth() || goal.y >= m_grid.getHeight())
+        {
+            return UNCACHED_KEY;
+        }
+        uint64_t tile_count = static_cast<uint64_t>(m_grid.getWidth()) * m_grid.getHeight();
+        uint64_t start_tile = static_cast<uint64_t>(start.y) * m_grid.getWidth() + start.x;
+        uint64_t goal_tile = static_cast<uint64_t>(goal.y) * m_grid.getWidth() + goal.x;
+        return start_tile * tile_count + goal_tile;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,251 @@
+/*!
+ * @file BitStream.cpp
+ * @brief Class used to pack values on the exact number of bits they need.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a growable bit buffer with a write cursor and a read cursor. <br>
+ * Bits are packed least significant first, values may span several bytes.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Network/BitStream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    uint64_t getMaxQuantized(unsigned int bits)
+    {
+        return (static_cast<uint64_t>(1) << bits) - 1;
+    }
+}
+
+namespace ShadeEngine
+{
+    BitStream::BitStream() : m_bit_count(0), m_read_position(0)
+    {
+    }
+
+    void BitStream::clear()
+    {
+        m_data.clear();
+        m_bit_count = 0;
+        m_read_position = 0;
+    }
+
+    void BitStream::setData(const void *data, std::size_t size)
+    {
+        m_data.resize(size);
+        if(size > 0)
+        {
+            std::memcpy(m_data.data(), data, size);
+        }
+        m_bit_count = size * 8;
+        m_read_position = 0;
+    }
+
+    void BitStream::writeBits(uint32_t value, unsigned int count)
+    {
+        while(count > 0)
+        {
+            unsigned int offset = m_bit_count % 8;
+            if(offset == 0)
+            {
+                m_data.push_back(0);
+            }
+            unsigned int written = std::min(8 - offset, count); // Fill current byte first
+            m_data.back() |= static_cast<uint8_t>((value & ((1u << written) - 1)) << offset);
+            value >>= written;
+            count -= written;
+            m_bit_count += written;
+        }
+    }
+
+    void BitStream::writeBool(bool value)
+    {
+        writeBits(value ? 1 : 0, 1);
+    }
+
+    void BitStream::writeVarint(uint64_t value)
+    {
+        while(value >= 0x80)
+        {
+            writeBits(static_cast<uint32_t>(value & 0x7F) | 0x80, 8); // 7 bits of payload and a continuation bit
+            value >>= 7;
+        }
+        writeBits(static_cast<uint32_t>(value), 8);
+    }
+
+    bool BitStream::readBits(uint32_t &value, unsigned int count)
+    {
+        if(m_read_position + count > m_bit_count)
+        {
+            return false;
+        }
+
+        value = 0;
+        unsigned int read = 0;
+        while(read < count)
+        {
+            unsigned int offset = m_read_position % 8;
+            unsigned int chunk = std::min(8 - offset, count - read);
+            uint32_t bits = (m_data[m_read_position / 8] >> offset) & ((1u << chunk) - 1);
+            value |= bits << read;
+            read += chunk;
+            m_read_position += chunk;
+        }
+        return true;
+    }
+
+    bool BitStream::readBool(bool &value)
+    {
+        uint32_t bit = 0;
+        if(!readBits(bit, 1))
+        {
+            return false;
+        }
+        value = bit != 0;
+        return true;
+    }
+
+    bool BitStream::readVarint(uint64_t &value)
+    {
+        value = 0;
+        for(unsigned int shift = 0; shift < 64; shift += 7)
+        {
+            uint32_t byte = 0;
+            if(!readBits(byte, 8))
+            {
+                return false;
+            }
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void BitStream::truncate(std::size_t bit_count)
+    {
+        if(bit_count >= m_bit_count)
+        {
+            return;
+        }
+
+        m_bit_count = bit_count;
+        m_data.resize((bit_count + 7) / 8);
+        if(bit_count % 8 != 0)
+        {
+            m_data.back() &= static_cast<uint8_t>((1u << (bit_count % 8)) - 1); // Later writes OR into this byte
+        }
+        m_read_position = std::min(m_read_position, m_bit_count);
+    }
+
+    std::size_t BitStream::getBitCount() const
+    {
+        return m_bit_count;
+    }
+
+    std::size_t BitStream::getByteCount() const
+    {
+        return m_data.size();
+    }
+
+    const uint8_t* BitStream::getData() const
+    {
+        return m_data.data();
+    }
+
+    uint32_t BitStream::quantize(float value, float min, float max, unsigned int bits)
+    {
+        double ratio = (static_cast<double>(value) - min) / (static_cast<double>(max) - min); // Float mantissa is too short for 32 bits
+        ratio = std::max(0.0, std::min(1.0, ratio));
+        return static_cast<uint32_t>(std::floor(ratio * getMaxQuantized(bits) + 0.5));
+    }
+
+    float BitStream::dequantize(uint32_t value, float min, float max, unsigned int bits)
+    {
+        return static_cast<float>(min + (static_cast<double>(max) - min) * value / getMaxQuantized(bits));
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,307 @@
+/*!
+ * @file ReplicationClient.cpp
+ * @brief Class used by spectators to mirror replicated entities.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of the receiving side of state replication. <br>
+ * The client rebuilds each snapshot from the baseline it references and acknowledges it, so that the server can send the next delta against it.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Network/ReplicationClient.h"
+
+#include <algorithm>
+
+namespace
+{
+    bool hasLowerId(const std::pair<ShadeEngine::QuantizedEntity, bool>& lhs, const std::pair<ShadeEngine::QuantizedEntity, bool>& rhs)
+    {
+        return lhs.first.id < rhs.first.id;
+    }
+}
+
+namespace ShadeEngine
+{
+    ReplicationClient::ReplicationClient() : m_connected(false), m_server_port(0), m_sequence(0), m_history(REPLICATION_HISTORY_SIZE),
+        m_history_sequences(REPLICATION_HISTORY_SIZE, 0), m_received_bytes(0)
+    {
+    }
+
+    ReplicationClient::~ReplicationClient()
+    {
+        disconnect();
+    }
+
+    bool ReplicationClient::connect(const sf::IpAddress &address, unsigned short port)
+    {
+        disconnect();
+        if(m_socket.bind(sf::Socket::AnyPort) != sf::Socket::Done)
+        {
+            return false;
+        }
+        m_socket.setBlocking(false);
+        m_connected = true;
+        m_server_address = address;
+        m_server_port = port;
+
+        m_sequence = 0;
+        std::fill(m_history_sequences.begin(), m_history_sequences.end(), 0);
+        m_entities.clear();
+        sendPacket(REPLICATION_HELLO);
+        m_receive_clock.restart();
+        return true;
+    }
+
+    void ReplicationClient::disconnect()
+    {
+        if(m_connected)
+        {
+            sendPacket(REPLICATION_BYE);
+            m_socket.unbind();
+            m_connected = false;
+        }
+    }
+
+    void ReplicationClient::update()
+    {
+        if(!m_connected)
+        {
+            return;
+        }
+
+        uint8_t buffer[REPLICATION_MAX_PACKET_SIZE];
+        std::size_t received = 0;
+        sf::IpAddress address;
+        unsigned short port = 0;
+        bool applied = false;
+        while(m_socket.receive(buffer, sizeof(buffer), received, address, port) == sf::Socket::Done)
+        {
+            if(address != m_server_address || port != m_server_port)
+            {
+                continue;
+            }
+            m_received_bytes += received;
+
+            m_stream.setData(buffer, received);
+            uint32_t protocol = 0;
+            uint32_t type = 0;
+            if(m_stream.readBits(protocol, 16) && protocol == REPLICATION_PROTOCOL_ID && m_stream.readBits(type, REPLICATION_PACKET_TYPE_BITS) &&
+               type == REPLICATION_SNAPSHOT && applySnapshot())
+            {
+                applied = true;
+            }
+        }
+
+        if(applied)
+        {
+            m_receive_clock.restart();
+            m_entities.clear();
+            const QuantizedSnapshot& latest = m_history[m_sequence % REPLICATION_HISTORY_SIZE];
+            for(QuantizedSnapshot::const_iterator it = latest.begin(); it != latest.end(); ++it)
+            {
+                m_entities[it->id] = ReplicationCodec::dequantize(*it);
+            }
+        }
+
+        else if(m_receive_clock.getElapsedTime().asSeconds() > REPLICATION_TIMEOUT)
+        {
+            // Server forgot the client or restarted: start over from a full snapshot
+            m_sequence = 0;
+            std::fill(m_history_sequences.begin(), m_history_sequences.end(), 0);
+            m_receive_clock.restart();
+            sendPacket(REPLICATION_HELLO);
+        }
+
+        if(applied || m_send_clock.getElapsedTime().asSeconds() > REPLICATION_KEEP_ALIVE_PERIOD)
+        {
+            sendPacket(m_sequence == 0 ? REPLICATION_HELLO : REPLICATION_ACK); // Hello may have been lost
+        }
+    }
+
+    const std::map<uint32_t, ReplicatedEntity>& ReplicationClient::getEntities() const
+    {
+        return m_entities;
+    }
+
+    uint32_t ReplicationClient::getSequence() const
+    {
+        return m_sequence;
+    }
+
+    uint64_t ReplicationClient::getReceivedBytes() const
+    {
+        return m_received_bytes;
+    }
+
+    bool ReplicationClient::applySnapshot()
+    {
+        uint32_t sequence = 0;
+        bool has_baseline = false;
+        uint32_t baseline_sequence = 0;
+        if(!m_stream.readBits(sequence, 32) || sequence <= m_sequence || !m_stream.readBool(has_baseline) ||
+           (has_baseline && !m_stream.readBits(baseline_sequence, 32)))
+        {
+            return false; // Malformed or older than what is displayed
+        }
+
+        const QuantizedSnapshot empty_snapshot;
+        const QuantizedSnapshot* baseline = &empty_snapshot;
+        if(has_baseline)
+        {
+            uint32_t baseline_slot = baseline_sequence % REPLICATION_HISTORY_SIZE;
+            if(m_history_sequences[baseline_slot] != baseline_sequence)
+            {
+                return false;
+            }
+            baseline = &m_history[baseline_slot];
+        }
+
+        // Read changes on top of baseline values
+        m_changes.clear();
+        bool more = false;
+        if(!m_stream.readBool(more))
+        {
+            return false;
+        }
+        while(more)
+        {
+            uint64_t id = 0;
+            bool removed = false;
+            if(!m_stream.readVarint(id) || !m_stream.readBool(removed))
+            {
+                return false;
+            }
+
+            const QuantizedEntity* known = ReplicationCodec::find(*baseline, static_cast<uint32_t>(id));
+            QuantizedEntity entity = known != NULL ? *known : ReplicationCodec::getDefault(static_cast<uint32_t>(id));
+            uint32_t fields = 0;
+            if(!removed && (!m_stream.readBits(fields, REPLICATION_FIELD_BITS) || !ReplicationCodec::readFields(m_stream, entity, fields)))
+            {
+                return false;
+            }
+            m_changes.push_back(std::make_pair(entity, removed));
+
+            if(!m_stream.readBool(more))
+            {
+                return false;
+            }
+        }
+
+        // Merge changes, written from where the server stopped last time, with baseline
+        std::sort(m_changes.begin(), m_changes.end(), hasLowerId);
+        m_snapshot.clear();
+        QuantizedSnapshot::const_iterator base_it = baseline->begin();
+        for(std::vector< std::pair<QuantizedEntity, bool> >::const_iterator it = m_changes.begin(); it != m_changes.end(); ++it)
+        {
+            while(base_it != baseline->end() && base_it->id < it->first.id)
+            {
+                m_snapshot.push_back(*base_it++);
+            }
+            if(base_it != baseline->end() && base_it->id == it->first.id)
+            {
+                ++base_it;
+            }
+            if(!it->second)
+            {
+                m_snapshot.push_back(it->first);
+            }
+        }
+        m_snapshot.insert(m_snapshot.end(), base_it, baseline->end());
+
+        uint32_t slot = sequence % REPLICATION_HISTORY_SIZE; // Differs from baseline slot as server only uses recent baselines
+        m_history[slot].swap(m_snapshot);
+        m_history_sequences[slot] = sequence;
+        m_sequence = sequence;
+        return true;
+    }
+
+    void ReplicationClient::sendPacket(ReplicationPacketType type)
+    {
+        m_stream.clear();
+        m_stream.writeBits(REPLICATION_PROTOCOL_ID, 16);
+        m_stream.writeBits(type, REPLICATION_PACKET_TYPE_BITS);
+        if(type == REPLICATION_ACK)
+        {
+            m_stream.writeBits(m_sequence, 32);
+        }
+        m_socket.send(m_stream.getData(), m_stream.getByteCount(), m_server_address, m_server_port);
+        m_send_clock.restart();
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,251 @@
+/*!
+ * @file ReplicationCodec.cpp
+ * @brief Class used to encode replicated entities.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of the quantized form of replicated entities, shared by replication servers and clients. <br>
+ * Both sides store snapshots quantized, so that deltas compare exactly the values that are sent and do not drift.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Network/ReplicationCodec.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    bool hasLowerId(const ShadeEngine::QuantizedEntity& entity, uint32_t id)
+    {
+        return entity.id < id;
+    }
+}
+
+namespace ShadeEngine
+{
+    QuantizedEntity ReplicationCodec::quantize(uint32_t id, const ReplicatedEntity &entity)
+    {
+        float rotation = std::fmod(entity.rotation, 360.f);
+        if(rotation < 0.f)
+        {
+            rotation += 360.f;
+        }
+
+        QuantizedEntity quantized;
+        quantized.id = id;
+        quantized.x = BitStream::quantize(entity.position.x, REPLICATION_POSITION_MIN, REPLICATION_POSITION_MAX, REPLICATION_POSITION_BITS);
+        quantized.y = BitStream::quantize(entity.position.y, REPLICATION_POSITION_MIN, REPLICATION_POSITION_MAX, REPLICATION_POSITION_BITS);
+        quantized.rotation = BitStream::quantize(rotation, 0.f, 360.f, REPLICATION_ROTATION_BITS);
+        quantized.sprite = entity.sprite;
+        quantized.layer = entity.layer;
+        quantized.level = entity.level;
+        quantized.xp = entity.xp;
+        return quantized;
+    }
+
+    ReplicatedEntity ReplicationCodec::dequantize(const QuantizedEntity &entity)
+    {
+        ReplicatedEntity restored;
+        restored.position.x = BitStream::dequantize(entity.x, REPLICATION_POSITION_MIN, REPLICATION_POSITION_MAX, REPLICATION_POSITION_BITS);
+        restored.position.y = BitStream::dequantize(entity.y, REPLICATION_POSITION_MIN, REPLICATION_POSITION_MAX, REPLICATION_POSITION_BITS);
+        restored.rotation = BitStream::dequantize(entity.rotation, 0.f, 360.f, REPLICATION_ROTATION_BITS);
+        restored.sprite = entity.sprite;
+        restored.layer = entity.layer;
+        restored.level = entity.level;
+        restored.xp = entity.xp;
+        return restored;
+    }
+
+    QuantizedEntity ReplicationCodec::getDefault(uint32_t id)
+    {
+        return quantize(id, ReplicatedEntity());
+    }
+
+    uint32_t ReplicationCodec::getChangedFields(const QuantizedEntity &entity, const QuantizedEntity &baseline)
+    {
+        uint32_t fields = 0;
+        if(entity.x != baseline.x || entity.y != baseline.y)
+        {
+            fields |= REPLICATION_FIELD_POSITION;
+        }
+        if(entity.rotation != baseline.rotation)
+        {
+            fields |= REPLICATION_FIELD_ROTATION;
+        }
+        if(entity.sprite != baseline.sprite)
+        {
+            fields |= REPLICATION_FIELD_SPRITE;
+        }
+        if(entity.layer != baseline.layer)
+        {
+            fields |= REPLICATION_FIELD_LAYER;
+        }
+        if(entity.level != baseline.level)
+        {
+            fields |= REPLICATION_FIELD_LEVEL;
+        }
+        if(entity.xp != baseline.xp)
+        {
+            fields |= REPLICATION_FIELD_XP;
+        }
+        return fields;
+    }
+
+    void ReplicationCodec::writeFields(BitStream &stream, const QuantizedEntity &entity, uint32_t fields)
+    {
+        if(fields & REPLICATION_FIELD_POSITION)
+        {
+            stream.writeBits(entity.x, REPLICATION_POSITION_BITS);
+            stream.writeBits(entity.y, REPLICATION_POSITION_BITS);
+        }
+        if(fields & REPLICATION_FIELD_ROTATION)
+        {
+            stream.writeBits(entity.rotation, REPLICATION_ROTATION_BITS);
+        }
+        if(fields & REPLICATION_FIELD_SPRITE)
+        {
+            stream.writeVarint(entity.sprite);
+        }
+        if(fields & REPLICATION_FIELD_LAYER)
+        {
+            stream.writeBits(entity.layer, 8);
+        }
+        if(fields & REPLICATION_FIELD_LEVEL)
+        {
+            stream.writeBits(entity.level, 8);
+        }
+        if(fields & REPLICATION_FIELD_XP)
+        {
+            stream.writeVarint(entity.xp);
+        }
+    }
+
+    bool ReplicationCodec::readFields(BitStream &stream, QuantizedEntity &entity, uint32_t fields)
+    {
+        uint32_t bits = 0;
+        uint64_t value = 0;
+        if(fields & REPLICATION_FIELD_POSITION)
+        {
+            if(!stream.readBits(entity.x, REPLICATION_POSITION_BITS) || !stream.readBits(entity.y, REPLICATION_POSITION_BITS))
+            {
+                return false;
+            }
+        }
+        if((fields & REPLICATION_FIELD_ROTATION) && !stream.readBits(entity.rotation, REPLICATION_ROTATION_BITS))
+        {
+            return false;
+        }
+        if(fields & REPLICATION_FIELD_SPRITE)
+        {
+            if(!stream.readVarint(value))
+            {
+                return false;
+            }
+            entity.sprite = static_cast<uint32_t>(value);
+        }
+        if(fields & REPLICATION_FIELD_LAYER)
+        {
+            if(!stream.readBits(bits, 8))
+            {
+                return false;
+            }
+            entity.layer = static_cast<uint8_t>(bits);
+        }
+        if(fields & REPLICATION_FIELD_LEVEL)
+        {
+            if(!stream.readBits(bits, 8))
+            {
+                return false;
+            }
+            entity.level = static_cast<uint8_t>(bits);
+        }
+        if((fields & REPLICATION_FIELD_XP) && !stream.readVarint(entity.xp))
+        {
+            return false;
+        }
+        return true;
+    }
+
+    const QuantizedEntity* ReplicationCodec::find(const QuantizedSnapshot &snapshot, uint32_t id)
+    {
+        QuantizedSnapshot::const_iterator it = std::lower_bound(snapshot.begin(), snapshot.end(), id, hasLowerId);
+        return (it != snapshot.end() && it->id == id) ? &(*it) : NULL;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,424 @@
+/*!
+ * @file ReplicationServer.cpp
+ * @brief Class used to mirror entities to spectator clients.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of the sending side of state replication. <br>
+ * Each update, the server sends every client the changes of entities since the last snapshot that client acknowledged, within a bandwidth budget.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "include/Network/ReplicationServer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const std::size_t MIN_PACKET_SIZE = 16; // Header and a few changes. Below this, wait for budget to refill
+    const float RADIANS_TO_DEGREES = 57.2957795f;
+}
+
+namespace ShadeEngine
+{
+    ReplicationServer::ReplicationServer(unsigned int bytes_per_second) : m_started(false), m_bytes_per_second(bytes_per_second), m_sent_bytes(0)
+    {
+    }
+
+    bool ReplicationServer::start(unsigned short port)
+    {
+        stop();
+        if(m_socket.bind(port) != sf::Socket::Done)
+        {
+            return false;
+        }
+        m_socket.setBlocking(false);
+        m_started = true;
+        m_clock.restart();
+        return true;
+    }
+
+    void ReplicationServer::stop()
+    {
+        if(m_started)
+        {
+            m_socket.unbind();
+            m_started = false;
+        }
+        m_clients.clear();
+    }
+
+    unsigned short ReplicationServer::getPort() const
+    {
+        return m_started ? m_socket.getLocalPort() : 0;
+    }
+
+    void ReplicationServer::setEntity(uint32_t id, const ReplicatedEntity &entity)
+    {
+        m_entities[id] = entity;
+    }
+
+    void ReplicationServer::setSceneNode(uint32_t id, const SceneGraph &scene_graph, SceneGraph::NodeId node)
+    {
+        if(!scene_graph.isValid(node))
+        {
+            return;
+        }
+
+        const sf::Transform& world_transform = scene_graph.getWorldTransform(node);
+        const float* matrix = world_transform.getMatrix(); // Column major 4x4 matrix
+        ReplicatedEntity& entity = m_entities[id];
+        entity.position = world_transform.transformPoint(scene_graph.getLocalTransformable(node).getOrigin()); // Origin of the node lands on its position
+        entity.rotation = std::atan2(matrix[1], matrix[0]) * RADIANS_TO_DEGREES;
+    }
+
+    void ReplicationServer::setCharacter(uint32_t id, const AbstractRPGCharacter &character)
+    {
+        ReplicatedEntity& entity = m_entities[id];
+        entity.level = character.getLevel();
+        entity.xp = character.getXP();
+    }
+
+    void ReplicationServer::removeEntity(uint32_t id)
+    {
+        m_entities.erase(id);
+    }
+
+    void ReplicationServer::update()
+    {
+        float elapsed = m_clock.restart().asSeconds();
+        if(!m_started)
+        {
+            return;
+        }
+
+        receivePackets(elapsed);
+
+        m_current.clear(); // Keeps capacity so that steady state updates do not allocate
+        for(std::map<uint32_t, ReplicatedEntity>::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
+        {
+            m_current.push_back(ReplicationCodec::quantize(it->first, it->second)); // Map order keeps snapshot sorted
+        }
+
+        float max_budget = std::max(static_cast<float>(REPLICATION_MAX_PACKET_SIZE), m_bytes_per_second / 4.f); // Allows short bursts only
+        for(std::vector<Client>::iterator it = m_clients.begin(); it != m_clients.end(); ++it)
+        {
+            it->budget = std::min(it->budget + m_bytes_per_second * elapsed, max_budget);
+            sendSnapshot(*it);
+        }
+    }
+
+    std::size_t ReplicationServer::getClientCount() const
+    {
+        return m_clients.size();
+    }
+
+    uint64_t ReplicationServer::getSentBytes() const
+    {
+        return m_sent_bytes;
+    }
+
+    void ReplicationServer::receivePackets(float elapsed)
+    {
+        uint8_t buffer[REPLICATION_MAX_PACKET_SIZE];
+        std::size_t received = 0;
+        sf::IpAddress address;
+        unsigned short port = 0;
+        while(m_socket.receive(buffer, sizeof(buffer), received, address, port) == sf::Socket::Done)
+        {
+            m_stream.setData(buffer, received);
+            uint32_t protocol = 0;
+            uint32_t type = 0;
+            if(!m_stream.readBits(protocol, 16) || protocol != REPLICATION_PROTOCOL_ID || !m_stream.readBits(type, REPLICATION_PACKET_TYPE_BITS))
+            {
+                continue;
+            }
+
+            uint32_t sequence = 0;
+            if(type == REPLICATION_ACK && !m_stream.readBits(sequence, 32))
+            {
+                continue;
+            }
+
+            Client* client = findClient(address, port);
+            if(client == NULL && type != REPLICATION_BYE) // Hello, or client forgotten after a timeout or a restart
+            {
+                Client new_client;
+                new_client.address = address;
+                new_client.port = port;
+                new_client.last_sequence = sequence; // Sequences go on from what client displays, otherwise it would ignore them as older
+                new_client.acked_sequence = 0;
+                new_client.next_entity = 0;
+                new_client.budget = static_cast<float>(REPLICATION_MAX_PACKET_SIZE); // First packet goes out right away
+                new_client.idle_time = 0.f;
+                new_client.silent_time = 0.f;
+                new_client.history.resize(REPLICATION_HISTORY_SIZE);
+                new_client.history_sequences.resize(REPLICATION_HISTORY_SIZE, 0);
+                m_clients.push_back(new_client);
+                continue;
+            }
+            if(client == NULL)
+            {
+                continue;
+            }
+
+            client->idle_time = 0.f;
+            if(type == REPLICATION_HELLO) // Client lost its history, next snapshot is full
+            {
+                client->acked_sequence = 0;
+            }
+            else if(type == REPLICATION_ACK && sequence > client->acked_sequence && sequence <= client->last_sequence)
+            {
+                client->acked_sequence = sequence;
+            }
+            else if(type == REPLICATION_BYE)
+            {
+                m_clients.erase(m_clients.begin() + (client - m_clients.data()));
+            }
+        }
+
+        std::vector<Client>::iterator it = m_clients.begin();
+        while(it != m_clients.end())
+        {
+            it->idle_time += elapsed;
+            it->silent_time += elapsed;
+            if(it->idle_time > REPLICATION_TIMEOUT)
+            {
+                it = m_clients.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    ReplicationServer::Client* ReplicationServer::findClient(const sf::IpAddress &address, unsigned short port)
+    {
+        for(std::vector<Client>::iterator it = m_clients.begin(); it != m_clients.end(); ++it)
+        {
+            if(it->address == address && it->port == port)
+            {
+                return &(*it);
+            }
+        }
+        return NULL;
+    }
+
+    void ReplicationServer::sendSnapshot(Client &client)
+    {
+        const QuantizedSnapshot empty_snapshot;
+        const QuantizedSnapshot* baseline = getBaseline(client);
+        const QuantizedSnapshot& base = baseline != NULL ? *baseline : empty_snapshot;
+
+        // Compare current state with baseline, both sorted by identifier
+        m_changes.clear();
+        QuantizedSnapshot::const_iterator current_it = m_current.begin();
+        QuantizedSnapshot::const_iterator base_it = base.begin();
+        while(current_it != m_current.end() || base_it != base.end())
+        {
+            Change change;
+            change.written = false;
+            if(base_it == base.end() || (current_it != m_current.end() && current_it->id < base_it->id))
+            {
+                change.id = current_it->id;
+                change.fields = ReplicationCodec::getChangedFields(*current_it, ReplicationCodec::getDefault(current_it->id)); // May be 0, entity must be created anyway
+                change.entity = &(*current_it);
+                ++current_it;
+            }
+            else if(current_it == m_current.end() || base_it->id < current_it->id)
+            {
+                change.id = base_it->id;
+                change.fields = 0;
+                change.entity = NULL;
+                ++base_it;
+            }
+            else
+            {
+                change.id = current_it->id;
+                change.fields = ReplicationCodec::getChangedFields(*current_it, *base_it);
+                change.entity = &(*current_it);
+                ++current_it;
+                ++base_it;
+                if(change.fields == 0)
+                {
+                    continue;
+                }
+            }
+            m_changes.push_back(change);
+        }
+
+        if(m_changes.empty() && baseline != NULL && client.acked_sequence == client.last_sequence && client.silent_time < REPLICATION_KEEP_ALIVE_PERIOD)
+        {
+            return; // Client is up to date. An empty snapshot is still sent now and then so that it knows the server is alive
+        }
+        std::size_t max_size = std::min(REPLICATION_MAX_PACKET_SIZE, static_cast<std::size_t>(client.budget));
+        if(max_size < MIN_PACKET_SIZE)
+        {
+            return;
+        }
+
+        // Write as many changes as fit, starting where previous packet stopped
+        uint32_t sequence = client.last_sequence + 1;
+        m_stream.clear();
+        m_stream.writeBits(REPLICATION_PROTOCOL_ID, 16);
+        m_stream.writeBits(REPLICATION_SNAPSHOT, REPLICATION_PACKET_TYPE_BITS);
+        m_stream.writeBits(sequence, 32);
+        m_stream.writeBool(baseline != NULL);
+        if(baseline != NULL)
+        {
+            m_stream.writeBits(client.acked_sequence, 32);
+        }
+
+        std::size_t first_change = 0;
+        while(first_change < m_changes.size() && m_changes[first_change].id < client.next_entity)
+        {
+            ++first_change;
+        }
+        client.next_entity = 0;
+        for(std::size_t i = 0; i < m_changes.size(); ++i)
+        {
+            Change& change = m_changes[(first_change + i) % m_changes.size()];
+            std::size_t mark = m_stream.getBitCount();
+            m_stream.writeBool(true);
+            m_stream.writeVarint(change.id);
+            m_stream.writeBool(change.entity == NULL);
+            if(change.entity != NULL)
+            {
+                m_stream.writeBits(change.fields, REPLICATION_FIELD_BITS);
+                ReplicationCodec::writeFields(m_stream, *change.entity, change.fields);
+            }
+            if((m_stream.getBitCount() + 1 + 7) / 8 > max_size) // Keeps room for the end of list bit
+            {
+                m_stream.truncate(mark);
+                client.next_entity = change.id;
+                break;
+            }
+            change.written = true;
+        }
+        m_stream.writeBool(false);
+
+        // Record what the client will know once it applies this snapshot
+        uint32_t slot = sequence % REPLICATION_HISTORY_SIZE;
+        QuantizedSnapshot& sent = client.history[slot];
+        sent.clear();
+        base_it = base.begin();
+        for(std::vector<Change>::const_iterator it = m_changes.begin(); it != m_changes.end(); ++it)
+        {
+            while(base_it != base.end() && base_it->id < it->id)
+            {
+                sent.push_back(*base_it++);
+            }
+            const QuantizedEntity* known = NULL;
+            if(base_it != base.end() && base_it->id == it->id)
+            {
+                known = &(*base_it++);
+            }
+
+            if(it->written && it->entity != NULL)
+            {
+                sent.push_back(*it->entity);
+            }
+            else if(!it->written && known != NULL)
+            {
+                sent.push_back(*known);
+            }
+        }
+        sent.insert(sent.end(), base_it, base.end());
+        client.history_sequences[slot] = sequence;
+        client.last_sequence = sequence;
+
+        m_socket.send(m_stream.getData(), m_stream.getByteCount(), client.address, client.port);
+        client.budget -= m_stream.getByteCount();
+        client.silent_time = 0.f;
+        m_sent_bytes += m_stream.getByteCount();
+    }
+
+    const QuantizedSnapshot* ReplicationServer::getBaseline(const Client &client) const
+    {
+        if(client.acked_sequence == 0 || client.last_sequence - client.acked_sequence >= REPLICATION_HISTORY_SIZE - 1)
+        {
+            return NULL; // Slot of acknowledged snapshot is about to be reused by the next one
+        }
+
+        uint32_t slot = client.acked_sequence % REPLICATION_HISTORY_SIZE;
+        return client.history_sequences[slot] == client.acked_sequence ? &client.history[slot] : NULL;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
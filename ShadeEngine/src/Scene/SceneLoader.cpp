@@ -0,0 +1,246 @@
+/*!
+ * @file SceneLoader.cpp
+ * @brief Class used to load sprite layers from binary scene files.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a loader mapping binary scene files in memory and building sprite layers directly from their records. <br>
+ * Loaded layers are emitted with a signal compatible with SpriteLayersWidget::updateLayersArray. <br>
+ * Inherits from QObject
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Scene/SceneLoader.h"
+#include "include/Core/MemoryProfiler.h"
+#include "include/Core/Tracer.h"
+#include "include/Graphics/SharedResources.h"
+
+#include <cstring>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+namespace
+{
+    /*!
+    * @brief Check that a section of records lies within the file
+    */
+    bool isSectionValid(uint64_t offset, uint64_t count, uint64_t record_size, uint64_t file_size)
+    {
+        return offset % 8 == 0 && offset <= file_size && count <= (file_size - offset) / record_size;
+    }
+}
+
+namespace ShadeEngine
+{
+    SceneLoader::SceneLoader() : QObject()
+    {
+    }
+
+    bool SceneLoader::load(const QString &path)
+    {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_RESOURCES);
+        SHADE_ENGINE_TRACE_SCOPE("SceneLoader::load");
+        QFile scene_file(path);
+        if(!scene_file.open(QIODevice::ReadOnly) || scene_file.size() < static_cast<qint64>(sizeof(SceneFileHeader)))
+        {
+            return false;
+        }
+
+        uchar* data = scene_file.map(0, scene_file.size());
+        if(data == NULL)
+        {
+            return false;
+        }
+
+        SceneFileHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if(header.magic != SCENE_FILE_MAGIC || header.version != SCENE_FILE_VERSION || !checkSections(header, scene_file.size()))
+        {
+            scene_file.unmap(data);
+            return false;
+        }
+
+        // Records are read in place from the mapping, sections being aligned on 8 bytes
+        const SceneTextureRecord* texture_records = reinterpret_cast<const SceneTextureRecord*>(data + header.textures_offset);
+        const SceneLayerRecord* layer_records = reinterpret_cast<const SceneLayerRecord*>(data + header.layers_offset);
+        const SceneSpriteRecord* sprite_records = reinterpret_cast<const SceneSpriteRecord*>(data + header.sprites_offset);
+        const SceneTilemapRecord* tilemap_records = reinterpret_cast<const SceneTilemapRecord*>(data + header.tilemaps_offset);
+        const uint16_t* tiles = reinterpret_cast<const uint16_t*>(data + header.tiles_offset);
+        const char* strings = reinterpret_cast<const char*>(data + header.strings_offset);
+
+        // Load textures relatively to scene directory, sharing those already used by other scenes or widgets
+        QDir scene_directory = QFileInfo(path).dir();
+        std::vector< std::shared_ptr<const sf::Texture> > textures;
+        textures.reserve(header.texture_count);
+        bool valid = true;
+        for(uint32_t i = 0; i < header.texture_count && valid; ++i)
+        {
+            const SceneTextureRecord& record = texture_records[i];
+            valid = static_cast<uint64_t>(record.path_offset) + record.path_length <= header.strings_size;
+            if(valid)
+            {
+                QString texture_path = scene_directory.filePath(QString::fromUtf8(strings + record.path_offset, record.path_length));
+                textures.push_back(SharedResources::getInstance().getTexture(texture_path.toStdString()));
+                valid = textures.back() != NULL;
+            }
+        }
+
+        // Build layers
+        std::vector< std::vector<sf::Sprite> > sprite_layers(header.layer_count);
+        for(uint32_t layer = 0; layer < header.layer_count && valid; ++layer)
+        {
+            const SceneLayerRecord& layer_record = layer_records[layer];
+            valid = static_cast<uint64_t>(layer_record.first_sprite) + layer_record.sprite_count <= header.sprite_count &&
+                    static_cast<uint64_t>(layer_record.first_tilemap) + layer_record.tilemap_count <= header.tilemap_count;
+            if(!valid)
+            {
+                break;
+            }
+
+            // Count sprites first so that the layer is allocated once
+            std::size_t layer_size = layer_record.sprite_count;
+            for(uint32_t t = layer_record.first_tilemap; t < layer_record.first_tilemap + layer_record.tilemap_count; ++t)
+            {
+                layer_size += static_cast<std::size_t>(tilemap_records[t].columns) * tilemap_records[t].rows;
+            }
+            std::vector<sf::Sprite>& sprites = sprite_layers[layer];
+            sprites.reserve(layer_size);
+
+            // Tilemaps are drawn below sprites
+            for(uint32_t t = layer_record.first_tilemap; t < layer_record.first_tilemap + layer_record.tilemap_count && valid; ++t)
+            {
+                const SceneTilemapRecord& tilemap = tilemap_records[t];
+                uint64_t tilemap_size = static_cast<uint64_t>(tilemap.columns) * tilemap.rows;
+                valid = tilemap.texture < textures.size() && tilemap.tileset_columns > 0 && static_cast<uint64_t>(tilemap.first_tile) + tilemap_size <= header.tile_count;
+                for(uint64_t k = 0; k < tilemap_size && valid; ++k)
+                {
+                    uint16_t tile = tiles[tilemap.first_tile + k];
+                    if(tile != SCENE_EMPTY_TILE)
+                    {
+                        sf::IntRect tile_rect((tile % tilemap.tileset_columns) * tilemap.tile_width, (tile / tilemap.tileset_columns) * tilemap.tile_height,
+                                              tilemap.tile_width, tilemap.tile_height);
+                        sprites.push_back(sf::Sprite(*textures[tilemap.texture], tile_rect));
+                        sprites.back().setPosition(tilemap.x + (k % tilemap.columns) * tilemap.tile_width, tilemap.y + (k / tilemap.columns) * tilemap.tile_height);
+                    }
+                }
+            }
+
+            for(uint32_t s = layer_record.first_sprite; s < layer_record.first_sprite + layer_record.sprite_count && valid; ++s)
+            {
+                const SceneSpriteRecord& record = sprite_records[s];
+                valid = record.texture < textures.size();
+                if(valid)
+                {
+                    sprites.push_back(sf::Sprite(*textures[record.texture]));
+                    sf::Sprite& sprite = sprites.back();
+                    if(!(record.flags & SCENE_SPRITE_FULL_TEXTURE))
+                    {
+                        sprite.setTextureRect(sf::IntRect(record.rect_left, record.rect_top, record.rect_width, record.rect_height));
+                    }
+                    sprite.setOrigin(record.origin_x, record.origin_y);
+                    sprite.setPosition(record.x, record.y);
+                    sprite.setScale(record.scale_x, record.scale_y);
+                    sprite.setRotation(record.rotation);
+                    sprite.setColor(sf::Color(record.color[0], record.color[1], record.color[2], record.color[3]));
+                }
+            }
+        }
+
+        scene_file.unmap(data);
+        if(!valid)
+        {
+            return false;
+        }
+
+        emit sceneLoaded(std::move(sprite_layers), std::move(textures));
+        return true;
+    }
+
+    bool SceneLoader::checkSections(const SceneFileHeader &header, uint64_t file_size)
+    {
+        return isSectionValid(header.textures_offset, header.texture_count, sizeof(SceneTextureRecord), file_size) &&
+               isSectionValid(header.layers_offset, header.layer_count, sizeof(SceneLayerRecord), file_size) &&
+               isSectionValid(header.sprites_offset, header.sprite_count, sizeof(SceneSpriteRecord), file_size) &&
+               isSectionValid(header.tilemaps_offset, header.tilemap_count, sizeof(SceneTilemapRecord), file_size) &&
+               isSectionValid(header.tiles_offset, header.tile_count, sizeof(uint16_t), file_size) &&
+               isSectionValid(header.strings_offset, header.strings_size, 1, file_size);
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
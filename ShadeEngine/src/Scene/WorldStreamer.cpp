@@ -0,0 +1,381 @@
+/*!
+ * @file WorldStreamer.cpp
+ * @brief Class used to stream map regions around the camera.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Implementation of a region streaming system dividing the world into a grid of cells. <br>
+ * Cells within a radius of the view are built on background threads, then attached to the layer renderer a few at a time. Distant cells are evicted when a memory budget is exceeded. <br>
+ * Inherits from QObject
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "include/Scene/WorldStreamer.h"
+#include "include/Core/MemoryProfiler.h"
+#include "include/Core/Tracer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+    const unsigned int MAX_RETRY_SHIFT = 8; // Failed cells wait at most 256 updates before being requested again
+
+    /*!
+    * @brief Get horizontal coordinate of a cell key
+    */
+    int getCellX(quint64 key)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+    }
+
+    /*!
+    * @brief Get vertical coordinate of a cell key
+    */
+    int getCellY(quint64 key)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(key & 0xFFFFFFFF));
+    }
+}
+
+namespace ShadeEngine
+{
+    WorldStreamer::WorldStreamer(const sf::Vector2f &cell_size, CellBuilder builder, unsigned int worker_count) : WorldStreamer(cell_size, builder, NULL, worker_count)
+    {
+    }
+
+    WorldStreamer::WorldStreamer(const sf::Vector2f &cell_size, CellBuilder builder, JobSystem &jobs) : WorldStreamer(cell_size, builder, &jobs, 0)
+    {
+    }
+
+    WorldStreamer::WorldStreamer(const sf::Vector2f &cell_size, CellBuilder builder, JobSystem *jobs, unsigned int worker_count) : QObject(), m_cell_size(cell_size),
+        m_builder(builder), m_load_radius(2.f * std::max(cell_size.x, cell_size.y)), m_memory_budget(64 * 1024 * 1024), m_max_attachments(2),
+        m_loaded_memory(0), m_view_center(0.f, 0.f), m_update_count(0), m_stopping(false), m_jobs(jobs)
+    {
+        for(unsigned int i = 0; jobs == NULL && i < std::max(1u, worker_count); ++i)
+        {
+            m_workers.push_back(std::thread(&WorldStreamer::workerLoop, this));
+        }
+    }
+
+    WorldStreamer::~WorldStreamer()
+    {
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+            m_stopping = true;
+        }
+        m_queue_condition.notify_all();
+        for(std::vector<std::thread>::iterator worker_it = m_workers.begin(); worker_it != m_workers.end(); ++worker_it)
+        {
+            worker_it->join();
+        }
+        if(m_jobs != NULL) // Jobs not started return right away
+        {
+            m_jobs->wait(m_build_jobs);
+        }
+    }
+
+    void WorldStreamer::setLoadRadius(float radius)
+    {
+        m_load_radius = radius;
+    }
+
+    void WorldStreamer::setMemoryBudget(std::size_t bytes)
+    {
+        m_memory_budget = bytes;
+    }
+
+    void WorldStreamer::setMaxAttachmentsPerUpdate(unsigned int count)
+    {
+        m_max_attachments = std::max(1u, count);
+    }
+
+    std::size_t WorldStreamer::getLoadedMemory() const
+    {
+        return m_loaded_memory;
+    }
+
+    quint64 WorldStreamer::getCellKey(int cell_x, int cell_y)
+    {
+        return (static_cast<quint64>(static_cast<uint32_t>(cell_x)) << 32) | static_cast<uint32_t>(cell_y);
+    }
+
+    void WorldStreamer::update(const sf::Vector2f &view_center)
+    {
+        m_view_center = view_center;
+        ++m_update_count;
+
+        // Forget failures of cells that left load radius, they get a fresh start when they come back
+        for(std::unordered_map<quint64, FailedCell>::iterator failed_it = m_failed_cells.begin(); failed_it != m_failed_cells.end();)
+        {
+            if(!isWanted(failed_it->first))
+            {
+                failed_it = m_failed_cells.erase(failed_it);
+            }
+            else
+            {
+                ++failed_it;
+            }
+        }
+
+        // Request missing cells within load radius
+        int min_x = static_cast<int>(std::floor((view_center.x - m_load_radius) / m_cell_size.x));
+        int max_x = static_cast<int>(std::floor((view_center.x + m_load_radius) / m_cell_size.x));
+        int min_y = static_cast<int>(std::floor((view_center.y - m_load_radius) / m_cell_size.y));
+        int max_y = static_cast<int>(std::floor((view_center.y + m_load_radius) / m_cell_size.y));
+        std::vector<quint64> new_requests;
+        for(int y = min_y; y <= max_y; ++y)
+        {
+            for(int x = min_x; x <= max_x; ++x)
+            {
+                quint64 key = getCellKey(x, y);
+                std::unordered_map<quint64, FailedCell>::const_iterator failed_it = m_failed_cells.find(key);
+                bool waiting_retry = failed_it != m_failed_cells.end() && failed_it->second.retry_update > m_update_count;
+                if(isWanted(key) && !waiting_retry && m_cells.find(key) == m_cells.end())
+                {
+                    CellState state = {CELL_REQUESTED, 0};
+                    m_cells[key] = state;
+                    new_requests.push_back(key);
+                }
+            }
+        }
+
+        // Update request queue and take built cells
+        std::vector<BuiltCell> built_cells;
+        {
+            std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+            for(std::deque<quint64>::iterator request_it = m_requests.begin(); request_it != m_requests.end();) // Cancel requests not started that left load radius
+            {
+                if(!isWanted(*request_it))
+                {
+                    m_cells.erase(*request_it);
+                    request_it = m_requests.erase(request_it);
+                }
+                else
+                {
+                    ++request_it;
+                }
+            }
+            m_requests.insert(m_requests.end(), new_requests.begin(), new_requests.end());
+            std::sort(m_requests.begin(), m_requests.end(), [this](quint64 a, quint64 b) { return getSquaredDistance(a) < getSquaredDistance(b); }); // Nearest cells first
+
+            while(!m_built_cells.empty() && built_cells.size() < m_max_attachments)
+            {
+                built_cells.push_back(std::move(m_built_cells.front()));
+                m_built_cells.pop_front();
+            }
+        }
+        if(m_jobs != NULL)
+        {
+            // One job per request, each one builds the nearest cell left when it starts. Jobs of cancelled requests find the queue empty
+            for(std::size_t i = 0; i < new_requests.size(); ++i)
+            {
+                m_jobs->submit([this]()
+                {
+                    quint64 key;
+                    {
+                        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+                        if(m_stopping || m_requests.empty())
+                        {
+                            return;
+                        }
+                        key = m_requests.front();
+                        m_requests.pop_front();
+                    }
+                    buildCell(key);
+                }, &m_build_jobs);
+            }
+        }
+        else if(!new_requests.empty())
+        {
+            m_queue_condition.notify_all();
+        }
+
+        // Attach built cells still wanted
+        for(std::vector<BuiltCell>::iterator cell_it = built_cells.begin(); cell_it != built_cells.end(); ++cell_it)
+        {
+            std::unordered_map<quint64, CellState>::iterator state_it = m_cells.find(cell_it->key);
+            if(state_it == m_cells.end())
+            {
+                continue;
+            }
+            if(!isWanted(cell_it->key)) // Left load radius while being built
+            {
+                m_cells.erase(state_it);
+                continue;
+            }
+            if(!cell_it->valid) // Requested again once its retry delay is over
+            {
+                m_cells.erase(state_it);
+                FailedCell& failed = m_failed_cells[cell_it->key]; // Zero initialized on first failure
+                failed.retry_update = m_update_count + (1ull << std::min(++failed.attempts, MAX_RETRY_SHIFT));
+                continue;
+            }
+            m_failed_cells.erase(cell_it->key);
+
+            state_it->second.status = CELL_LOADED;
+            state_it->second.memory = estimateMemory(cell_it->layers);
+            m_loaded_memory += state_it->second.memory;
+            emit chunkReady(cell_it->key, std::move(cell_it->layers));
+        }
+
+        // Evict farthest cells out of load radius while over budget
+        if(m_loaded_memory > m_memory_budget)
+        {
+            std::vector< std::pair<float, quint64> > candidates;
+            for(std::unordered_map<quint64, CellState>::const_iterator state_it = m_cells.begin(); state_it != m_cells.end(); ++state_it)
+            {
+                if(state_it->second.status == CELL_LOADED && !isWanted(state_it->first))
+                {
+                    candidates.push_back(std::make_pair(getSquaredDistance(state_it->first), state_it->first));
+                }
+            }
+            std::sort(candidates.begin(), candidates.end());
+            for(std::vector< std::pair<float, quint64> >::reverse_iterator candidate_it = candidates.rbegin(); candidate_it != candidates.rend() && m_loaded_memory > m_memory_budget; ++candidate_it)
+            {
+                m_loaded_memory -= m_cells[candidate_it->second].memory;
+                m_cells.erase(candidate_it->second);
+                emit chunkEvicted(candidate_it->second);
+            }
+        }
+    }
+
+    void WorldStreamer::workerLoop()
+    {
+        Tracer::setThreadName("WorldStreamer worker");
+        while(true)
+        {
+            quint64 key;
+            {
+                std::unique_lock<std::mutex> mutex_lock(m_queue_mutex);
+                m_queue_condition.wait(mutex_lock, [this]() { return m_stopping || !m_requests.empty(); });
+                if(m_stopping)
+                {
+                    return;
+                }
+                key = m_requests.front();
+                m_requests.pop_front();
+            }
+            buildCell(key);
+        }
+    }
+
+    void WorldStreamer::buildCell(quint64 key)
+    {
+        BuiltCell cell;
+        cell.key = key;
+        {
+            SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_SCENE_UPDATE);
+            SHADE_ENGINE_TRACE_SCOPE("WorldStreamer::buildCell");
+            cell.valid = m_builder(getCellX(cell.key), getCellY(cell.key), cell.layers); // Built without holding the lock
+        }
+
+        std::unique_lock<std::mutex>  __attribute__((unused))mutex_lock(m_queue_mutex);
+        m_built_cells.push_back(std::move(cell));
+    }
+
+    bool WorldStreamer::isWanted(quint64 key) const
+    {
+        // Distance between view center and closest point of the cell
+        float left = getCellX(key) * m_cell_size.x;
+        float top = getCellY(key) * m_cell_size.y;
+        float dx = std::max(0.f, std::max(left - m_view_center.x, m_view_center.x - (left + m_cell_size.x)));
+        float dy = std::max(0.f, std::max(top - m_view_center.y, m_view_center.y - (top + m_cell_size.y)));
+        return dx * dx + dy * dy <= m_load_radius * m_load_radius;
+    }
+
+    float WorldStreamer::getSquaredDistance(quint64 key) const
+    {
+        float dx = (getCellX(key) + 0.5f) * m_cell_size.x - m_view_center.x;
+        float dy = (getCellY(key) + 0.5f) * m_cell_size.y - m_view_center.y;
+        return dx * dx + dy * dy;
+    }
+
+    std::size_t WorldStreamer::estimateMemory(const std::vector<std::vector<sf::Sprite> > &layers)
+    {
+        std::size_t memory = sizeof(layers) + layers.capacity() * sizeof(std::vector<sf::Sprite>);
+        for(std::vector< std::vector<sf::Sprite> >::const_iterator layer_it = layers.begin(); layer_it != layers.end(); ++layer_it)
+        {
+            memory += layer_it->capacity() * sizeof(sf::Sprite);
+        }
+        return memory;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
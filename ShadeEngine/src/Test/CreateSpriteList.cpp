@@ -1,4 +1,6 @@
 #include "include/Test/CreateSpriteList.h"
+#include "include/Core/MemoryProfiler.h"
+#include "include/Graphics/SharedResources.h"
 
 namespace ShadeEngine
 {
@@ -15,6 +17,7 @@ namespace ShadeEngine
 
     void CreateSpriteList::generateList()
     {
+        SHADE_ENGINE_MEMORY_SCOPE(MEMORY_TAG_SCENE_UPDATE);
         m_sprite_layers.clear();
         switch(m_mode)
         {
@@ -47,17 +50,14 @@ namespace ShadeEngine
 
     void CreateSpriteList::loadTextures()
     {
-        sf::Texture text1;
-        text1.loadFromFile("/home/signcodingdwarf/Documents/git/ShadeEngine/ShadeEngine/resources/ShadowS.png");
-        m_textures_list.push_back(text1);
-
-        sf::Texture text2;
-        text2.loadFromFile("/home/signcodingdwarf/Documents/git/ShadeEngine/ShadeEngine/resources/Qt.png");
-        m_textures_list.push_back(text2);
-
-        sf::Texture text3;
-        text3.loadFromFile("/home/signcodingdwarf/Documents/git/ShadeEngine/ShadeEngine/resources/SFML.png");
-        m_textures_list.push_back(text3);
+        const char* paths[] = {"/home/signcodingdwarf/Documents/git/ShadeEngine/ShadeEngine/resources/ShadowS.png",
+                               "/home/signcodingdwarf/Documents/git/ShadeEngine/ShadeEngine/resources/Qt.png",
+                               "/home/signcodingdwarf/Documents/git/ShadeEngine/ShadeEngine/resources/SFML.png"};
+        for(unsigned int i = 0; i < 3; ++i)
+        {
+            std::shared_ptr<const sf::Texture> texture = SharedResources::getInstance().getTexture(paths[i]); // Shared with other widgets using the same file
+            m_textures_list.push_back(texture != NULL ? texture : std::make_shared<const sf::Texture>()); // Empty texture if file is missing
+        }
     }
 
     void CreateSpriteList::mode1()
@@ -65,12 +65,12 @@ namespace ShadeEngine
         std::vector<sf::Sprite> layer1;
 
         sf::Sprite sp1;
-        sp1.setTexture(m_textures_list[0]);
+        sp1.setTexture(*m_textures_list[0]);
         sp1.setPosition(25,10);
         sp1.setScale(sf::Vector2f(0.417,0.417));
         layer1.push_back(sp1);
 
-        m_sprite_layers.push_back(layer1);
+        m_sprite_layers.push_back(std::move(layer1)); // Layer is not used afterwards, avoid copying its sprites
     }
 
     void CreateSpriteList::mode2()
@@ -78,19 +78,19 @@ namespace ShadeEngine
         std::vector<sf::Sprite> layer1;
 
         sf::Sprite sp1;
-        sp1.setTexture(m_textures_list[0]);
+        sp1.setTexture(*m_textures_list[0]);
         sp1.setPosition(25,10);
         sp1.setScale(sf::Vector2f(0.417,0.417));
         layer1.push_back(sp1);
 
         sf::Sprite sp2;
-        sp2.setTexture(m_textures_list[2]);
+        sp2.setTexture(*m_textures_list[2]);
         sp2.setPosition(25,300);
         sp2.setScale(sf::Vector2f(0.333,0.333));
         layer1.push_back(sp2);
 
 
-        m_sprite_layers.push_back(layer1);
+        m_sprite_layers.push_back(std::move(layer1));
     }
 
     void CreateSpriteList::mode3()
@@ -100,13 +100,13 @@ namespace ShadeEngine
         std::vector<sf::Sprite> layer2;
 
         sf::Sprite sp1;
-        sp1.setTexture(m_textures_list[0]);
+        sp1.setTexture(*m_textures_list[0]);
         sp1.setPosition(0,100);
         sp1.setScale(sf::Vector2f(0.500,0.500));
         sp1.setColor(sf::Color(255,0,0,180));
         layer2.push_back(sp1);
 
-        m_sprite_layers.push_back(layer2);
+        m_sprite_layers.push_back(std::move(layer2));
     }
 
     void CreateSpriteList::mode4()
@@ -116,23 +116,23 @@ namespace ShadeEngine
         std::vector<sf::Sprite> layer3;
 
         sf::Sprite sp1;
-        sp1.setTexture(m_textures_list[1]);
+        sp1.setTexture(*m_textures_list[1]);
         sp1.setPosition(0,340);
         sp1.setScale(sf::Vector2f(0.125,0.125));
         layer3.push_back(sp1);
 
         sf::Sprite sp2;
-        sp2.setTexture(m_textures_list[1]);
+        sp2.setTexture(*m_textures_list[1]);
         sp2.setPosition(300,0);
         sp2.setScale(sf::Vector2f(0.125,0.125));
         layer3.push_back(sp2);
 
         sf::Sprite sp3;
-        sp3.setTexture(m_textures_list[1]);
+        sp3.setTexture(*m_textures_list[1]);
         sp3.setPosition(150,170);
         sp3.setScale(sf::Vector2f(0.125,0.125));
         layer3.push_back(sp3);
 
-        m_sprite_layers.push_back(layer3);
+        m_sprite_layers.push_back(std::move(layer3));
     }
 }
@@ -0,0 +1,46 @@
+#-------------------------------------------------
+#
+# Headless replay of render captures recorded by SpriteLayersWidget
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = RenderReplay
+TEMPLATE = app
+CONFIG += console release
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp \
+    ../../src/Graphics/SpriteLayersRenderer.cpp \
+    ../../src/Graphics/SceneGraph.cpp \
+    ../../src/Graphics/SpriteBatch.cpp \
+    ../../src/Graphics/Camera.cpp \
+    ../../src/Graphics/LightMap.cpp \
+    ../../src/Graphics/SharedResources.cpp \
+    ../../src/Graphics/AlphaMask.cpp \
+    ../../src/Core/FrameArena.cpp \
+    ../../src/Core/LatencyHistogram.cpp \
+    ../../src/Core/MemoryProfiler.cpp
+
+HEADERS += \
+    ../../include/Graphics/RenderCaptureFormat.h \
+    ../../include/Graphics/SpriteLayersRenderer.h \
+    ../../include/Graphics/SceneGraph.h \
+    ../../include/Graphics/SpriteBatch.h \
+    ../../include/Graphics/Camera.h \
+    ../../include/Graphics/LightMap.h \
+    ../../include/Graphics/SharedResources.h \
+    ../../include/Graphics/AlphaMask.h \
+    ../../include/Core/FrameArena.h \
+    ../../include/Core/ArenaAllocator.h \
+    ../../include/Core/LatencyHistogram.h \
+    ../../include/Core/MemoryProfiler.h
+
+LIBS += -lsfml-graphics -lsfml-window -lsfml-system
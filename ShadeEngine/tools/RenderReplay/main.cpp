@@ -0,0 +1,472 @@
+/*!
+ * @file main.cpp
+ * @brief Headless replay of render captures.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Usage : RenderReplay <capture> [repetitions] <br>
+ * Feeds the scene updates and frames recorded by SpriteLayersWidget::startRecording to a SpriteLayersRenderer drawing into an off-screen render texture, as fast as possible. <br>
+ * Reports the distribution of frame rendering times and the number of draw calls per frame, so that renderer changes can be compared on identical workloads.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <QFile>
+#include <SFML/Graphics.hpp>
+
+#include "include/Core/FrameArena.h"
+#include "include/Core/LatencyHistogram.h"
+#include "include/Graphics/RenderCaptureFormat.h"
+#include "include/Graphics/SharedResources.h"
+#include "include/Graphics/SpriteLayersRenderer.h"
+
+using namespace ShadeEngine;
+
+namespace
+{
+    typedef std::vector< std::shared_ptr<const sf::Texture> > TextureList; /*!< Textures indexed by capture identifier. */
+    typedef std::vector< std::vector<sf::Sprite> > SpriteLayers; /*!< Array of sprite vectors, one per layer. */
+
+    /*!
+    * @brief Sprite of a scene graph node with its whole transform
+    */
+    struct OverlaySprite
+    {
+        sf::Sprite sprite; /*!< Sprite without transform. */
+        sf::Transform transform; /*!< Transform combining node and sprite transforms. */
+    };
+
+    /*!
+    * @brief Renderer drawing recorded scene graph sprites instead of a scene graph
+    */
+    class ReplayRenderer : public SpriteLayersRenderer
+    {
+    public:
+        /*!
+        * @brief Remove overlay sprites of previous frame
+        */
+        void clearOverlays()
+        {
+            for(std::vector< std::vector<OverlaySprite> >::iterator layer_it = m_overlays.begin(); layer_it != m_overlays.end(); ++layer_it)
+            {
+                layer_it->clear(); // Keeps capacity
+            }
+        }
+
+        /*!
+        * @brief Add an overlay sprite to current frame
+        */
+        void addOverlay(std::size_t layer, const OverlaySprite& overlay)
+        {
+            if(layer >= m_overlays.size())
+            {
+                m_overlays.resize(layer + 1);
+            }
+            m_overlays[layer].push_back(overlay);
+        }
+
+        /*!
+        * @brief Get number of draw calls issued by the sprite batch
+        */
+        std::size_t getDrawCallCount() const
+        {
+            return m_sprite_batch.getDrawCallCount();
+        }
+
+        /*!
+        * @brief Get number of layers, including layers only used by overlay sprites
+        */
+        virtual std::size_t getLayerCount() const
+        {
+            return std::max(SpriteLayersRenderer::getLayerCount(), m_overlays.size());
+        }
+
+    protected:
+        std::vector< std::vector<OverlaySprite> > m_overlays; /*!< Overlay sprites of current frame by layer. */
+
+        /*!
+        * @brief Draw overlay sprites of a layer
+        */
+        virtual void drawLayerOverlay(sf::RenderTarget& target, std::size_t layer)
+        {
+            if(layer < m_overlays.size())
+            {
+                for(std::vector<OverlaySprite>::const_iterator overlay_it = m_overlays[layer].begin(); overlay_it != m_overlays[layer].end(); ++overlay_it)
+                {
+                    m_sprite_batch.draw(target, overlay_it->sprite, overlay_it->transform);
+                }
+                m_sprite_batch.flush(target);
+            }
+        }
+    };
+
+    /*!
+    * @brief Sequential reader of capture payloads
+    */
+    struct CaptureReader
+    {
+        const uchar* data; /*!< Current position. */
+        const uchar* end; /*!< End of data. */
+
+        /*!
+        * @brief Copy bytes and advance, false if data is too short
+        */
+        bool read(void* destination, std::size_t size)
+        {
+            if(static_cast<std::size_t>(end - data) < size)
+            {
+                return false;
+            }
+            std::memcpy(destination, data, size);
+            data += size;
+            return true;
+        }
+    };
+
+    /*!
+    * @brief Build a sprite from its capture record
+    */
+    void setSpriteAppearance(sf::Sprite& sprite, uint32_t texture, const int32_t rect[4], uint32_t color, const TextureList& textures)
+    {
+        if(texture < textures.size() && textures[texture] != NULL)
+        {
+            sprite.setTexture(*textures[texture]);
+        }
+        sprite.setTextureRect(sf::IntRect(rect[0], rect[1], rect[2], rect[3]));
+        sprite.setColor(sf::Color(color));
+    }
+
+    /*!
+    * @brief Decode a sprite layers payload
+    */
+    bool readLayers(CaptureReader& reader, const TextureList& textures, SpriteLayers& layers)
+    {
+        uint32_t layer_count = 0;
+        if(!reader.read(&layer_count, sizeof(layer_count)))
+        {
+            return false;
+        }
+        layers.resize(layer_count);
+        for(uint32_t layer = 0; layer < layer_count; ++layer)
+        {
+            uint32_t sprite_count = 0;
+            if(!reader.read(&sprite_count, sizeof(sprite_count)) || static_cast<std::size_t>(reader.end - reader.data) / sizeof(CaptureSpriteRecord) < sprite_count)
+            {
+                return false;
+            }
+            layers[layer].resize(sprite_count);
+            for(uint32_t i = 0; i < sprite_count; ++i)
+            {
+                CaptureSpriteRecord record;
+                reader.read(&record, sizeof(record));
+                sf::Sprite& sprite = layers[layer][i];
+                setSpriteAppearance(sprite, record.texture, record.rect, record.color, textures);
+                sprite.setPosition(record.position[0], record.position[1]);
+                sprite.setOrigin(record.origin[0], record.origin[1]);
+                sprite.setScale(record.scale[0], record.scale[1]);
+                sprite.setRotation(record.rotation);
+            }
+        }
+        return true;
+    }
+
+    /*!
+    * @brief Load a texture declared in the capture
+    *
+    * Textures unknown to SharedResources or missing on disk are replaced by a white texture of the same size, which keeps the workload close.
+    */
+    bool readTexture(CaptureReader& reader, TextureList& textures)
+    {
+        CaptureTextureRecord record;
+        if(!reader.read(&record, sizeof(record)) || static_cast<std::size_t>(reader.end - reader.data) < record.key_length || record.id >= RENDER_CAPTURE_NO_TEXTURE)
+        {
+            return false;
+        }
+        std::string key(reinterpret_cast<const char*>(reader.data), record.key_length);
+        reader.data += record.key_length;
+
+        std::shared_ptr<const sf::Texture> texture = key.empty() ? std::shared_ptr<const sf::Texture>() : SharedResources::getInstance().getTexture(key);
+        if(texture == NULL)
+        {
+            sf::Image image;
+            image.create(std::max(1u, record.width), std::max(1u, record.height), sf::Color::White);
+            std::shared_ptr<sf::Texture> placeholder(new sf::Texture());
+            placeholder->loadFromImage(image);
+            texture = placeholder;
+        }
+
+        if(record.id >= textures.size())
+        {
+            textures.resize(record.id + 1);
+        }
+        textures[record.id] = texture;
+        return true;
+    }
+
+    /*!
+    * @brief Apply a frame record and render the frame
+    */
+    bool renderFrame(CaptureReader& reader, const TextureList& textures, ReplayRenderer& renderer, sf::RenderTexture& target, FrameArena& arena,
+                     LatencyHistogram& frame_times)
+    {
+        CaptureFrameRecord frame;
+        if(!reader.read(&frame, sizeof(frame)) || frame.width == 0 || frame.height == 0)
+        {
+            return false;
+        }
+
+        // Camera state
+        Camera& camera = renderer.getCamera();
+        if(frame.positioned)
+        {
+            camera.setCenter(sf::Vector2f(frame.center[0], frame.center[1]));
+        }
+        camera.setZoom(frame.zoom);
+        camera.setPixelSnapping(frame.pixel_snapping != 0);
+        for(uint32_t layer = 0; layer < frame.parallax_count; ++layer)
+        {
+            float parallax = 1.f;
+            if(!reader.read(&parallax, sizeof(parallax)))
+            {
+                return false;
+            }
+            camera.setLayerParallax(layer, parallax);
+        }
+
+        // Scene graph sprites
+        renderer.clearOverlays();
+        for(uint32_t i = 0; i < frame.overlay_sprite_count; ++i)
+        {
+            CaptureOverlaySpriteRecord record;
+            if(!reader.read(&record, sizeof(record)))
+            {
+                return false;
+            }
+            OverlaySprite overlay;
+            setSpriteAppearance(overlay.sprite, record.texture, record.rect, record.color, textures);
+            overlay.transform = sf::Transform(record.transform[0], record.transform[1], record.transform[2],
+                                              record.transform[3], record.transform[4], record.transform[5],
+                                              0.f, 0.f, 1.f);
+            renderer.addOverlay(record.layer, overlay);
+        }
+
+        if(target.getSize().x != frame.width || target.getSize().y != frame.height)
+        {
+            target.create(frame.width, frame.height);
+        }
+
+        // Only rendering is timed
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        target.clear();
+        renderer.render(target, arena, 0.f);
+        target.display();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        frame_times.record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        arena.reset();
+        return true;
+    }
+
+    /*!
+    * @brief Replay every record of a capture once
+    */
+    bool replay(const uchar* data, qint64 size, sf::RenderTexture& target, LatencyHistogram& frame_times, std::size_t& draw_call_count)
+    {
+        CaptureReader reader = {data + sizeof(RenderCaptureHeader), data + size};
+        ReplayRenderer renderer;
+        FrameArena arena;
+        TextureList textures;
+
+        RenderCaptureRecordHeader header;
+        while(reader.read(&header, sizeof(header)))
+        {
+            if(static_cast<std::size_t>(reader.end - reader.data) < header.size)
+            {
+                std::cerr << "truncated record" << std::endl;
+                return false;
+            }
+            CaptureReader payload = {reader.data, reader.data + header.size};
+            reader.data += header.size;
+
+            bool valid = true;
+            SpriteLayers layers;
+            uint64_t key = 0;
+            uint32_t sort_mode[2] = {0, 0};
+            switch(header.type)
+            {
+            case CAPTURE_TEXTURE:
+                valid = readTexture(payload, textures);
+                break;
+            case CAPTURE_LAYERS:
+                valid = readLayers(payload, textures, layers);
+                renderer.swapLayers(layers);
+                break;
+            case CAPTURE_CHUNK_ATTACH:
+                valid = payload.read(&key, sizeof(key)) && readLayers(payload, textures, layers);
+                if(valid)
+                {
+                    renderer.attachChunk(key, layers);
+                }
+                break;
+            case CAPTURE_CHUNK_DETACH:
+                valid = payload.read(&key, sizeof(key));
+                if(valid)
+                {
+                    renderer.detachChunk(key, layers);
+                }
+                break;
+            case CAPTURE_SORT_MODE:
+                valid = payload.read(sort_mode, sizeof(sort_mode));
+                if(valid)
+                {
+                    renderer.setLayerSortMode(sort_mode[0], sort_mode[1] == Y_SORT ? Y_SORT : DRAW_ORDER);
+                }
+                break;
+            case CAPTURE_FRAME:
+                valid = renderFrame(payload, textures, renderer, target, arena, frame_times);
+                break;
+            default: // Records of newer versions are skipped
+                break;
+            }
+
+            if(!valid)
+            {
+                std::cerr << "invalid record of type " << header.type << std::endl;
+                return false;
+            }
+        }
+        draw_call_count += renderer.getDrawCallCount();
+        return true;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2 || argc > 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <capture> [repetitions]" << std::endl;
+        return 1;
+    }
+    unsigned int repetitions = argc == 3 ? static_cast<unsigned int>(std::max(1, std::atoi(argv[2]))) : 1;
+
+    QFile capture_file(argv[1]);
+    if(!capture_file.open(QIODevice::ReadOnly) || capture_file.size() < static_cast<qint64>(sizeof(RenderCaptureHeader)))
+    {
+        std::cerr << "cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+    const uchar* data = capture_file.map(0, capture_file.size());
+    if(data == NULL)
+    {
+        std::cerr << "cannot map " << argv[1] << std::endl;
+        return 1;
+    }
+    RenderCaptureHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if(header.magic != RENDER_CAPTURE_MAGIC || header.version != RENDER_CAPTURE_VERSION)
+    {
+        std::cerr << argv[1] << " is not a supported render capture" << std::endl;
+        return 1;
+    }
+
+    sf::RenderTexture target;
+    LatencyHistogram frame_times;
+    std::size_t draw_call_count = 0;
+    for(unsigned int i = 0; i < repetitions; ++i)
+    {
+        if(!replay(data, capture_file.size(), target, frame_times, draw_call_count))
+        {
+            SharedResources::getInstance().releaseAll();
+            return 1;
+        }
+    }
+    SharedResources::getInstance().releaseAll(); // Cached textures must not outlive SFML
+
+    uint64_t frame_count = frame_times.getCount();
+    std::cout << frame_count << " frames replayed, " << (frame_count > 0 ? static_cast<double>(draw_call_count) / frame_count : 0.) << " draw calls per frame" << std::endl;
+    frame_times.dump(std::cout);
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
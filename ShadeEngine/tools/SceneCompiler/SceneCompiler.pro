@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Converter of text scene descriptions into binary scene files
+#
+#-------------------------------------------------
+
+QT       -= core gui
+
+TARGET = SceneCompiler
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp
+
+HEADERS += \
+    ../../include/Scene/SceneFormat.h
@@ -0,0 +1,416 @@
+/*!
+ * @file main.cpp
+ * @brief Converter of text scene descriptions into binary scene files.
+ * @author SignC0dingDw@rf
+ * @date 18 October 2026
+ *
+ * Usage : SceneCompiler <input.scene.txt> <output.scene> <br>
+ * The text format is line based. Empty lines and lines starting with # are ignored. <br>
+ * - texture <path> : declares a texture, referenced by its declaration index. Path is relative to the binary scene file. <br>
+ * - layer : starts a new layer. Sprites declared before the first layer statement go to layer 0. <br>
+ * - sprite <texture> <x> <y> [scale <sx> <sy>] [rotation <degrees>] [origin <ox> <oy>] [rect <left> <top> <width> <height>] [color <r> <g> <b> <a>] : adds a sprite to current layer. <br>
+ * - tilemap <texture> <x> <y> <tile_width> <tile_height> <columns> <rows> <tileset_columns> : adds a tilemap to current layer. <br>
+ *   It must be followed by <rows> lines of <columns> tile indexes, -1 meaning empty tile.
+ *
+ */
+
+/*
+Copyright (c) 2018 SignC0dingDw@rf. All rights reserved
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Copywrong (w) 2018 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "include/Scene/SceneFormat.h"
+
+using namespace ShadeEngine;
+
+namespace
+{
+    /*!
+    * @brief Content of a scene being compiled
+    */
+    struct Scene
+    {
+        std::vector<std::string> texture_paths; /*!< Paths of declared textures. */
+        std::vector<SceneLayerRecord> layers; /*!< Layers. Sprites and tilemaps are stored layer by layer. */
+        std::vector<SceneSpriteRecord> sprites; /*!< Sprites of all layers. */
+        std::vector<SceneTilemapRecord> tilemaps; /*!< Tilemaps of all layers. */
+        std::vector<uint16_t> tiles; /*!< Tiles of all tilemaps. */
+    };
+
+    /*!
+    * @brief Print a parsing error
+    */
+    bool parseError(unsigned int line_number, const std::string& message)
+    {
+        std::cerr << "line " << line_number << ": " << message << std::endl;
+        return false;
+    }
+
+    /*!
+    * @brief Get current layer, creating layer 0 if none exists
+    */
+    SceneLayerRecord& currentLayer(Scene& scene)
+    {
+        if(scene.layers.empty())
+        {
+            SceneLayerRecord layer;
+            std::memset(&layer, 0, sizeof(layer));
+            scene.layers.push_back(layer);
+        }
+        return scene.layers.back();
+    }
+
+    /*!
+    * @brief Parse a sprite statement
+    */
+    bool parseSprite(std::istringstream& arguments, Scene& scene, unsigned int line_number)
+    {
+        SceneSpriteRecord sprite;
+        std::memset(&sprite, 0, sizeof(sprite));
+        sprite.scale_x = 1.f;
+        sprite.scale_y = 1.f;
+        std::memset(sprite.color, 255, sizeof(sprite.color));
+        sprite.flags = SCENE_SPRITE_FULL_TEXTURE;
+
+        unsigned int texture = 0;
+        if(!(arguments >> texture >> sprite.x >> sprite.y))
+        {
+            return parseError(line_number, "expected sprite <texture> <x> <y>");
+        }
+        if(texture >= scene.texture_paths.size())
+        {
+            return parseError(line_number, "undeclared texture");
+        }
+        sprite.texture = static_cast<uint16_t>(texture);
+
+        std::string option;
+        while(arguments >> option)
+        {
+            bool valid = true;
+            if(option == "scale")
+            {
+                valid = static_cast<bool>(arguments >> sprite.scale_x >> sprite.scale_y);
+            }
+            else if(option == "rotation")
+            {
+                valid = static_cast<bool>(arguments >> sprite.rotation);
+            }
+            else if(option == "origin")
+            {
+                valid = static_cast<bool>(arguments >> sprite.origin_x >> sprite.origin_y);
+            }
+            else if(option == "rect")
+            {
+                valid = static_cast<bool>(arguments >> sprite.rect_left >> sprite.rect_top >> sprite.rect_width >> sprite.rect_height);
+                sprite.flags &= ~SCENE_SPRITE_FULL_TEXTURE;
+            }
+            else if(option == "color")
+            {
+                unsigned int components[4];
+                valid = static_cast<bool>(arguments >> components[0] >> components[1] >> components[2] >> components[3]);
+                for(unsigned int c = 0; c < 4; ++c)
+                {
+                    sprite.color[c] = static_cast<uint8_t>(components[c] > 255 ? 255 : components[c]);
+                }
+            }
+            else
+            {
+                return parseError(line_number, "unknown sprite option " + option);
+            }
+            if(!valid)
+            {
+                return parseError(line_number, "invalid values for sprite option " + option);
+            }
+        }
+
+        ++currentLayer(scene).sprite_count;
+        scene.sprites.push_back(sprite);
+        return true;
+    }
+
+    /*!
+    * @brief Parse a tilemap statement and its rows of tiles
+    */
+    bool parseTilemap(std::istringstream& arguments, std::istream& input, Scene& scene, unsigned int& line_number)
+    {
+        SceneTilemapRecord tilemap;
+        std::memset(&tilemap, 0, sizeof(tilemap));
+        unsigned int texture, tile_width, tile_height, columns, rows, tileset_columns;
+        if(!(arguments >> texture >> tilemap.x >> tilemap.y >> tile_width >> tile_height >> columns >> rows >> tileset_columns) || tileset_columns == 0)
+        {
+            return parseError(line_number, "expected tilemap <texture> <x> <y> <tile_width> <tile_height> <columns> <rows> <tileset_columns>");
+        }
+        if(texture >= scene.texture_paths.size())
+        {
+            return parseError(line_number, "undeclared texture");
+        }
+        if(tile_width > 0xFFFF || tile_height > 0xFFFF || columns > 0xFFFF || rows > 0xFFFF || tileset_columns > 0xFFFF)
+        {
+            return parseError(line_number, "tilemap dimensions out of range");
+        }
+        tilemap.texture = static_cast<uint16_t>(texture);
+        tilemap.tile_width = static_cast<uint16_t>(tile_width);
+        tilemap.tile_height = static_cast<uint16_t>(tile_height);
+        tilemap.columns = static_cast<uint16_t>(columns);
+        tilemap.rows = static_cast<uint16_t>(rows);
+        tilemap.tileset_columns = static_cast<uint16_t>(tileset_columns);
+        tilemap.first_tile = static_cast<uint32_t>(scene.tiles.size());
+
+        for(unsigned int row = 0; row < rows; ++row)
+        {
+            std::string line;
+            if(!std::getline(input, line))
+            {
+                return parseError(line_number, "missing tilemap rows");
+            }
+            ++line_number;
+            std::istringstream row_stream(line);
+            for(unsigned int column = 0; column < columns; ++column)
+            {
+                int tile = 0;
+                if(!(row_stream >> tile) || tile < -1 || tile >= SCENE_EMPTY_TILE)
+                {
+                    return parseError(line_number, "invalid tile index");
+                }
+                scene.tiles.push_back(tile == -1 ? SCENE_EMPTY_TILE : static_cast<uint16_t>(tile));
+            }
+        }
+
+        SceneLayerRecord& layer = currentLayer(scene);
+        if(layer.tilemap_count == 0)
+        {
+            layer.first_tilemap = static_cast<uint32_t>(scene.tilemaps.size());
+        }
+        ++layer.tilemap_count;
+        scene.tilemaps.push_back(tilemap);
+        return true;
+    }
+
+    /*!
+    * @brief Parse a text scene description
+    */
+    bool parseScene(std::istream& input, Scene& scene)
+    {
+        std::string line;
+        unsigned int line_number = 0;
+        while(std::getline(input, line))
+        {
+            ++line_number;
+            std::istringstream arguments(line);
+            std::string statement;
+            if(!(arguments >> statement) || statement[0] == '#')
+            {
+                continue;
+            }
+
+            if(statement == "texture")
+            {
+                std::string path;
+                if(!(arguments >> path))
+                {
+                    return parseError(line_number, "expected texture <path>");
+                }
+                scene.texture_paths.push_back(path);
+            }
+            else if(statement == "layer")
+            {
+                SceneLayerRecord layer;
+                std::memset(&layer, 0, sizeof(layer));
+                layer.first_sprite = static_cast<uint32_t>(scene.sprites.size());
+                layer.first_tilemap = static_cast<uint32_t>(scene.tilemaps.size());
+                scene.layers.push_back(layer);
+            }
+            else if(statement == "sprite")
+            {
+                if(!parseSprite(arguments, scene, line_number))
+                {
+                    return false;
+                }
+            }
+            else if(statement == "tilemap")
+            {
+                if(!parseTilemap(arguments, input, scene, line_number))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return parseError(line_number, "unknown statement " + statement);
+            }
+        }
+        return true;
+    }
+
+    /*!
+    * @brief Round an offset up to the next 8 bytes boundary
+    */
+    uint64_t align(uint64_t offset)
+    {
+        return (offset + 7) & ~static_cast<uint64_t>(7);
+    }
+
+    /*!
+    * @brief Write a section at its offset, padding the file up to it
+    */
+    void writeSection(std::ofstream& output, uint64_t offset, const void* data, uint64_t size)
+    {
+        static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        output.write(padding, offset - static_cast<uint64_t>(output.tellp()));
+        output.write(reinterpret_cast<const char*>(data), size);
+    }
+
+    /*!
+    * @brief Write a compiled scene
+    */
+    bool writeScene(const Scene& scene, const char* path)
+    {
+        // Gather texture paths in string table
+        std::string strings;
+        std::vector<SceneTextureRecord> textures;
+        for(std::vector<std::string>::const_iterator path_it = scene.texture_paths.begin(); path_it != scene.texture_paths.end(); ++path_it)
+        {
+            SceneTextureRecord texture;
+            texture.path_offset = static_cast<uint32_t>(strings.size());
+            texture.path_length = static_cast<uint32_t>(path_it->size());
+            textures.push_back(texture);
+            strings += *path_it;
+        }
+
+        SceneFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = SCENE_FILE_MAGIC;
+        header.version = SCENE_FILE_VERSION;
+        header.texture_count = static_cast<uint32_t>(textures.size());
+        header.layer_count = static_cast<uint32_t>(scene.layers.size());
+        header.sprite_count = static_cast<uint32_t>(scene.sprites.size());
+        header.tilemap_count = static_cast<uint32_t>(scene.tilemaps.size());
+        header.tile_count = static_cast<uint32_t>(scene.tiles.size());
+        header.strings_size = static_cast<uint32_t>(strings.size());
+        header.textures_offset = align(sizeof(header));
+        header.layers_offset = align(header.textures_offset + textures.size() * sizeof(SceneTextureRecord));
+        header.sprites_offset = align(header.layers_offset + scene.layers.size() * sizeof(SceneLayerRecord));
+        header.tilemaps_offset = align(header.sprites_offset + scene.sprites.size() * sizeof(SceneSpriteRecord));
+        header.tiles_offset = align(header.tilemaps_offset + scene.tilemaps.size() * sizeof(SceneTilemapRecord));
+        header.strings_offset = align(header.tiles_offset + scene.tiles.size() * sizeof(uint16_t));
+
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        if(!output)
+        {
+            std::cerr << "cannot open " << path << std::endl;
+            return false;
+        }
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeSection(output, header.textures_offset, textures.data(), textures.size() * sizeof(SceneTextureRecord));
+        writeSection(output, header.layers_offset, scene.layers.data(), scene.layers.size() * sizeof(SceneLayerRecord));
+        writeSection(output, header.sprites_offset, scene.sprites.data(), scene.sprites.size() * sizeof(SceneSpriteRecord));
+        writeSection(output, header.tilemaps_offset, scene.tilemaps.data(), scene.tilemaps.size() * sizeof(SceneTilemapRecord));
+        writeSection(output, header.tiles_offset, scene.tiles.data(), scene.tiles.size() * sizeof(uint16_t));
+        writeSection(output, header.strings_offset, strings.data(), strings.size());
+        return static_cast<bool>(output);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc != 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <input.scene.txt> <output.scene>" << std::endl;
+        return 1;
+    }
+
+    std::ifstream input(argv[1]);
+    if(!input)
+    {
+        std::cerr << "cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    Scene scene;
+    if(!parseScene(input, scene) || !writeScene(scene, argv[2]))
+    {
+        return 1;
+    }
+
+    std::cout << scene.layers.size() << " layers, " << scene.sprites.size() << " sprites, " << scene.tilemaps.size() << " tilemaps written to " << argv[2] << std::endl;
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|